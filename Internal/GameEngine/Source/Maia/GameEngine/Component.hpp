@@ -49,10 +49,17 @@ namespace Maia::GameEngine
 	};
 
 
+	struct Component_alignment
+	{
+		std::uint16_t value;
+	};
+
+
 	struct Component_info
 	{
 		Component_ID id;
 		Component_size size;
+		Component_alignment alignment;
 	};
 
 	template <class Component>
@@ -61,7 +68,8 @@ namespace Maia::GameEngine
 		return 
 		{
 			Component_ID::get<Component>(),
-			{ sizeof(Component) }
+			{ sizeof(Component) },
+			{ alignof(Component) }
 		};
 	}
 }
@@ -1,6 +1,8 @@
 #include "Component_group.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <optional>
 
 #include <gsl/span>
@@ -35,6 +37,11 @@ namespace Maia::GameEngine
 
 			for (Component_info const& component_info : component_infos)
 			{
+				std::size_t const alignment = component_info.alignment.value;
+				assert(alignment > 0 && Components_chunk::alignment_in_bytes % alignment == 0);
+
+				current_offset = (current_offset + alignment - 1) / alignment * alignment;
+
 				type_infos.push_back({ component_info.id, { current_offset }, component_info.size });
 
 				current_offset += capacity_per_chunk * component_info.size.value;
@@ -42,17 +49,35 @@ namespace Maia::GameEngine
 
 			return type_infos;
 		}
+
+		std::size_t calculate_chunk_size_in_bytes(
+			gsl::span<Component_type_info const> const type_infos,
+			std::size_t const capacity_per_chunk
+		)
+		{
+			std::size_t chunk_size_in_bytes{ 0 };
+
+			for (Component_type_info const& type_info : type_infos)
+			{
+				chunk_size_in_bytes = std::max(chunk_size_in_bytes, type_info.offset + capacity_per_chunk * type_info.size.value);
+			}
+
+			return chunk_size_in_bytes;
+		}
 	}
 
 	Component_group::Component_group(
 		gsl::span<Component_info const> const component_infos,
-		std::size_t const capacity_per_chunk
+		std::size_t const capacity_per_chunk,
+		std::pmr::memory_resource* const chunk_memory_resource
 	) :
 		m_size{ 0 },
 		m_size_of_single_element{ calculate_size_of_single_element(component_infos) },
 		m_capacity_per_chunk{ capacity_per_chunk },
 		m_chunks{},
-		m_component_type_infos{ create_component_type_infos(component_infos, m_capacity_per_chunk) }
+		m_component_type_infos{ create_component_type_infos(component_infos, m_capacity_per_chunk) },
+		m_chunk_size_in_bytes{ calculate_chunk_size_in_bytes(m_component_type_infos, m_capacity_per_chunk) },
+		m_chunk_memory_resource{ chunk_memory_resource }
 	{
 	}
 
@@ -77,8 +102,18 @@ namespace Maia::GameEngine
 
 		while (m_chunks.size() < number_of_chunks)
 		{
-			Components_chunk& chunk = m_chunks.emplace_back();
-			chunk.resize(m_capacity_per_chunk * m_size_of_single_element, std::byte{});
+			m_chunks.emplace_back(chunk_size_in_bytes(), m_chunk_memory_resource);
+		}
+	}
+
+	void Component_group::reserve(std::size_t const new_capacity, Components_chunk_pool& chunk_pool)
+	{
+		std::size_t const number_of_chunks = new_capacity / m_capacity_per_chunk
+			+ (new_capacity % m_capacity_per_chunk > 0 ? 1 : 0);
+
+		while (m_chunks.size() < number_of_chunks)
+		{
+			m_chunks.push_back(chunk_pool.acquire(chunk_size_in_bytes()));
 		}
 	}
 
@@ -97,6 +132,48 @@ namespace Maia::GameEngine
 		m_chunks.shrink_to_fit();
 	}
 
+	std::size_t Component_group::num_empty_chunks() const
+	{
+		std::size_t const ideal_number_of_chunks = size() / m_capacity_per_chunk
+			+ (size() % m_capacity_per_chunk > 0 ? 1 : 0);
+
+		return m_chunks.size() - ideal_number_of_chunks;
+	}
+
+	std::size_t Component_group::release_empty_chunks(Components_chunk_pool& chunk_pool, std::size_t const max_num_chunks)
+	{
+		std::size_t const num_chunks_to_release = std::min(num_empty_chunks(), max_num_chunks);
+
+		for (std::size_t index = 0; index < num_chunks_to_release; ++index)
+		{
+			chunk_pool.release(std::move(m_chunks.back()));
+			m_chunks.pop_back();
+		}
+
+		return num_chunks_to_release;
+	}
+
+
+	std::size_t Component_group::capacity_per_chunk() const
+	{
+		return m_capacity_per_chunk;
+	}
+
+	std::size_t Component_group::size_of_single_element() const
+	{
+		return m_size_of_single_element;
+	}
+
+	std::size_t Component_group::chunk_size_in_bytes() const
+	{
+		return m_chunk_size_in_bytes;
+	}
+
+	gsl::span<Component_type_info const> Component_group::component_type_infos() const
+	{
+		return m_component_type_infos;
+	}
+
 
 
 	std::optional<Component_group_entity_moved> Component_group::erase(Index index)
@@ -107,8 +184,9 @@ namespace Maia::GameEngine
 			Components_chunk& chunk_to_delete_from = m_chunks[chunk_to_delete_from_index];
 			std::size_t const entity_to_delete_index = calculate_entity_index(index);
 
-			Components_chunk const& chunk_to_copy_from = m_chunks.back();
-			std::size_t const entity_to_copy_index = m_size - m_capacity_per_chunk * (m_chunks.size() - 1) - 1;
+			Index const last_index = { m_size - 1 };
+			Components_chunk const& chunk_to_copy_from = get_entity_chunk(last_index);
+			std::size_t const entity_to_copy_index = calculate_entity_index(last_index);
 
 			for (Component_type_info const type_info : m_component_type_infos)
 			{
@@ -160,6 +238,68 @@ namespace Maia::GameEngine
 		decrement_size();
 	}
 
+	void Component_group::swap(Index const lhs, Index const rhs)
+	{
+		assert(lhs.value < m_size && rhs.value < m_size);
+
+		if (lhs.value == rhs.value)
+		{
+			return;
+		}
+
+		Components_chunk& lhs_chunk = get_entity_chunk(lhs);
+		Components_chunk& rhs_chunk = get_entity_chunk(rhs);
+		std::size_t const lhs_entity_index = calculate_entity_index(lhs);
+		std::size_t const rhs_entity_index = calculate_entity_index(rhs);
+
+		for (Component_type_info const type_info : m_component_type_infos)
+		{
+			std::size_t const component_offset = type_info.offset;
+			std::size_t const component_size = type_info.size.value;
+
+			std::swap_ranges(
+				lhs_chunk.data() + component_offset + lhs_entity_index * component_size,
+				lhs_chunk.data() + component_offset + (lhs_entity_index + 1) * component_size,
+				rhs_chunk.data() + component_offset + rhs_entity_index * component_size
+			);
+		}
+	}
+
+	void Component_group::apply_permutation(gsl::span<std::size_t const> const permutation)
+	{
+		assert(static_cast<std::size_t>(permutation.size()) == m_size);
+
+		std::vector<std::byte> column;
+
+		for (Component_type_info const type_info : m_component_type_infos)
+		{
+			std::size_t const component_offset = type_info.offset;
+			std::size_t const component_size = type_info.size.value;
+
+			column.resize(m_size * component_size);
+
+			for (std::size_t index = 0; index < m_size; ++index)
+			{
+				Index const source_index = { permutation[index] };
+				assert(source_index.value < m_size);
+
+				std::byte const* const source = get_entity_chunk(source_index).data() + component_offset + calculate_entity_index(source_index) * component_size;
+				std::memcpy(column.data() + index * component_size, source, component_size);
+			}
+
+			for (std::size_t chunk_index = 0; chunk_index < m_chunks.size(); ++chunk_index)
+			{
+				std::size_t const num_elements = num_elements_in_chunk(chunk_index);
+
+				std::memcpy(
+					m_chunks[chunk_index].data() + component_offset,
+					column.data() + chunk_index * m_capacity_per_chunk * component_size,
+					num_elements * component_size
+				);
+			}
+		}
+	}
+
 
 
 	std::byte const* Component_group::get_component_data_impl(Component_ID const component_id, Index index) const
@@ -198,6 +338,20 @@ namespace Maia::GameEngine
 		--m_size;
 	}
 
+	std::size_t Component_group::num_elements_in_chunk(std::size_t const chunk_index) const
+	{
+		std::size_t const first_element_index = m_capacity_per_chunk * chunk_index;
+
+		if (first_element_index >= m_size)
+		{
+			return 0;
+		}
+		else
+		{
+			return std::min(m_size - first_element_index, m_capacity_per_chunk);
+		}
+	}
+
 	Components_chunk const& Component_group::get_entity_chunk(Component_group_entity_index component_group_index) const
 	{
 		return m_chunks[component_group_index.value / m_capacity_per_chunk];
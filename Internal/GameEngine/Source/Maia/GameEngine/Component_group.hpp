@@ -2,6 +2,7 @@
 #define MAIA_GAMEENGINE_COMPONENTGROUP_H_INCLUDED
 
 #include <cstddef>
+#include <memory_resource>
 #include <vector>
 
 #include <gsl/span>
@@ -9,6 +10,7 @@
 #include <Maia/GameEngine/Entity.hpp>
 
 #include <Maia/GameEngine/Components_chunk.hpp>
+#include <Maia/GameEngine/Components_chunk_pool.hpp>
 
 namespace std
 {
@@ -51,9 +53,11 @@ namespace Maia::GameEngine
 		using Element_moved = Component_group_entity_moved;
 
 
+		// The chunks that are not acquired from a chunk pool are allocated from chunk_memory_resource.
 		Component_group(
 			gsl::span<Component_info const> component_infos,
-			std::size_t capacity_per_chunk
+			std::size_t capacity_per_chunk,
+			std::pmr::memory_resource* chunk_memory_resource = std::pmr::get_default_resource()
 		);
 
 
@@ -72,10 +76,31 @@ namespace Maia::GameEngine
 
 		void reserve(std::size_t new_capacity);
 
+		void reserve(std::size_t new_capacity, Components_chunk_pool& chunk_pool);
+
 		std::size_t capacity() const;
 
+		// Deallocates the empty chunks to their memory resource. To recycle them instead, release them to a chunk
+		// pool with release_empty_chunks.
 		void shrink_to_fit();
 
+		std::size_t num_empty_chunks() const;
+
+		// Moves at most max_num_chunks empty chunks from the back of the group to chunk_pool.
+		// Elements are always kept contiguous, so only trailing chunks can be empty.
+		std::size_t release_empty_chunks(Components_chunk_pool& chunk_pool, std::size_t max_num_chunks);
+
+
+		std::size_t capacity_per_chunk() const;
+
+		std::size_t size_of_single_element() const;
+
+		// Each component column starts at an offset aligned to the component alignment, so the chunk can be larger
+		// than capacity_per_chunk * size_of_single_element.
+		std::size_t chunk_size_in_bytes() const;
+
+		gsl::span<Component_type_info const> component_type_infos() const;
+
 
 
 		std::optional<Element_moved> erase(Index index);
@@ -92,6 +117,12 @@ namespace Maia::GameEngine
 
 		void pop_back();
 
+		void swap(Index lhs, Index rhs);
+
+		// Reorders the elements so that the element at index i is the one previously at permutation[i].
+		// The permutation is applied one component column at a time.
+		void apply_permutation(gsl::span<std::size_t const> permutation);
+
 
 
 		template <typename Component>
@@ -131,10 +162,8 @@ namespace Maia::GameEngine
 		{
 			Component_ID const component_id = Component_ID::get<Component>();
 			std::size_t const component_offset = get_component_offset(component_id);
-			
-			std::size_t const num_elements = chunk_index == m_chunks.size() - 1 ?
-				m_size - m_capacity_per_chunk * chunk_index :
-				m_capacity_per_chunk;
+
+			std::size_t const num_elements = num_elements_in_chunk(chunk_index);
 
 			return m_chunks[chunk_index].components<Component>(component_offset, num_elements);
 		}
@@ -145,9 +174,7 @@ namespace Maia::GameEngine
 			Component_ID const component_id = Component_ID::get<Component>();
 			std::size_t const component_offset = get_component_offset(component_id);
 
-			std::size_t const num_elements = chunk_index == m_chunks.size() - 1 ?
-				m_size - m_capacity_per_chunk * chunk_index :
-				m_capacity_per_chunk;
+			std::size_t const num_elements = num_elements_in_chunk(chunk_index);
 
 			return m_chunks[chunk_index].components<Component>(component_offset, num_elements);
 		}
@@ -165,6 +192,8 @@ namespace Maia::GameEngine
 		void increment_size();
 		void decrement_size();
 
+		std::size_t num_elements_in_chunk(std::size_t chunk_index) const;
+
 
 
 		Components_chunk const& get_entity_chunk(Component_group_entity_index component_group_index) const;
@@ -188,20 +217,25 @@ namespace Maia::GameEngine
 		std::size_t m_capacity_per_chunk;
 		std::vector<Components_chunk> m_chunks;
 		std::vector<Component_type_info> m_component_type_infos;
+		std::size_t m_chunk_size_in_bytes;
+		std::pmr::memory_resource* m_chunk_memory_resource;
 
 	};
 
 
 
 	template <typename... Component>
-	Component_group make_component_group(std::size_t capacity_per_chunk)
+	Component_group make_component_group(
+		std::size_t capacity_per_chunk,
+		std::pmr::memory_resource* chunk_memory_resource = std::pmr::get_default_resource()
+	)
 	{
 		std::array<Component_info, sizeof...(Component)> component_infos
 		{
-			Component_info { Component_ID::get<Component>(), { sizeof(Component) } }...
+			Component_info { Component_ID::get<Component>(), { sizeof(Component) }, { alignof(Component) } }...
 		};
 
-		return { component_infos, capacity_per_chunk };
+		return { component_infos, capacity_per_chunk, chunk_memory_resource };
 	}
 }
 
@@ -0,0 +1 @@
+#include "Local_bounds.hpp"
@@ -0,0 +1,15 @@
+#ifndef MAIA_GAMEENGINE_LOCALBOUNDS_H_INCLUDED
+#define MAIA_GAMEENGINE_LOCALBOUNDS_H_INCLUDED
+
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+
+namespace Maia::GameEngine::Components
+{
+	// Bounds in the entity local space, usually the bounds of its mesh.
+	struct Local_bounds
+	{
+		Spatial::Aabb value;
+	};
+}
+
+#endif
@@ -0,0 +1 @@
+#include "Lod_level.hpp"
@@ -0,0 +1,16 @@
+#ifndef MAIA_GAMEENGINE_LODLEVEL_H_INCLUDED
+#define MAIA_GAMEENGINE_LODLEVEL_H_INCLUDED
+
+#include <cstdint>
+
+namespace Maia::GameEngine::Components
+{
+	// Level of detail the entity is rendered with, where 0 is the most detailed one.
+	// It is kept between frames because the next level depends on it.
+	struct Lod_level
+	{
+		std::uint8_t value;
+	};
+}
+
+#endif
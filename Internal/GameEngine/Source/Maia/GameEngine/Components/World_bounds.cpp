@@ -0,0 +1 @@
+#include "World_bounds.hpp"
@@ -0,0 +1,15 @@
+#ifndef MAIA_GAMEENGINE_WORLDBOUNDS_H_INCLUDED
+#define MAIA_GAMEENGINE_WORLDBOUNDS_H_INCLUDED
+
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+
+namespace Maia::GameEngine::Components
+{
+	// Local_bounds transformed by the Transform_matrix of the entity.
+	struct World_bounds
+	{
+		Spatial::Aabb value;
+	};
+}
+
+#endif
@@ -1,25 +1,106 @@
 #include "Components_chunk.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 namespace Maia::GameEngine
 {
+	Components_chunk::Components_chunk() noexcept :
+		m_memory_resource{ std::pmr::get_default_resource() },
+		m_data{ nullptr },
+		m_size_in_bytes{ 0 }
+	{
+	}
+
+	Components_chunk::Components_chunk(std::size_t const size_in_bytes, std::pmr::memory_resource* const memory_resource) :
+		m_memory_resource{ memory_resource },
+		m_data{ nullptr },
+		m_size_in_bytes{ 0 }
+	{
+		resize(size_in_bytes, std::byte{});
+	}
+
+	Components_chunk::Components_chunk(Components_chunk&& other) noexcept :
+		m_memory_resource{ other.m_memory_resource },
+		m_data{ std::exchange(other.m_data, nullptr) },
+		m_size_in_bytes{ std::exchange(other.m_size_in_bytes, 0) }
+	{
+	}
+
+	Components_chunk::~Components_chunk() noexcept
+	{
+		if (m_data != nullptr)
+		{
+			m_memory_resource->deallocate(m_data, m_size_in_bytes, alignment_in_bytes);
+		}
+	}
+
+	Components_chunk& Components_chunk::operator=(Components_chunk&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (m_data != nullptr)
+			{
+				m_memory_resource->deallocate(m_data, m_size_in_bytes, alignment_in_bytes);
+			}
+
+			m_memory_resource = other.m_memory_resource;
+			m_data = std::exchange(other.m_data, nullptr);
+			m_size_in_bytes = std::exchange(other.m_size_in_bytes, 0);
+		}
+
+		return *this;
+	}
+
+
 	std::byte* Components_chunk::data()
 	{
-		return m_data.data();
+		return m_data;
 	}
 
 	std::byte const* Components_chunk::data() const
 	{
-		return m_data.data();
+		return m_data;
 	}
 
 	std::size_t Components_chunk::size() const
 	{
-		return m_data.size();
+		return m_size_in_bytes;
+	}
+
+	std::pmr::memory_resource* Components_chunk::memory_resource() const
+	{
+		return m_memory_resource;
 	}
 
 
 	void Components_chunk::resize(std::size_t const count, std::byte const value)
 	{
-		m_data.resize(count, value);
+		if (count == m_size_in_bytes)
+		{
+			return;
+		}
+
+		std::byte* const data = count > 0 ?
+			static_cast<std::byte*>(m_memory_resource->allocate(count, alignment_in_bytes)) :
+			nullptr;
+
+		std::size_t const num_kept_bytes = std::min(count, m_size_in_bytes);
+
+		if (num_kept_bytes > 0)
+		{
+			std::memcpy(data, m_data, num_kept_bytes);
+		}
+
+		std::fill(data + num_kept_bytes, data + count, value);
+
+		if (m_data != nullptr)
+		{
+			m_memory_resource->deallocate(m_data, m_size_in_bytes, alignment_in_bytes);
+		}
+
+		m_data = data;
+		m_size_in_bytes = count;
 	}
 }
@@ -2,17 +2,20 @@
 #define MAIA_GAMEENGINE_COMPONENTSCHUNK_H_INCLUDED
 
 #include <cstddef>
+#include <memory_resource>
 #include <type_traits>
-#include <vector>
 
 #include <gsl/span>
 
 namespace Maia::GameEngine
 {
+	// Block of component data allocated from a memory resource and aligned to a cache line.
 	class Components_chunk
 	{
 	public:
 
+		static constexpr std::size_t alignment_in_bytes = 64;
+
 		template <typename Component>
 		using Reference = std::remove_const_t<std::remove_reference_t<Component>>&;
 
@@ -20,6 +23,20 @@ namespace Maia::GameEngine
 		using Const_reference = std::remove_const_t<std::remove_reference_t<Component>> const&;
 
 
+		Components_chunk() noexcept;
+
+		explicit Components_chunk(
+			std::size_t size_in_bytes,
+			std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource()
+		);
+		Components_chunk(Components_chunk const&) = delete;
+		Components_chunk(Components_chunk&& other) noexcept;
+		~Components_chunk() noexcept;
+
+		Components_chunk& operator=(Components_chunk const&) = delete;
+		Components_chunk& operator=(Components_chunk&& other) noexcept;
+
+
 		std::byte* data();
 
 		std::byte const* data() const;
@@ -27,21 +44,24 @@ namespace Maia::GameEngine
 
 		std::size_t size() const;
 
+		std::pmr::memory_resource* memory_resource() const;
+
 
+		// Keeps the first bytes of the data and sets the new ones to value.
 		void resize(std::size_t count, std::byte value);
 
 
 		template <typename Component>
 		Const_reference<Component> get_component_data(std::size_t component_offset, std::size_t component_index) const
 		{
-			auto pointer = m_data.data() + component_offset + component_index * sizeof(Component);
+			auto pointer = m_data + component_offset + component_index * sizeof(Component);
 			return reinterpret_cast<Const_reference<Component>>(*pointer);
 		}
 
 		template <typename Component>
 		Reference<Component> get_component_data(std::size_t component_offset, std::size_t component_index)
 		{
-			auto pointer = m_data.data() + component_offset + component_index * sizeof(Component);
+			auto pointer = m_data + component_offset + component_index * sizeof(Component);
 			return reinterpret_cast<Reference<Component>>(*pointer);
 		}
 
@@ -55,19 +75,21 @@ namespace Maia::GameEngine
 		template <typename Component>
 		gsl::span<Component> components(std::size_t offset, std::ptrdiff_t count)
 		{
-			return { reinterpret_cast<Component*>(m_data.data() + offset), count };
+			return { reinterpret_cast<Component*>(m_data + offset), count };
 		}
 
 		template <typename Component>
 		gsl::span<Component const> components(std::size_t offset, std::ptrdiff_t count) const
 		{
-			return { reinterpret_cast<Component const*>(m_data.data() + offset), count };
+			return { reinterpret_cast<Component const*>(m_data + offset), count };
 		}
 
 
 	private:
 
-		std::vector<std::byte> m_data;
+		std::pmr::memory_resource* m_memory_resource;
+		std::byte* m_data;
+		std::size_t m_size_in_bytes;
 
 	};
 }
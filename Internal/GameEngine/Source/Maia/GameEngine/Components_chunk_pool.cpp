@@ -0,0 +1,101 @@
+#include "Components_chunk_pool.hpp"
+
+#include <algorithm>
+
+namespace Maia::GameEngine
+{
+	Components_chunk_pool::Components_chunk_pool(std::size_t const max_size_in_bytes, std::pmr::memory_resource* const memory_resource) :
+		m_size_classes{},
+		m_size_in_bytes{ 0 },
+		m_max_size_in_bytes{ max_size_in_bytes },
+		m_memory_resource{ memory_resource }
+	{
+	}
+
+
+	Components_chunk Components_chunk_pool::acquire(std::size_t const chunk_size_in_bytes)
+	{
+		auto const size_class = std::find_if(m_size_classes.begin(), m_size_classes.end(),
+			[chunk_size_in_bytes](Size_class const& size_class) -> bool { return size_class.chunk_size_in_bytes == chunk_size_in_bytes; });
+
+		if (size_class != m_size_classes.end() && !size_class->chunks.empty())
+		{
+			Components_chunk chunk = std::move(size_class->chunks.back());
+			size_class->chunks.pop_back();
+
+			m_size_in_bytes -= chunk_size_in_bytes;
+
+			return chunk;
+		}
+		else
+		{
+			return Components_chunk{ chunk_size_in_bytes, m_memory_resource };
+		}
+	}
+
+	void Components_chunk_pool::release(Components_chunk&& chunk)
+	{
+		std::size_t const chunk_size_in_bytes = chunk.size();
+
+		auto size_class = std::find_if(m_size_classes.begin(), m_size_classes.end(),
+			[chunk_size_in_bytes](Size_class const& size_class) -> bool { return size_class.chunk_size_in_bytes == chunk_size_in_bytes; });
+
+		if (size_class == m_size_classes.end())
+		{
+			size_class = m_size_classes.insert(m_size_classes.end(), Size_class{ chunk_size_in_bytes, {} });
+		}
+
+		m_size_in_bytes += chunk_size_in_bytes;
+		size_class->chunks.push_back(std::move(chunk));
+	}
+
+	void Components_chunk_pool::trim()
+	{
+		// The oldest chunks of each size are deallocated first, with a single erase of the range per size
+		for (Size_class& size_class : m_size_classes)
+		{
+			auto last_to_deallocate = size_class.chunks.begin();
+
+			while (m_size_in_bytes > m_max_size_in_bytes && last_to_deallocate != size_class.chunks.end())
+			{
+				m_size_in_bytes -= size_class.chunk_size_in_bytes;
+				++last_to_deallocate;
+			}
+
+			size_class.chunks.erase(size_class.chunks.begin(), last_to_deallocate);
+		}
+	}
+
+
+	std::size_t Components_chunk_pool::num_chunks() const
+	{
+		std::size_t num_chunks = 0;
+
+		for (Size_class const& size_class : m_size_classes)
+		{
+			num_chunks += size_class.chunks.size();
+		}
+
+		return num_chunks;
+	}
+
+	std::size_t Components_chunk_pool::size_in_bytes() const
+	{
+		return m_size_in_bytes;
+	}
+
+	std::size_t Components_chunk_pool::max_size_in_bytes() const
+	{
+		return m_max_size_in_bytes;
+	}
+
+	void Components_chunk_pool::set_max_size_in_bytes(std::size_t const max_size_in_bytes)
+	{
+		m_max_size_in_bytes = max_size_in_bytes;
+	}
+
+	std::pmr::memory_resource* Components_chunk_pool::memory_resource() const
+	{
+		return m_memory_resource;
+	}
+}
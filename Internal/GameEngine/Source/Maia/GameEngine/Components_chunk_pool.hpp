@@ -0,0 +1,64 @@
+#ifndef MAIA_GAMEENGINE_COMPONENTSCHUNKPOOL_H_INCLUDED
+#define MAIA_GAMEENGINE_COMPONENTSCHUNKPOOL_H_INCLUDED
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include <Maia/GameEngine/Components_chunk.hpp>
+
+namespace Maia::GameEngine
+{
+	// Keeps released chunks so that they can be reused by any component group with the same chunk size.
+	// Chunks are kept in a list per chunk size, and the most recently released one of a size is reused first.
+	// Chunks that do not fit in max_size_in_bytes are deallocated when the pool is trimmed, the oldest first.
+	// New chunks are allocated from memory_resource, such as a Virtual_memory_arena that keeps them contiguous.
+	class Components_chunk_pool
+	{
+	public:
+
+		static constexpr std::size_t default_max_size_in_bytes = 1024 * 1024;
+
+
+		explicit Components_chunk_pool(
+			std::size_t max_size_in_bytes = default_max_size_in_bytes,
+			std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource()
+		);
+
+
+		Components_chunk acquire(std::size_t chunk_size_in_bytes);
+
+		void release(Components_chunk&& chunk);
+
+		void trim();
+
+
+		std::size_t num_chunks() const;
+
+		std::size_t size_in_bytes() const;
+
+		std::size_t max_size_in_bytes() const;
+
+		void set_max_size_in_bytes(std::size_t max_size_in_bytes);
+
+		std::pmr::memory_resource* memory_resource() const;
+
+
+	private:
+
+		struct Size_class
+		{
+			std::size_t chunk_size_in_bytes;
+			std::vector<Components_chunk> chunks;
+		};
+
+
+		std::vector<Size_class> m_size_classes;
+		std::size_t m_size_in_bytes;
+		std::size_t m_max_size_in_bytes;
+		std::pmr::memory_resource* m_memory_resource;
+
+	};
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include "Depth_rasterizer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAIA_GAMEENGINE_RASTERIZER_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Maia::GameEngine::Culling
+{
+	namespace
+	{
+		constexpr float minimum_w = 1e-5f;
+
+		// Coefficients of the plane a * x + b * y + c.
+		struct Plane_equation
+		{
+			float a;
+			float b;
+			float c;
+		};
+
+		struct Triangle_setup
+		{
+			std::array<Plane_equation, 3> edges;
+			Plane_equation depth;
+			std::size_t min_x;
+			std::size_t max_x;
+			std::size_t min_y;
+			std::size_t max_y;
+		};
+
+		// The edge function of a -> b, which is positive on the inner side of counter-clockwise triangles.
+		Plane_equation create_edge(float const a_x, float const a_y, float const b_x, float const b_y)
+		{
+			return { a_y - b_y, b_x - a_x, (b_y - a_y) * a_x - (b_x - a_x) * a_y };
+		}
+
+		bool setup(
+			Screen_triangle const& triangle,
+			std::size_t const width,
+			std::size_t const first_row,
+			std::size_t const last_row,
+			Triangle_setup& output
+		)
+		{
+			float const min_x = std::min({ triangle.x[0], triangle.x[1], triangle.x[2] });
+			float const max_x = std::max({ triangle.x[0], triangle.x[1], triangle.x[2] });
+			float const min_y = std::min({ triangle.y[0], triangle.y[1], triangle.y[2] });
+			float const max_y = std::max({ triangle.y[0], triangle.y[1], triangle.y[2] });
+
+			if (max_x < 0.0f || min_x >= static_cast<float>(width) || max_y < static_cast<float>(first_row) || min_y >= static_cast<float>(last_row))
+			{
+				return false;
+			}
+
+			output.min_x = static_cast<std::size_t>(std::max(min_x, 0.0f));
+			output.max_x = static_cast<std::size_t>(std::min(max_x, static_cast<float>(width - 1)));
+			output.min_y = static_cast<std::size_t>(std::max(min_y, static_cast<float>(first_row)));
+			output.max_y = static_cast<std::size_t>(std::min(max_y, static_cast<float>(last_row - 1)));
+
+			output.edges[0] = create_edge(triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2]);
+			output.edges[1] = create_edge(triangle.x[2], triangle.y[2], triangle.x[0], triangle.y[0]);
+			output.edges[2] = create_edge(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1]);
+
+			// edges[i] is zero on the edge opposite to vertex i, so it is the unnormalized barycentric coordinate of vertex i
+			float const area = output.edges[2].a * triangle.x[2] + output.edges[2].b * triangle.y[2] + output.edges[2].c;
+			assert(area > 0.0f);
+
+			output.depth = { 0.0f, 0.0f, 0.0f };
+
+			for (std::size_t vertex_index = 0; vertex_index < 3; ++vertex_index)
+			{
+				float const weight = triangle.z[vertex_index] / area;
+
+				output.depth.a += output.edges[vertex_index].a * weight;
+				output.depth.b += output.edges[vertex_index].b * weight;
+				output.depth.c += output.edges[vertex_index].c * weight;
+			}
+
+			return true;
+		}
+	}
+
+	void setup_triangles(
+		gsl::span<Eigen::Vector3f const> const vertices,
+		gsl::span<std::uint32_t const> const indices,
+		Eigen::Matrix4f const& view_projection,
+		std::size_t const width,
+		std::size_t const height,
+		std::vector<Screen_triangle>& triangles
+	)
+	{
+		assert(indices.size() % 3 == 0);
+
+		float const half_width = 0.5f * static_cast<float>(width);
+		float const half_height = 0.5f * static_cast<float>(height);
+
+		for (std::ptrdiff_t index = 0; index + 2 < indices.size(); index += 3)
+		{
+			Screen_triangle triangle;
+			bool discard = false;
+
+			for (std::size_t vertex_index = 0; vertex_index < 3; ++vertex_index)
+			{
+				Eigen::Vector3f const& vertex = vertices[indices[index + vertex_index]];
+				Eigen::Vector4f const clip = view_projection * Eigen::Vector4f{ vertex(0), vertex(1), vertex(2), 1.0f };
+
+				if (clip(3) <= minimum_w || clip(2) < 0.0f)
+				{
+					discard = true;
+					break;
+				}
+
+				float const inverse_w = 1.0f / clip(3);
+
+				triangle.x[vertex_index] = (clip(0) * inverse_w + 1.0f) * half_width;
+				triangle.y[vertex_index] = (1.0f - clip(1) * inverse_w) * half_height;
+				triangle.z[vertex_index] = std::min(clip(2) * inverse_w, 1.0f);
+			}
+
+			if (discard)
+			{
+				continue;
+			}
+
+			float const area =
+				(triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) -
+				(triangle.y[1] - triangle.y[0]) * (triangle.x[2] - triangle.x[0]);
+
+			if (area == 0.0f)
+			{
+				continue;
+			}
+			else if (area < 0.0f)
+			{
+				std::swap(triangle.x[1], triangle.x[2]);
+				std::swap(triangle.y[1], triangle.y[2]);
+				std::swap(triangle.z[1], triangle.z[2]);
+			}
+
+			triangles.push_back(triangle);
+		}
+	}
+
+	void rasterize_triangles(
+		Depth_buffer_view const depth_buffer,
+		gsl::span<Screen_triangle const> const triangles,
+		std::size_t const first_row,
+		std::size_t const last_row
+	)
+	{
+#if defined(MAIA_GAMEENGINE_RASTERIZER_SSE)
+		assert(depth_buffer.width % 4 == 0);
+		assert(last_row <= depth_buffer.height);
+
+		__m128 const lane_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+		__m128 const zero = _mm_setzero_ps();
+
+		for (Screen_triangle const& triangle : triangles)
+		{
+			Triangle_setup triangle_setup;
+
+			if (!setup(triangle, depth_buffer.width, first_row, last_row, triangle_setup))
+			{
+				continue;
+			}
+
+			Plane_equation const& edge_0 = triangle_setup.edges[0];
+			Plane_equation const& edge_1 = triangle_setup.edges[1];
+			Plane_equation const& edge_2 = triangle_setup.edges[2];
+			Plane_equation const& depth = triangle_setup.depth;
+
+			__m128 const edge_0_a = _mm_set1_ps(edge_0.a);
+			__m128 const edge_1_a = _mm_set1_ps(edge_1.a);
+			__m128 const edge_2_a = _mm_set1_ps(edge_2.a);
+			__m128 const depth_a = _mm_set1_ps(depth.a);
+
+			// Lanes that fall outside of the bounding box are still inside of the row and are rejected by the edge tests
+			std::size_t const first_x = triangle_setup.min_x & ~std::size_t{ 3 };
+
+			for (std::size_t y = triangle_setup.min_y; y <= triangle_setup.max_y; ++y)
+			{
+				float const pixel_y = static_cast<float>(y) + 0.5f;
+
+				__m128 const edge_0_row = _mm_set1_ps(edge_0.b * pixel_y + edge_0.c);
+				__m128 const edge_1_row = _mm_set1_ps(edge_1.b * pixel_y + edge_1.c);
+				__m128 const edge_2_row = _mm_set1_ps(edge_2.b * pixel_y + edge_2.c);
+				__m128 const depth_row = _mm_set1_ps(depth.b * pixel_y + depth.c);
+
+				float* const row = depth_buffer.depths + y * depth_buffer.width;
+
+				for (std::size_t x = first_x; x <= triangle_setup.max_x; x += 4)
+				{
+					__m128 const pixel_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane_offsets);
+
+					__m128 const inside = _mm_and_ps(
+						_mm_and_ps(
+							_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_0_a, pixel_x), edge_0_row), zero),
+							_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_1_a, pixel_x), edge_1_row), zero)
+						),
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_2_a, pixel_x), edge_2_row), zero)
+					);
+
+					__m128 const triangle_depth = _mm_add_ps(_mm_mul_ps(depth_a, pixel_x), depth_row);
+					__m128 const current_depth = _mm_loadu_ps(row + x);
+					__m128 const nearest_depth = _mm_min_ps(current_depth, triangle_depth);
+
+					_mm_storeu_ps(
+						row + x,
+						_mm_or_ps(_mm_and_ps(inside, nearest_depth), _mm_andnot_ps(inside, current_depth))
+					);
+				}
+			}
+		}
+#else
+		rasterize_triangles_scalar(depth_buffer, triangles, first_row, last_row);
+#endif
+	}
+
+	void rasterize_triangles_scalar(
+		Depth_buffer_view const depth_buffer,
+		gsl::span<Screen_triangle const> const triangles,
+		std::size_t const first_row,
+		std::size_t const last_row
+	)
+	{
+		assert(last_row <= depth_buffer.height);
+
+		for (Screen_triangle const& triangle : triangles)
+		{
+			Triangle_setup triangle_setup;
+
+			if (!setup(triangle, depth_buffer.width, first_row, last_row, triangle_setup))
+			{
+				continue;
+			}
+
+			for (std::size_t y = triangle_setup.min_y; y <= triangle_setup.max_y; ++y)
+			{
+				float const pixel_y = static_cast<float>(y) + 0.5f;
+
+				for (std::size_t x = triangle_setup.min_x; x <= triangle_setup.max_x; ++x)
+				{
+					float const pixel_x = static_cast<float>(x) + 0.5f;
+
+					bool const inside = std::all_of(triangle_setup.edges.begin(), triangle_setup.edges.end(), [pixel_x, pixel_y](Plane_equation const& edge) -> bool
+					{
+						return edge.a * pixel_x + (edge.b * pixel_y + edge.c) >= 0.0f;
+					});
+
+					if (inside)
+					{
+						float const triangle_depth = triangle_setup.depth.a * pixel_x + (triangle_setup.depth.b * pixel_y + triangle_setup.depth.c);
+						float& depth = depth_buffer.depths[y * depth_buffer.width + x];
+
+						depth = std::min(depth, triangle_depth);
+					}
+				}
+			}
+		}
+	}
+}
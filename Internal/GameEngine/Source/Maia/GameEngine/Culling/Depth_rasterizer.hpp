@@ -0,0 +1,60 @@
+#ifndef MAIA_GAMEENGINE_CULLING_DEPTHRASTERIZER_H_INCLUDED
+#define MAIA_GAMEENGINE_CULLING_DEPTHRASTERIZER_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+namespace Maia::GameEngine::Culling
+{
+	// Row major depth values, where 0 is the near plane and 1 the far plane.
+	// width must be a multiple of 4, so that rows can be processed 4 pixels at a time.
+	struct Depth_buffer_view
+	{
+		float* depths;
+		std::size_t width;
+		std::size_t height;
+	};
+
+	// Triangle in pixel coordinates, with y pointing down, and counter-clockwise in that space.
+	struct Screen_triangle
+	{
+		std::array<float, 3> x;
+		std::array<float, 3> y;
+		std::array<float, 3> z;
+	};
+
+	// Transforms the triangles given by indices into screen space and appends them to triangles.
+	// Triangles with a vertex in front of the near plane and degenerate triangles are discarded, which is
+	// conservative since it can only make the depth buffer farther.
+	void setup_triangles(
+		gsl::span<Eigen::Vector3f const> vertices,
+		gsl::span<std::uint32_t const> indices,
+		Eigen::Matrix4f const& view_projection,
+		std::size_t width,
+		std::size_t height,
+		std::vector<Screen_triangle>& triangles
+	);
+
+	// Keeps the nearest depth of the triangles at every pixel center, only touching the rows in [first_row, last_row).
+	// Different row ranges can be rasterized concurrently.
+	void rasterize_triangles(
+		Depth_buffer_view depth_buffer,
+		gsl::span<Screen_triangle const> triangles,
+		std::size_t first_row,
+		std::size_t last_row
+	);
+
+	void rasterize_triangles_scalar(
+		Depth_buffer_view depth_buffer,
+		gsl::span<Screen_triangle const> triangles,
+		std::size_t first_row,
+		std::size_t last_row
+	);
+}
+
+#endif
@@ -0,0 +1,371 @@
+#include "Frustum_culling.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <Maia/GameEngine/Components/Lod_level.hpp>
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+
+namespace Maia::GameEngine::Culling
+{
+	using Components::Lod_level;
+	using Components::World_bounds;
+	using Systems::Transform_matrix;
+
+
+	Culling_planes create_culling_planes(Spatial::Frustum const& frustum)
+	{
+		Culling_planes planes;
+
+		for (std::size_t plane_index = 0; plane_index < frustum.planes.size(); ++plane_index)
+		{
+			Spatial::Plane const& plane = frustum.planes[plane_index];
+
+			planes.normal_x[plane_index] = plane(0);
+			planes.normal_y[plane_index] = plane(1);
+			planes.normal_z[plane_index] = plane(2);
+			planes.distance[plane_index] = plane(3);
+		}
+
+		return planes;
+	}
+
+	gsl::span<Transform_matrix const> get_visible_transform_matrices(
+		Visible_instances const& visible_instances,
+		std::size_t const entity_type_index
+	)
+	{
+		return
+		{
+			visible_instances.transform_matrices[entity_type_index].data(),
+			static_cast<std::ptrdiff_t>(visible_instances.counts[entity_type_index])
+		};
+	}
+
+	gsl::span<Transform_matrix const> get_visible_transform_matrices(
+		Visible_instances const& visible_instances,
+		std::size_t const entity_type_index,
+		std::size_t const lod_level
+	)
+	{
+		std::array<std::size_t, Lod::max_num_lod_levels> const& lod_counts = visible_instances.lod_counts[entity_type_index];
+		std::size_t const first = std::accumulate(lod_counts.begin(), lod_counts.begin() + lod_level, std::size_t{ 0 });
+
+		return
+		{
+			visible_instances.transform_matrices[entity_type_index].data() + first,
+			static_cast<std::ptrdiff_t>(lod_counts[lod_level])
+		};
+	}
+
+
+	gsl::span<Entity const> get_visible_entities(
+		Visible_instances const& visible_instances,
+		std::size_t const entity_type_index,
+		std::size_t const lod_level
+	)
+	{
+		std::array<std::size_t, Lod::max_num_lod_levels> const& lod_counts = visible_instances.lod_counts[entity_type_index];
+		std::size_t const first = std::accumulate(lod_counts.begin(), lod_counts.begin() + lod_level, std::size_t{ 0 });
+
+		return
+		{
+			visible_instances.entities[entity_type_index].data() + first,
+			static_cast<std::ptrdiff_t>(lod_counts[lod_level])
+		};
+	}
+
+
+	Frustum_culling_system::Frustum_culling_system(Maia::Utilities::Worker_threads& worker_threads) :
+		m_worker_threads{ worker_threads },
+		m_scratches(m_worker_threads.num_threads()),
+		m_work_items{},
+		m_first_work_items{},
+		m_sorted_transform_matrices{},
+		m_sorted_entities{}
+	{
+	}
+
+	void Frustum_culling_system::execute(
+		Entity_manager const& entity_manager,
+		gsl::span<Entity_type_id const> const entity_type_ids,
+		Spatial::Frustum const& frustum,
+		Visible_instances& visible_instances
+	)
+	{
+		execute(entity_manager, entity_type_ids, frustum, nullptr, visible_instances);
+	}
+
+	void Frustum_culling_system::execute(
+		Entity_manager const& entity_manager,
+		gsl::span<Entity_type_id const> const entity_type_ids,
+		Spatial::Frustum const& frustum,
+		Occlusion_buffer const& occlusion_buffer,
+		Visible_instances& visible_instances
+	)
+	{
+		execute(entity_manager, entity_type_ids, frustum, &occlusion_buffer, visible_instances);
+	}
+
+	void Frustum_culling_system::execute(
+		Entity_manager const& entity_manager,
+		gsl::span<Entity_type_id const> const entity_type_ids,
+		Spatial::Frustum const& frustum,
+		Occlusion_buffer const* const occlusion_buffer,
+		Visible_instances& visible_instances
+	)
+	{
+		Culling_planes const planes = create_culling_planes(frustum);
+
+		visible_instances.transform_matrices.resize(entity_type_ids.size());
+		visible_instances.entities.resize(entity_type_ids.size());
+		visible_instances.counts.assign(entity_type_ids.size(), 0);
+		visible_instances.lod_counts.assign(entity_type_ids.size(), {});
+
+		// Each chunk writes its visible instances at chunk_index * capacity_per_chunk, so that chunks can be processed
+		// independently. They are compacted afterwards.
+		m_work_items.clear();
+		m_first_work_items.clear();
+
+		for (std::ptrdiff_t entity_type_index = 0; entity_type_index < entity_type_ids.size(); ++entity_type_index)
+		{
+			m_first_work_items.push_back(m_work_items.size());
+
+			Component_group const& component_group = entity_manager.get_component_group(entity_type_ids[entity_type_index]);
+
+			std::vector<Transform_matrix>& transform_matrices = visible_instances.transform_matrices[entity_type_index];
+			std::size_t const required_size = component_group.num_chunks() * component_group.capacity_per_chunk();
+
+			if (transform_matrices.size() < required_size)
+			{
+				transform_matrices.resize(required_size);
+				visible_instances.entities[entity_type_index].resize(required_size);
+			}
+
+			for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+			{
+				if (component_group.components<Entity>(chunk_index).size() > 0)
+				{
+					m_work_items.push_back({ static_cast<std::size_t>(entity_type_index), chunk_index, 0, {} });
+				}
+			}
+		}
+
+		m_first_work_items.push_back(m_work_items.size());
+
+		{
+			std::size_t const num_tasks = std::min(m_worker_threads.num_threads(), m_work_items.size());
+
+			m_worker_threads.run(num_tasks, [&](std::size_t const task_index) -> void
+			{
+				std::size_t const first = m_work_items.size() * task_index / num_tasks;
+				std::size_t const last = m_work_items.size() * (task_index + 1) / num_tasks;
+
+				for (std::size_t work_item_index = first; work_item_index < last; ++work_item_index)
+				{
+					process(entity_manager, entity_type_ids, planes, occlusion_buffer, visible_instances, m_work_items[work_item_index], m_scratches[task_index]);
+				}
+			});
+		}
+
+		for (std::ptrdiff_t entity_type_index = 0; entity_type_index < entity_type_ids.size(); ++entity_type_index)
+		{
+			Entity_type_id const entity_type_id = entity_type_ids[entity_type_index];
+			Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
+
+			gsl::span<Work_item const> const work_items
+			{
+				m_work_items.data() + m_first_work_items[entity_type_index],
+				static_cast<std::ptrdiff_t>(m_first_work_items[entity_type_index + 1] - m_first_work_items[entity_type_index])
+			};
+
+			std::vector<Transform_matrix>& transform_matrices = visible_instances.transform_matrices[entity_type_index];
+			std::vector<Entity>& entities = visible_instances.entities[entity_type_index];
+			std::size_t& count = visible_instances.counts[entity_type_index];
+
+			if (!entity_manager.get_component_types_groups()[entity_type_id.value].contains<Lod_level>())
+			{
+				for (Work_item const& work_item : work_items)
+				{
+					std::size_t const source = work_item.chunk_index * component_group.capacity_per_chunk();
+
+					if (source != count)
+					{
+						std::copy(transform_matrices.begin() + source, transform_matrices.begin() + source + work_item.num_visible, transform_matrices.begin() + count);
+						std::copy(entities.begin() + source, entities.begin() + source + work_item.num_visible, entities.begin() + count);
+					}
+
+					count += work_item.num_visible;
+				}
+
+				visible_instances.lod_counts[entity_type_index][0] = count;
+			}
+			else
+			{
+				// Each chunk is sorted by level, so the levels of all chunks are gathered one after the other
+				m_sorted_transform_matrices.clear();
+				m_sorted_entities.clear();
+
+				for (std::size_t lod_level = 0; lod_level < Lod::max_num_lod_levels; ++lod_level)
+				{
+					for (Work_item const& work_item : work_items)
+					{
+						std::size_t const first_of_level = std::accumulate(work_item.lod_counts.begin(), work_item.lod_counts.begin() + lod_level, std::size_t{ 0 });
+						std::size_t const source = work_item.chunk_index * component_group.capacity_per_chunk() + first_of_level;
+						std::size_t const num_of_level = work_item.lod_counts[lod_level];
+
+						m_sorted_transform_matrices.insert(m_sorted_transform_matrices.end(), transform_matrices.begin() + source, transform_matrices.begin() + source + num_of_level);
+						m_sorted_entities.insert(m_sorted_entities.end(), entities.begin() + source, entities.begin() + source + num_of_level);
+					}
+
+					visible_instances.lod_counts[entity_type_index][lod_level] = m_sorted_transform_matrices.size() - count;
+					count = m_sorted_transform_matrices.size();
+				}
+
+				std::copy(m_sorted_transform_matrices.begin(), m_sorted_transform_matrices.end(), transform_matrices.begin());
+				std::copy(m_sorted_entities.begin(), m_sorted_entities.end(), entities.begin());
+			}
+		}
+	}
+
+	void Frustum_culling_system::process(
+		Entity_manager const& entity_manager,
+		gsl::span<Entity_type_id const> const entity_type_ids,
+		Culling_planes const& planes,
+		Occlusion_buffer const* const occlusion_buffer,
+		Visible_instances& visible_instances,
+		Work_item& work_item,
+		Scratch& scratch
+	) const
+	{
+		Entity_type_id const entity_type_id = entity_type_ids[work_item.entity_type_index];
+		Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
+		Component_group_mask const component_group_mask = entity_manager.get_component_types_groups()[entity_type_id.value];
+
+		gsl::span<Transform_matrix const> const transform_matrices = component_group.components<Transform_matrix>(work_item.chunk_index);
+
+		std::size_t const output_offset = work_item.chunk_index * component_group.capacity_per_chunk();
+		auto const output = visible_instances.transform_matrices[work_item.entity_type_index].begin() + output_offset;
+		auto const output_entities = visible_instances.entities[work_item.entity_type_index].begin() + output_offset;
+
+		if (!component_group_mask.contains<World_bounds>())
+		{
+			if (!component_group_mask.contains<Lod_level>())
+			{
+				gsl::span<Entity const> const entities = component_group.components<Entity>(work_item.chunk_index);
+
+				std::copy(transform_matrices.begin(), transform_matrices.end(), output);
+				std::copy(entities.begin(), entities.end(), output_entities);
+				work_item.num_visible = static_cast<std::size_t>(transform_matrices.size());
+				return;
+			}
+
+			scratch.visible_indices.resize(static_cast<std::size_t>(transform_matrices.size()));
+			std::iota(scratch.visible_indices.begin(), scratch.visible_indices.end(), std::uint32_t{ 0 });
+
+			write_visible_instances(component_group, component_group_mask, scratch.visible_indices.size(), work_item, scratch, output, output_entities);
+			return;
+		}
+
+		gsl::span<World_bounds const> const world_bounds = component_group.components<World_bounds>(work_item.chunk_index);
+		std::size_t const count = static_cast<std::size_t>(world_bounds.size());
+
+		scratch.center_x.resize(count);
+		scratch.center_y.resize(count);
+		scratch.center_z.resize(count);
+		scratch.extents_x.resize(count);
+		scratch.extents_y.resize(count);
+		scratch.extents_z.resize(count);
+		scratch.visible_indices.resize(count);
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			Spatial::Aabb const& aabb = world_bounds[index].value;
+
+			scratch.center_x[index] = 0.5f * (aabb.minimum(0) + aabb.maximum(0));
+			scratch.center_y[index] = 0.5f * (aabb.minimum(1) + aabb.maximum(1));
+			scratch.center_z[index] = 0.5f * (aabb.minimum(2) + aabb.maximum(2));
+			scratch.extents_x[index] = 0.5f * (aabb.maximum(0) - aabb.minimum(0));
+			scratch.extents_y[index] = 0.5f * (aabb.maximum(1) - aabb.minimum(1));
+			scratch.extents_z[index] = 0.5f * (aabb.maximum(2) - aabb.minimum(2));
+		}
+
+		Aabbs_view const aabbs
+		{
+			scratch.center_x.data(), scratch.center_y.data(), scratch.center_z.data(),
+			scratch.extents_x.data(), scratch.extents_y.data(), scratch.extents_z.data()
+		};
+
+		std::size_t num_visible = cull_aabbs(planes, aabbs, count, scratch.visible_indices.data());
+
+		if (occlusion_buffer != nullptr)
+		{
+			auto const visible_indices_end = std::remove_if(
+				scratch.visible_indices.begin(), scratch.visible_indices.begin() + num_visible,
+				[occlusion_buffer, &world_bounds](std::uint32_t const index) -> bool
+				{
+					return occlusion_buffer->is_occluded(world_bounds[index].value);
+				}
+			);
+
+			num_visible = static_cast<std::size_t>(std::distance(scratch.visible_indices.begin(), visible_indices_end));
+		}
+
+		write_visible_instances(component_group, component_group_mask, num_visible, work_item, scratch, output, output_entities);
+	}
+
+	void Frustum_culling_system::write_visible_instances(
+		Component_group const& component_group,
+		Component_group_mask const component_group_mask,
+		std::size_t const num_visible,
+		Work_item& work_item,
+		Scratch const& scratch,
+		std::vector<Transform_matrix>::iterator const output,
+		std::vector<Entity>::iterator const output_entities
+	)
+	{
+		gsl::span<Transform_matrix const> const transform_matrices = component_group.components<Transform_matrix>(work_item.chunk_index);
+		gsl::span<Entity const> const entities = component_group.components<Entity>(work_item.chunk_index);
+
+		work_item.num_visible = num_visible;
+
+		if (!component_group_mask.contains<Lod_level>())
+		{
+			for (std::size_t index = 0; index < num_visible; ++index)
+			{
+				output[index] = transform_matrices[scratch.visible_indices[index]];
+				output_entities[index] = entities[scratch.visible_indices[index]];
+			}
+
+			return;
+		}
+
+		// Counting sort by level
+		gsl::span<Lod_level const> const lod_levels = component_group.components<Lod_level>(work_item.chunk_index);
+
+		auto const get_lod_level = [&lod_levels](std::uint32_t const index) -> std::size_t
+		{
+			return std::min<std::size_t>(lod_levels[index].value, Lod::max_num_lod_levels - 1);
+		};
+
+		work_item.lod_counts = {};
+
+		for (std::size_t index = 0; index < num_visible; ++index)
+		{
+			++work_item.lod_counts[get_lod_level(scratch.visible_indices[index])];
+		}
+
+		std::array<std::size_t, Lod::max_num_lod_levels> offsets;
+		std::partial_sum(work_item.lod_counts.begin(), work_item.lod_counts.end() - 1, offsets.begin() + 1);
+		offsets[0] = 0;
+
+		for (std::size_t index = 0; index < num_visible; ++index)
+		{
+			std::uint32_t const visible_index = scratch.visible_indices[index];
+			std::size_t const output_index = offsets[get_lod_level(visible_index)]++;
+
+			output[output_index] = transform_matrices[visible_index];
+			output_entities[output_index] = entities[visible_index];
+		}
+	}
+}
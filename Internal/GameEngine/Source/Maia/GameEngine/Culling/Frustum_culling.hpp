@@ -0,0 +1,146 @@
+#ifndef MAIA_GAMEENGINE_CULLING_FRUSTUMCULLING_H_INCLUDED
+#define MAIA_GAMEENGINE_CULLING_FRUSTUMCULLING_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Entity_type.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling_kernel.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/GameEngine/Lod/Lod_selection.hpp>
+#include <Maia/GameEngine/Spatial/Frustum.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+namespace Maia::GameEngine::Culling
+{
+	Culling_planes create_culling_planes(Spatial::Frustum const& frustum);
+
+
+	// Indexed like the entity types given to Frustum_culling_system::execute.
+	// Only the first counts[i] elements of transform_matrices[i] are valid, so that the storage is reused between frames.
+	// They are sorted by Lod_level and lod_counts[i][j] of them have level j. Entity types without Lod_level only use level 0.
+	// entities[i] is parallel to transform_matrices[i].
+	struct Visible_instances
+	{
+		std::vector<std::vector<Systems::Transform_matrix>> transform_matrices;
+		std::vector<std::vector<Entity>> entities;
+		std::vector<std::size_t> counts;
+		std::vector<std::array<std::size_t, Lod::max_num_lod_levels>> lod_counts;
+	};
+
+	gsl::span<Systems::Transform_matrix const> get_visible_transform_matrices(
+		Visible_instances const& visible_instances,
+		std::size_t entity_type_index
+	);
+
+	gsl::span<Systems::Transform_matrix const> get_visible_transform_matrices(
+		Visible_instances const& visible_instances,
+		std::size_t entity_type_index,
+		std::size_t lod_level
+	);
+
+	gsl::span<Entity const> get_visible_entities(
+		Visible_instances const& visible_instances,
+		std::size_t entity_type_index,
+		std::size_t lod_level
+	);
+
+
+	// Tests the World_bounds of every entity of the given entity types against a frustum and writes the
+	// Transform_matrix of the visible ones to compacted per entity type arrays.
+	// Entity types without World_bounds are considered visible.
+	// The instances of entity types with Lod_level are grouped by level, see Visible_instances.
+	// Chunks are distributed between the threads of worker_threads, including the calling one.
+	class Frustum_culling_system
+	{
+	public:
+
+		explicit Frustum_culling_system(Maia::Utilities::Worker_threads& worker_threads);
+
+
+		void execute(
+			Entity_manager const& entity_manager,
+			gsl::span<Entity_type_id const> entity_type_ids,
+			Spatial::Frustum const& frustum,
+			Visible_instances& visible_instances
+		);
+
+		// Also discards the instances whose World_bounds are hidden by the occluders of occlusion_buffer.
+		void execute(
+			Entity_manager const& entity_manager,
+			gsl::span<Entity_type_id const> entity_type_ids,
+			Spatial::Frustum const& frustum,
+			Occlusion_buffer const& occlusion_buffer,
+			Visible_instances& visible_instances
+		);
+
+
+	private:
+
+		struct Work_item
+		{
+			std::size_t entity_type_index;
+			std::size_t chunk_index;
+			std::size_t num_visible;
+			std::array<std::size_t, Lod::max_num_lod_levels> lod_counts;
+		};
+
+		struct Scratch
+		{
+			std::vector<float> center_x;
+			std::vector<float> center_y;
+			std::vector<float> center_z;
+			std::vector<float> extents_x;
+			std::vector<float> extents_y;
+			std::vector<float> extents_z;
+			std::vector<std::uint32_t> visible_indices;
+		};
+
+
+		void execute(
+			Entity_manager const& entity_manager,
+			gsl::span<Entity_type_id const> entity_type_ids,
+			Spatial::Frustum const& frustum,
+			Occlusion_buffer const* occlusion_buffer,
+			Visible_instances& visible_instances
+		);
+
+		void process(
+			Entity_manager const& entity_manager,
+			gsl::span<Entity_type_id const> entity_type_ids,
+			Culling_planes const& planes,
+			Occlusion_buffer const* occlusion_buffer,
+			Visible_instances& visible_instances,
+			Work_item& work_item,
+			Scratch& scratch
+		) const;
+
+		// Writes the first num_visible instances of scratch.visible_indices to output and output_entities.
+		static void write_visible_instances(
+			Component_group const& component_group,
+			Component_group_mask component_group_mask,
+			std::size_t num_visible,
+			Work_item& work_item,
+			Scratch const& scratch,
+			std::vector<Systems::Transform_matrix>::iterator output,
+			std::vector<Entity>::iterator output_entities
+		);
+
+
+		Maia::Utilities::Worker_threads& m_worker_threads;
+		std::vector<Scratch> m_scratches;
+		std::vector<Work_item> m_work_items;
+		std::vector<std::size_t> m_first_work_items;
+		std::vector<Systems::Transform_matrix> m_sorted_transform_matrices;
+		std::vector<Entity> m_sorted_entities;
+
+	};
+}
+
+#endif
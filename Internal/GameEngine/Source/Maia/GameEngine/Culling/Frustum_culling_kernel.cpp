@@ -0,0 +1,220 @@
+#include "Frustum_culling_kernel.hpp"
+#include "Frustum_culling_kernel_avx.hpp"
+
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAIA_GAMEENGINE_CULLING_SSE
+#include <emmintrin.h>
+#endif
+
+#if defined(MAIA_GAMEENGINE_CULLING_AVX) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Maia::GameEngine::Culling
+{
+	namespace
+	{
+		std::size_t cull_aabbs_scalar(
+			Culling_planes const& planes,
+			Aabbs_view const& aabbs,
+			std::size_t const first,
+			std::size_t const count,
+			std::uint32_t* const visible_indices,
+			std::size_t num_visible
+		)
+		{
+			for (std::size_t index = first; index < count; ++index)
+			{
+				bool visible = true;
+
+				for (std::size_t plane_index = 0; plane_index < 6; ++plane_index)
+				{
+					float const distance =
+						planes.normal_x[plane_index] * aabbs.center_x[index] +
+						planes.normal_y[plane_index] * aabbs.center_y[index] +
+						planes.normal_z[plane_index] * aabbs.center_z[index] +
+						planes.distance[plane_index];
+
+					float const radius =
+						std::abs(planes.normal_x[plane_index]) * aabbs.extents_x[index] +
+						std::abs(planes.normal_y[plane_index]) * aabbs.extents_y[index] +
+						std::abs(planes.normal_z[plane_index]) * aabbs.extents_z[index];
+
+					visible = visible && (distance + radius >= 0.0f);
+				}
+
+				visible_indices[num_visible] = static_cast<std::uint32_t>(index);
+				num_visible += visible ? 1 : 0;
+			}
+
+			return num_visible;
+		}
+
+#if defined(MAIA_GAMEENGINE_CULLING_SSE)
+
+		// Culls the first count AABBs, where count is a multiple of 4.
+		std::size_t cull_aabb_blocks_sse(Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t const count, std::uint32_t* const visible_indices)
+		{
+			constexpr std::size_t width = 4;
+
+			std::size_t num_visible = 0;
+
+			for (std::size_t index = 0; index < count; index += width)
+			{
+				__m128 const center_x = _mm_loadu_ps(aabbs.center_x + index);
+				__m128 const center_y = _mm_loadu_ps(aabbs.center_y + index);
+				__m128 const center_z = _mm_loadu_ps(aabbs.center_z + index);
+				__m128 const extents_x = _mm_loadu_ps(aabbs.extents_x + index);
+				__m128 const extents_y = _mm_loadu_ps(aabbs.extents_y + index);
+				__m128 const extents_z = _mm_loadu_ps(aabbs.extents_z + index);
+
+				__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+				for (std::size_t plane_index = 0; plane_index < 6; ++plane_index)
+				{
+					__m128 const distance = _mm_add_ps(
+						_mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(planes.normal_x[plane_index]), center_x),
+							_mm_mul_ps(_mm_set1_ps(planes.normal_y[plane_index]), center_y)
+						),
+						_mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(planes.normal_z[plane_index]), center_z),
+							_mm_set1_ps(planes.distance[plane_index])
+						)
+					);
+
+					__m128 const radius = _mm_add_ps(
+						_mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(std::abs(planes.normal_x[plane_index])), extents_x),
+							_mm_mul_ps(_mm_set1_ps(std::abs(planes.normal_y[plane_index])), extents_y)
+						),
+						_mm_mul_ps(_mm_set1_ps(std::abs(planes.normal_z[plane_index])), extents_z)
+					);
+
+					visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+				}
+
+				int const mask = _mm_movemask_ps(visible);
+
+				for (std::size_t lane = 0; lane < width; ++lane)
+				{
+					visible_indices[num_visible] = static_cast<std::uint32_t>(index + lane);
+					num_visible += (mask >> lane) & 1;
+				}
+			}
+
+			return num_visible;
+		}
+
+#endif
+
+#if defined(MAIA_GAMEENGINE_CULLING_AVX)
+
+		// Also checks that the OS saves the AVX registers.
+		bool cpu_supports_avx()
+		{
+#if defined(_MSC_VER)
+			int cpu_info[4];
+			__cpuid(cpu_info, 1);
+
+			bool const has_avx = (cpu_info[2] & (1 << 28)) != 0;
+			bool const has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+
+			return has_avx && has_osxsave && (_xgetbv(0) & 0x6) == 0x6;
+#else
+			return __builtin_cpu_supports("avx");
+#endif
+		}
+
+#endif
+
+		Culling_instruction_set detect_culling_instruction_set()
+		{
+			if (is_supported(Culling_instruction_set::AVX))
+			{
+				return Culling_instruction_set::AVX;
+			}
+			else if (is_supported(Culling_instruction_set::SSE))
+			{
+				return Culling_instruction_set::SSE;
+			}
+			else
+			{
+				return Culling_instruction_set::Scalar;
+			}
+		}
+	}
+
+	bool is_supported(Culling_instruction_set const instruction_set)
+	{
+		switch (instruction_set)
+		{
+		case Culling_instruction_set::AVX:
+#if defined(MAIA_GAMEENGINE_CULLING_AVX)
+			return cpu_supports_avx();
+#else
+			return false;
+#endif
+
+		case Culling_instruction_set::SSE:
+#if defined(MAIA_GAMEENGINE_CULLING_SSE)
+			return true;
+#else
+			return false;
+#endif
+
+		default:
+			return true;
+		}
+	}
+
+	Culling_instruction_set get_culling_instruction_set()
+	{
+		static Culling_instruction_set const instruction_set = detect_culling_instruction_set();
+		return instruction_set;
+	}
+
+	std::size_t cull_aabbs_scalar(Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t const count, std::uint32_t* const visible_indices)
+	{
+		return cull_aabbs_scalar(planes, aabbs, 0, count, visible_indices, 0);
+	}
+
+	std::size_t cull_aabbs(Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t const count, std::uint32_t* const visible_indices)
+	{
+		return cull_aabbs(get_culling_instruction_set(), planes, aabbs, count, visible_indices);
+	}
+
+	std::size_t cull_aabbs(Culling_instruction_set const instruction_set, Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t const count, std::uint32_t* const visible_indices)
+	{
+		assert(is_supported(instruction_set));
+
+		// The kernels process blocks of their width and the remaining AABBs are culled by the scalar code
+		std::size_t num_blocked = 0;
+		std::size_t num_visible = 0;
+
+		switch (instruction_set)
+		{
+#if defined(MAIA_GAMEENGINE_CULLING_AVX)
+		case Culling_instruction_set::AVX:
+			num_blocked = count / 8 * 8;
+			num_visible = cull_aabb_blocks_avx(planes.normal_x.data(), planes.normal_y.data(), planes.normal_z.data(), planes.distance.data(), aabbs, num_blocked, visible_indices);
+			break;
+#endif
+
+#if defined(MAIA_GAMEENGINE_CULLING_SSE)
+		case Culling_instruction_set::SSE:
+			num_blocked = count / 4 * 4;
+			num_visible = cull_aabb_blocks_sse(planes, aabbs, num_blocked, visible_indices);
+			break;
+#endif
+
+		default:
+			break;
+		}
+
+		return cull_aabbs_scalar(planes, aabbs, num_blocked, count, visible_indices, num_visible);
+	}
+}
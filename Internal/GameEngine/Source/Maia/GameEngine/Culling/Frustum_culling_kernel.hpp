@@ -0,0 +1,53 @@
+#ifndef MAIA_GAMEENGINE_CULLING_FRUSTUMCULLINGKERNEL_H_INCLUDED
+#define MAIA_GAMEENGINE_CULLING_FRUSTUMCULLINGKERNEL_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Maia::GameEngine::Culling
+{
+	// Frustum planes in structure of arrays layout. Points with normal . point + distance >= 0 are inside.
+	struct Culling_planes
+	{
+		std::array<float, 6> normal_x;
+		std::array<float, 6> normal_y;
+		std::array<float, 6> normal_z;
+		std::array<float, 6> distance;
+	};
+
+	// AABBs in structure of arrays layout, given by their centers and half extents.
+	struct Aabbs_view
+	{
+		float const* center_x;
+		float const* center_y;
+		float const* center_z;
+		float const* extents_x;
+		float const* extents_y;
+		float const* extents_z;
+	};
+
+	enum class Culling_instruction_set
+	{
+		Scalar,
+		SSE,
+		AVX
+	};
+
+	// Whether the kernel of instruction_set was compiled in and the CPU supports it.
+	bool is_supported(Culling_instruction_set instruction_set);
+
+	// Widest supported instruction set, detected at runtime, which cull_aabbs uses.
+	Culling_instruction_set get_culling_instruction_set();
+
+	// Writes the indices of the AABBs that are not completely outside of the planes to visible_indices,
+	// which must be able to hold count elements, and returns the number of visible AABBs.
+	std::size_t cull_aabbs(Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t count, std::uint32_t* visible_indices);
+
+	// Same as cull_aabbs with a given instruction_set, which must be supported.
+	std::size_t cull_aabbs(Culling_instruction_set instruction_set, Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t count, std::uint32_t* visible_indices);
+
+	std::size_t cull_aabbs_scalar(Culling_planes const& planes, Aabbs_view const& aabbs, std::size_t count, std::uint32_t* visible_indices);
+}
+
+#endif
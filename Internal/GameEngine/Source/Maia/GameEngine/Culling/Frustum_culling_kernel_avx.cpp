@@ -0,0 +1,77 @@
+#include "Frustum_culling_kernel_avx.hpp"
+
+#if defined(MAIA_GAMEENGINE_CULLING_AVX)
+
+#include <immintrin.h>
+
+namespace Maia::GameEngine::Culling
+{
+	std::size_t cull_aabb_blocks_avx(
+		float const* const normal_x,
+		float const* const normal_y,
+		float const* const normal_z,
+		float const* const distance,
+		Aabbs_view const& aabbs,
+		std::size_t const count,
+		std::uint32_t* const visible_indices
+	)
+	{
+		constexpr std::size_t width = 8;
+
+		__m256 const sign_mask = _mm256_set1_ps(-0.0f);
+
+		std::size_t num_visible = 0;
+
+		for (std::size_t index = 0; index < count; index += width)
+		{
+			__m256 const center_x = _mm256_loadu_ps(aabbs.center_x + index);
+			__m256 const center_y = _mm256_loadu_ps(aabbs.center_y + index);
+			__m256 const center_z = _mm256_loadu_ps(aabbs.center_z + index);
+			__m256 const extents_x = _mm256_loadu_ps(aabbs.extents_x + index);
+			__m256 const extents_y = _mm256_loadu_ps(aabbs.extents_y + index);
+			__m256 const extents_z = _mm256_loadu_ps(aabbs.extents_z + index);
+
+			__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+			for (std::size_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				__m256 const plane_normal_x = _mm256_set1_ps(normal_x[plane_index]);
+				__m256 const plane_normal_y = _mm256_set1_ps(normal_y[plane_index]);
+				__m256 const plane_normal_z = _mm256_set1_ps(normal_z[plane_index]);
+
+				__m256 const plane_distance = _mm256_add_ps(
+					_mm256_add_ps(
+						_mm256_mul_ps(plane_normal_x, center_x),
+						_mm256_mul_ps(plane_normal_y, center_y)
+					),
+					_mm256_add_ps(
+						_mm256_mul_ps(plane_normal_z, center_z),
+						_mm256_set1_ps(distance[plane_index])
+					)
+				);
+
+				__m256 const radius = _mm256_add_ps(
+					_mm256_add_ps(
+						_mm256_mul_ps(_mm256_andnot_ps(sign_mask, plane_normal_x), extents_x),
+						_mm256_mul_ps(_mm256_andnot_ps(sign_mask, plane_normal_y), extents_y)
+					),
+					_mm256_mul_ps(_mm256_andnot_ps(sign_mask, plane_normal_z), extents_z)
+				);
+
+				visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(plane_distance, radius), _mm256_setzero_ps(), _CMP_GE_OQ));
+			}
+
+			int const mask = _mm256_movemask_ps(visible);
+
+			for (std::size_t lane = 0; lane < width; ++lane)
+			{
+				visible_indices[num_visible] = static_cast<std::uint32_t>(index + lane);
+				num_visible += (mask >> lane) & 1;
+			}
+		}
+
+		return num_visible;
+	}
+}
+
+#endif
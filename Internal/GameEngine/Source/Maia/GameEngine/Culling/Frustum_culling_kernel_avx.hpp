@@ -0,0 +1,27 @@
+#ifndef MAIA_GAMEENGINE_CULLING_FRUSTUMCULLINGKERNELAVX_H_INCLUDED
+#define MAIA_GAMEENGINE_CULLING_FRUSTUMCULLINGKERNELAVX_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Maia/GameEngine/Culling/Frustum_culling_kernel.hpp>
+
+namespace Maia::GameEngine::Culling
+{
+	// Culls the first count AABBs, where count is a multiple of 8, against the 6 planes given in structure of arrays
+	// layout, and returns the number of visible AABBs.
+	// It is compiled with AVX in its own translation unit and must only be called if the CPU supports AVX. That
+	// translation unit must not use inline functions, such as those of std::array, because the linker could pick
+	// their AVX version for the rest of the program.
+	std::size_t cull_aabb_blocks_avx(
+		float const* normal_x,
+		float const* normal_y,
+		float const* normal_z,
+		float const* distance,
+		Aabbs_view const& aabbs,
+		std::size_t count,
+		std::uint32_t* visible_indices
+	);
+}
+
+#endif
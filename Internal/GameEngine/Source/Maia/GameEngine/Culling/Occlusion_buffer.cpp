@@ -0,0 +1,193 @@
+#include "Occlusion_buffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Maia::GameEngine::Culling
+{
+	namespace
+	{
+		constexpr float minimum_w = 1e-5f;
+	}
+
+	Occlusion_buffer::Occlusion_buffer(std::size_t const width, std::size_t const height, Maia::Utilities::Worker_threads& worker_threads) :
+		m_worker_threads{ worker_threads },
+		m_view_projection{ Eigen::Matrix4f::Identity() },
+		m_levels{},
+		m_triangles{}
+	{
+		assert(width > 0 && height > 0);
+
+		std::size_t level_width = (width + 3) & ~std::size_t{ 3 };
+		std::size_t level_height = height;
+
+		while (true)
+		{
+			m_levels.push_back({ level_width, level_height, std::vector<float>(level_width * level_height, 1.0f) });
+
+			if (level_width == 1 && level_height == 1)
+			{
+				break;
+			}
+
+			level_width = (level_width + 1) / 2;
+			level_height = (level_height + 1) / 2;
+		}
+	}
+
+
+	void Occlusion_buffer::render(gsl::span<Occluder const> const occluders, Eigen::Matrix4f const& view_projection)
+	{
+		m_view_projection = view_projection;
+
+		Level& depth_buffer = m_levels.front();
+		std::fill(depth_buffer.depths.begin(), depth_buffer.depths.end(), 1.0f);
+
+		m_triangles.clear();
+
+		for (Occluder const& occluder : occluders)
+		{
+			setup_triangles(occluder.vertices, occluder.indices, view_projection, depth_buffer.width, depth_buffer.height, m_triangles);
+		}
+
+		{
+			Depth_buffer_view const view{ depth_buffer.depths.data(), depth_buffer.width, depth_buffer.height };
+
+			std::size_t const num_bands = std::min(m_worker_threads.num_threads(), depth_buffer.height);
+
+			m_worker_threads.run(num_bands, [this, &view, num_bands](std::size_t const band_index) -> void
+			{
+				std::size_t const first_row = view.height * band_index / num_bands;
+				std::size_t const last_row = view.height * (band_index + 1) / num_bands;
+
+				rasterize_triangles(view, m_triangles, first_row, last_row);
+			});
+		}
+
+		build_pyramid();
+	}
+
+	bool Occlusion_buffer::is_occluded(Spatial::Aabb const& aabb) const
+	{
+		Eigen::Vector3f minimum_ndc{ Eigen::Vector3f::Constant(std::numeric_limits<float>::max()) };
+		Eigen::Vector3f maximum_ndc{ Eigen::Vector3f::Constant(std::numeric_limits<float>::lowest()) };
+
+		for (std::size_t corner_index = 0; corner_index < 8; ++corner_index)
+		{
+			Eigen::Vector4f const corner
+			{
+				(corner_index & 1) ? aabb.maximum(0) : aabb.minimum(0),
+				(corner_index & 2) ? aabb.maximum(1) : aabb.minimum(1),
+				(corner_index & 4) ? aabb.maximum(2) : aabb.minimum(2),
+				1.0f
+			};
+
+			Eigen::Vector4f const clip = m_view_projection * corner;
+
+			if (clip(3) <= minimum_w)
+			{
+				return false;
+			}
+
+			Eigen::Vector3f const ndc = clip.head<3>() / clip(3);
+
+			minimum_ndc = minimum_ndc.cwiseMin(ndc);
+			maximum_ndc = maximum_ndc.cwiseMax(ndc);
+		}
+
+		if (maximum_ndc(0) < -1.0f || minimum_ndc(0) > 1.0f || maximum_ndc(1) < -1.0f || minimum_ndc(1) > 1.0f || minimum_ndc(2) < 0.0f)
+		{
+			return false;
+		}
+
+		Level const& depth_buffer = m_levels.front();
+
+		float const width = static_cast<float>(depth_buffer.width);
+		float const height = static_cast<float>(depth_buffer.height);
+
+		// Pixels that the box touches, with y pointing down
+		std::size_t const min_x = static_cast<std::size_t>(std::max((minimum_ndc(0) + 1.0f) * 0.5f * width, 0.0f));
+		std::size_t const max_x = static_cast<std::size_t>(std::min((maximum_ndc(0) + 1.0f) * 0.5f * width, width - 1.0f));
+		std::size_t const min_y = static_cast<std::size_t>(std::max((1.0f - maximum_ndc(1)) * 0.5f * height, 0.0f));
+		std::size_t const max_y = static_cast<std::size_t>(std::min((1.0f - minimum_ndc(1)) * 0.5f * height, height - 1.0f));
+
+		// Coarsest level in which the rectangle spans at most 2x2 texels
+		std::size_t level_index = 0;
+		while (level_index + 1 < m_levels.size() && ((max_x >> level_index) - (min_x >> level_index) > 1 || (max_y >> level_index) - (min_y >> level_index) > 1))
+		{
+			++level_index;
+		}
+
+		Level const& level = m_levels[level_index];
+
+		float farthest_depth = 0.0f;
+
+		for (std::size_t y = min_y >> level_index; y <= (max_y >> level_index); ++y)
+		{
+			for (std::size_t x = min_x >> level_index; x <= (max_x >> level_index); ++x)
+			{
+				farthest_depth = std::max(farthest_depth, level.depths[y * level.width + x]);
+			}
+		}
+
+		return minimum_ndc(2) > farthest_depth;
+	}
+
+
+	std::size_t Occlusion_buffer::width() const
+	{
+		return m_levels.front().width;
+	}
+
+	std::size_t Occlusion_buffer::height() const
+	{
+		return m_levels.front().height;
+	}
+
+	std::size_t Occlusion_buffer::num_levels() const
+	{
+		return m_levels.size();
+	}
+
+	float Occlusion_buffer::get_depth(std::size_t const level, std::size_t const x, std::size_t const y) const
+	{
+		Level const& level_data = m_levels[level];
+		assert(x < level_data.width && y < level_data.height);
+
+		return level_data.depths[y * level_data.width + x];
+	}
+
+	std::size_t Occlusion_buffer::num_rasterized_triangles() const
+	{
+		return m_triangles.size();
+	}
+
+
+	void Occlusion_buffer::build_pyramid()
+	{
+		for (std::size_t level_index = 1; level_index < m_levels.size(); ++level_index)
+		{
+			Level const& source = m_levels[level_index - 1];
+			Level& destination = m_levels[level_index];
+
+			for (std::size_t y = 0; y < destination.height; ++y)
+			{
+				std::size_t const source_y_0 = 2 * y;
+				std::size_t const source_y_1 = std::min(2 * y + 1, source.height - 1);
+
+				for (std::size_t x = 0; x < destination.width; ++x)
+				{
+					std::size_t const source_x_0 = 2 * x;
+					std::size_t const source_x_1 = std::min(2 * x + 1, source.width - 1);
+
+					destination.depths[y * destination.width + x] = std::max(
+						std::max(source.depths[source_y_0 * source.width + source_x_0], source.depths[source_y_0 * source.width + source_x_1]),
+						std::max(source.depths[source_y_1 * source.width + source_x_0], source.depths[source_y_1 * source.width + source_x_1])
+					);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#ifndef MAIA_GAMEENGINE_CULLING_OCCLUSIONBUFFER_H_INCLUDED
+#define MAIA_GAMEENGINE_CULLING_OCCLUSIONBUFFER_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/GameEngine/Culling/Depth_rasterizer.hpp>
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+namespace Maia::GameEngine::Culling
+{
+	// Triangle list in world space. Occluders should be few, simple and fully inside the objects they represent.
+	struct Occluder
+	{
+		std::vector<Eigen::Vector3f> vertices;
+		std::vector<std::uint32_t> indices;
+	};
+
+
+	// Low resolution depth buffer of a set of occluders and its hierarchical-Z pyramid, where every texel of a
+	// level holds the farthest depth of the 2x2 texels below it.
+	class Occlusion_buffer
+	{
+	public:
+
+		// width is rounded up to a multiple of 4.
+		// Rows are split in a band per thread of worker_threads, which are rasterized concurrently, including by the calling thread.
+		Occlusion_buffer(std::size_t width, std::size_t height, Maia::Utilities::Worker_threads& worker_threads);
+
+
+		// Clears the buffer, rasterizes the occluders and builds the pyramid.
+		void render(gsl::span<Occluder const> occluders, Eigen::Matrix4f const& view_projection);
+
+		// Returns true if the box is completely behind the occluders rendered by the last call to render.
+		// Boxes that cross the near plane or that are outside of the screen are never occluded.
+		bool is_occluded(Spatial::Aabb const& aabb) const;
+
+
+		std::size_t width() const;
+
+		std::size_t height() const;
+
+		std::size_t num_levels() const;
+
+		float get_depth(std::size_t level, std::size_t x, std::size_t y) const;
+
+		std::size_t num_rasterized_triangles() const;
+
+
+	private:
+
+		struct Level
+		{
+			std::size_t width;
+			std::size_t height;
+			std::vector<float> depths;
+		};
+
+
+		void build_pyramid();
+
+
+		Maia::Utilities::Worker_threads& m_worker_threads;
+		Eigen::Matrix4f m_view_projection;
+		std::vector<Level> m_levels;
+		std::vector<Screen_triangle> m_triangles;
+
+	};
+}
+
+#endif
@@ -1,9 +1,17 @@
 #include "Entity_manager.hpp"
 
+#include <chrono>
+#include <limits>
 #include <optional>
 
 namespace Maia::GameEngine
 {
+	Entity_manager::Entity_manager(std::pmr::memory_resource* const chunk_memory_resource) :
+		m_chunk_pool{ Components_chunk_pool::default_max_size_in_bytes, chunk_memory_resource }
+	{
+	}
+
+
 	Entity_type_id Entity_manager::create_entity_type(
 		std::size_t const capacity_per_chunk,
 		gsl::span<Component_info const> const component_infos,
@@ -47,7 +55,7 @@ namespace Maia::GameEngine
 			m_component_types_spaces.push_back(space);
 			m_component_group_masks.push_back(component_types_mask);
 
-			m_component_groups.emplace_back(component_infos, capacity_per_chunk);
+			m_component_groups.emplace_back(component_infos, capacity_per_chunk, m_chunk_pool.memory_resource());
 
 			Entity_type_id const entity_type_id{ m_entity_type_ids.size() };
 			m_entity_type_ids.push_back(entity_type_id);
@@ -66,6 +74,9 @@ namespace Maia::GameEngine
 			return { static_cast<std::size_t>(std::distance(m_entity_type_ids.begin(), entity_type_id_location)) };
 		}();
 
+		Component_group& component_group = m_component_groups[entity_type_index.value];
+		component_group.reserve(component_group.size() + 1, m_chunk_pool);
+
 		if (!m_deleted_entities.empty())
 		{
 			Entity const entity = m_deleted_entities.back();
@@ -74,7 +85,6 @@ namespace Maia::GameEngine
 
 			m_entity_type_indices[entity.value] = entity_type_index;
 
-			Component_group& component_group = m_component_groups[entity_type_index.value];
 			Component_group_entity_index component_group_index = component_group.push_back(entity);
 			m_component_group_indices[entity.value] = component_group_index;
 
@@ -90,7 +100,6 @@ namespace Maia::GameEngine
 
 			m_entity_type_indices.push_back(entity_type_index);
 
-			Component_group& component_group = m_component_groups[entity_type_index.value];
 			Component_group_entity_index component_group_index = component_group.push_back(entity);
 			m_component_group_indices.push_back(component_group_index);
 
@@ -103,6 +112,13 @@ namespace Maia::GameEngine
 		m_entities_existence[entity.value] = false;
 		m_deleted_entities.push_back(entity);
 
+		if (entity.value >= m_entity_generations.size())
+		{
+			m_entity_generations.resize(entity.value + std::size_t{ 1 }, 0);
+		}
+
+		++m_entity_generations[entity.value];
+
 		Entity_type_index const entity_type_index = m_entity_type_indices[entity.value];
 		Component_group_entity_index const component_group_index = m_component_group_indices[entity.value];
 
@@ -116,4 +132,111 @@ namespace Maia::GameEngine
 	{
 		return m_entities_existence[entity.value];
 	}
-}
\ No newline at end of file
+
+	std::uint32_t Entity_manager::get_generation(Entity const entity) const
+	{
+		return entity.value < m_entity_generations.size() ? m_entity_generations[entity.value] : 0;
+	}
+
+
+	std::size_t Entity_manager::num_entities() const
+	{
+		return num_entity_ids() - num_free_entity_ids();
+	}
+
+	std::size_t Entity_manager::num_entity_ids() const
+	{
+		return m_entity_type_indices.size();
+	}
+
+	std::size_t Entity_manager::num_free_entity_ids() const
+	{
+		return m_deleted_entities.size();
+	}
+
+
+	bool Entity_manager::continue_sort_entities(Entity_sort_state& state, std::size_t const max_num_swaps)
+	{
+		Entity_type_index const entity_type_index = { state.entity_type_id.value };
+		Component_group& component_group = m_component_groups[entity_type_index.value];
+
+		std::size_t num_swaps = 0;
+
+		while (state.next_entity < state.sorted_entities.size() && state.next_index < component_group.size())
+		{
+			Entity const entity = state.sorted_entities[state.next_entity];
+
+			if (!exists(entity) || m_entity_type_indices[entity.value].value != entity_type_index.value)
+			{
+				++state.next_entity;
+				continue;
+			}
+
+			Component_group_entity_index const current_index = m_component_group_indices[entity.value];
+			Component_group_entity_index const target_index = { state.next_index };
+
+			if (current_index.value != target_index.value)
+			{
+				if (num_swaps == max_num_swaps)
+				{
+					return false;
+				}
+
+				Entity const displaced_entity = component_group.get_component_data<Entity>(target_index);
+
+				component_group.swap(current_index, target_index);
+				m_component_group_indices[entity.value] = target_index;
+				m_component_group_indices[displaced_entity.value] = current_index;
+
+				++num_swaps;
+			}
+
+			++state.next_entity;
+			++state.next_index;
+		}
+
+		return true;
+	}
+
+	void Entity_manager::update_component_group_indices(Component_group const& component_group)
+	{
+		for (std::size_t index = 0; index < component_group.size(); ++index)
+		{
+			Entity const entity = component_group.get_component_data<Entity>({ index });
+			m_component_group_indices[entity.value] = { index };
+		}
+	}
+
+	Defragment_result Entity_manager::defragment(std::chrono::nanoseconds const time_budget)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		Clock::time_point const start = Clock::now();
+
+		Defragment_result result{ 0, 0, true };
+
+		while (result.visited_component_groups < m_component_groups.size())
+		{
+			if (result.visited_component_groups > 0 && Clock::now() - start >= time_budget)
+			{
+				result.completed = false;
+				break;
+			}
+
+			if (m_defragmentation_cursor >= m_component_groups.size())
+			{
+				m_defragmentation_cursor = 0;
+			}
+
+			Component_group& component_group = m_component_groups[m_defragmentation_cursor];
+			result.released_chunks += component_group.release_empty_chunks(m_chunk_pool, component_group.num_chunks());
+
+			++m_defragmentation_cursor;
+			++result.visited_component_groups;
+		}
+
+		m_chunk_pool.trim();
+
+		return result;
+	}
+}
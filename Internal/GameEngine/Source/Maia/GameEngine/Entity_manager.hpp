@@ -3,13 +3,20 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <Maia/GameEngine/Component_group.hpp>
 #include <Maia/GameEngine/Component_group_mask.hpp>
+#include <Maia/GameEngine/Components_chunk_pool.hpp>
 #include <Maia/GameEngine/Entity.hpp>
 #include <Maia/GameEngine/Entity_type.hpp>
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
 
 namespace Maia::GameEngine
 {
@@ -35,6 +42,23 @@ namespace Maia::GameEngine
 	}
 
 
+	struct Defragment_result
+	{
+		std::size_t released_chunks;
+		std::size_t visited_component_groups;
+		bool completed;
+	};
+
+
+	struct Entity_sort_state
+	{
+		Entity_type_id entity_type_id;
+		std::vector<Entity> sorted_entities;
+		std::size_t next_entity;
+		std::size_t next_index;
+	};
+
+
 	class Entity_manager
 	{
 	public:
@@ -43,6 +67,13 @@ namespace Maia::GameEngine
 		using Remove_cvr_t = std::remove_cv_t<std::remove_reference_t<T>>;
 
 
+		Entity_manager() = default;
+
+		// The component chunks are allocated from chunk_memory_resource, which must outlive the entity manager.
+		// The chunks that do not fit in the chunk pool when it is trimmed are deallocated to it.
+		explicit Entity_manager(std::pmr::memory_resource* chunk_memory_resource);
+
+
 		Entity_type_id create_entity_type(
 			std::size_t capacity_per_chunk,
 			gsl::span<Component_info const> component_infos,
@@ -88,6 +119,7 @@ namespace Maia::GameEngine
 			}();
 
 			Component_group& component_group = m_component_groups[entity_type_index.value];
+			component_group.reserve(component_group.size() + count, m_chunk_pool);
 
 			std::vector<Entity> entities;
 			entities.reserve(count);
@@ -142,6 +174,7 @@ namespace Maia::GameEngine
 			}();
 
 			Component_group& component_group = m_component_groups[entity_type_index.value];
+			component_group.reserve(component_group.size() + Count, m_chunk_pool);
 
 			std::array<Entity, Count> entities;
 
@@ -184,6 +217,84 @@ namespace Maia::GameEngine
 
 		bool exists(Entity entity) const;
 
+		// Number of times that the id of entity was destroyed. It tells apart the entities that reused the same id.
+		std::uint32_t get_generation(Entity entity) const;
+
+
+		std::size_t num_entities() const;
+
+		std::size_t num_entity_ids() const;
+
+		std::size_t num_free_entity_ids() const;
+
+
+		// Releases the empty chunks of the component groups to the chunk pool, visiting the groups in a round-robin fashion
+		// until time_budget is exhausted. The next call resumes from the group where this one stopped.
+		Defragment_result defragment(std::chrono::nanoseconds time_budget);
+
+		// Sorts the entities of an entity type by the key returned by key_function(Component const&).
+		// Components are moved column-wise, and entities keep pointing to their components.
+		template <typename Component, typename Key_function>
+		void sort_entities(Entity_type_id const entity_type_id, Key_function&& key_function)
+		{
+			Component_group& component_group = get_component_group(entity_type_id);
+
+			std::vector<std::size_t> permutation;
+			permutation.reserve(component_group.size());
+
+			for_each_in_sort_order<Component>(component_group, std::forward<Key_function>(key_function), [&permutation](std::size_t const index) -> void
+			{
+				permutation.push_back(index);
+			});
+
+			component_group.apply_permutation(permutation);
+
+			update_component_group_indices(component_group);
+		}
+
+		// Computes the sorted order of the entities of an entity type, so that the entities can be moved
+		// in several steps using continue_sort_entities.
+		template <typename Component, typename Key_function>
+		Entity_sort_state begin_sort_entities(Entity_type_id const entity_type_id, Key_function&& key_function) const
+		{
+			Entity_sort_state state{};
+			begin_sort_entities<Component>(entity_type_id, std::forward<Key_function>(key_function), state);
+			return state;
+		}
+
+		// Same as above, but reuses the memory of state, so that a sort that is started every few frames does not
+		// allocate once state is large enough.
+		template <typename Component, typename Key_function>
+		void begin_sort_entities(Entity_type_id const entity_type_id, Key_function&& key_function, Entity_sort_state& state) const
+		{
+			Component_group const& component_group = get_component_group(entity_type_id);
+
+			state.entity_type_id = entity_type_id;
+			state.sorted_entities.clear();
+			state.next_entity = 0;
+			state.next_index = 0;
+
+			for_each_in_sort_order<Component>(component_group, std::forward<Key_function>(key_function), [&](std::size_t const index) -> void
+			{
+				state.sorted_entities.push_back(component_group.get_component_data<Entity>({ index }));
+			});
+		}
+
+		// Swaps at most max_num_swaps entities into their sorted position. Entities that were destroyed
+		// or changed type since begin_sort_entities are skipped. Returns true when the sort is completed.
+		bool continue_sort_entities(Entity_sort_state& state, std::size_t max_num_swaps);
+
+
+		Components_chunk_pool const& get_chunk_pool() const
+		{
+			return m_chunk_pool;
+		}
+
+		Components_chunk_pool& get_chunk_pool()
+		{
+			return m_chunk_pool;
+		}
+
 
 		template <typename Component>
 		bool has_component(Entity entity) const
@@ -257,6 +368,12 @@ namespace Maia::GameEngine
 		}
 
 
+		gsl::span<const Entity_type_id> get_entity_type_ids() const
+		{
+			return m_entity_type_ids;
+		}
+
+
 		gsl::span<const Component_group_mask> get_component_types_groups() const
 		{
 			return m_component_group_masks;
@@ -281,6 +398,39 @@ namespace Maia::GameEngine
 
 	private:
 
+		// Calls function(index) for the indices of the elements of component_group in the order of their keys.
+		// Elements with equal keys keep their order.
+		template <typename Component, typename Key_function, typename Function>
+		static void for_each_in_sort_order(Component_group const& component_group, Key_function&& key_function, Function&& function)
+		{
+			using Key = Remove_cvr_t<std::invoke_result_t<Key_function, Component const&>>;
+			using Indexed_key = std::pair<Key, std::size_t>;
+
+			Maia::Utilities::Scratch_scope const scratch_scope;
+			Maia::Utilities::Arena_vector<Indexed_key> keys{ scratch_scope.allocator<Indexed_key>() };
+			keys.reserve(component_group.size());
+
+			for (std::size_t index = 0; index < component_group.size(); ++index)
+			{
+				Component const component = component_group.get_component_data<Component>({ index });
+				keys.emplace_back(key_function(component), index);
+			}
+
+			// The index breaks the ties, so that an unstable sort, which does not allocate a temporary buffer, keeps
+			// the order of equal keys
+			std::sort(keys.begin(), keys.end(), [](Indexed_key const& lhs, Indexed_key const& rhs) -> bool
+			{
+				return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+			});
+
+			for (Indexed_key const& key : keys)
+			{
+				function(key.second);
+			}
+		}
+
+		void update_component_group_indices(Component_group const& component_group);
+
 
 		// Indexed by Entity_type_index
 		std::vector<Entity_type_id> m_entity_type_ids;
@@ -293,6 +443,10 @@ namespace Maia::GameEngine
 		std::vector<Component_group_entity_index> m_component_group_indices;
 		std::vector<bool> m_entities_existence;
 		std::vector<Entity> m_deleted_entities;
+		std::vector<std::uint32_t> m_entity_generations;
+
+		Components_chunk_pool m_chunk_pool;
+		std::size_t m_defragmentation_cursor = 0;
 
 
 	};
@@ -0,0 +1,133 @@
+#include "Entity_manager_statistics.hpp"
+
+#include <ostream>
+
+#include <nlohmann/json.hpp>
+
+#include <Maia/GameEngine/Component_group.hpp>
+#include <Maia/GameEngine/Entity_manager.hpp>
+
+namespace Maia::GameEngine
+{
+	void to_json(nlohmann::json& json, Component_statistics const& value)
+	{
+		json["id"] = value.id.value;
+		json["size"] = value.size.value;
+		json["used_size_in_bytes"] = value.used_size_in_bytes;
+		json["allocated_size_in_bytes"] = value.allocated_size_in_bytes;
+	}
+
+	void to_json(nlohmann::json& json, Component_group_statistics const& value)
+	{
+		json["entity_type_id"] = value.entity_type_id.value;
+		json["size"] = value.size;
+		json["capacity"] = value.capacity;
+		json["capacity_per_chunk"] = value.capacity_per_chunk;
+		json["num_chunks"] = value.num_chunks;
+		json["chunk_size_in_bytes"] = value.chunk_size_in_bytes;
+		json["used_size_in_bytes"] = value.used_size_in_bytes;
+		json["allocated_size_in_bytes"] = value.allocated_size_in_bytes;
+		json["wasted_tail_capacity"] = value.wasted_tail_capacity;
+		json["chunk_fill_ratio"] = value.chunk_fill_ratio;
+		json["components"] = value.components;
+	}
+
+	void to_json(nlohmann::json& json, Entity_manager_statistics const& value)
+	{
+		json["num_entities"] = value.num_entities;
+		json["num_entity_ids"] = value.num_entity_ids;
+		json["num_free_entity_ids"] = value.num_free_entity_ids;
+		json["used_size_in_bytes"] = value.used_size_in_bytes;
+		json["allocated_size_in_bytes"] = value.allocated_size_in_bytes;
+		json["component_groups"] = value.component_groups;
+	}
+
+
+	void calculate_statistics(
+		Component_group const& component_group,
+		Entity_type_id const entity_type_id,
+		Component_group_statistics& statistics
+	)
+	{
+		std::size_t const size = component_group.size();
+		std::size_t const capacity = component_group.capacity();
+
+		statistics.entity_type_id = entity_type_id;
+		statistics.size = size;
+		statistics.capacity = capacity;
+		statistics.capacity_per_chunk = component_group.capacity_per_chunk();
+		statistics.num_chunks = component_group.num_chunks();
+		statistics.chunk_size_in_bytes = component_group.chunk_size_in_bytes();
+		statistics.used_size_in_bytes = size * component_group.size_of_single_element();
+		statistics.allocated_size_in_bytes = statistics.num_chunks * statistics.chunk_size_in_bytes;
+		statistics.wasted_tail_capacity = capacity - size;
+		statistics.chunk_fill_ratio = capacity > 0 ? static_cast<float>(size) / capacity : 1.0f;
+
+		gsl::span<Component_type_info const> const type_infos = component_group.component_type_infos();
+		statistics.components.resize(type_infos.size());
+
+		for (std::ptrdiff_t index = 0; index < type_infos.size(); ++index)
+		{
+			Component_type_info const& type_info = type_infos[index];
+
+			statistics.components[index] =
+			{
+				type_info.id,
+				type_info.size,
+				size * type_info.size.value,
+				capacity * type_info.size.value
+			};
+		}
+	}
+
+	Component_group_statistics calculate_statistics(
+		Component_group const& component_group,
+		Entity_type_id const entity_type_id
+	)
+	{
+		Component_group_statistics statistics{};
+		calculate_statistics(component_group, entity_type_id, statistics);
+		return statistics;
+	}
+
+	void calculate_statistics(
+		Entity_manager const& entity_manager,
+		Entity_manager_statistics& statistics
+	)
+	{
+		gsl::span<Entity_type_id const> const entity_type_ids = entity_manager.get_entity_type_ids();
+		gsl::span<Component_group const> const component_groups = entity_manager.get_component_groups();
+
+		statistics.num_entities = entity_manager.num_entities();
+		statistics.num_entity_ids = entity_manager.num_entity_ids();
+		statistics.num_free_entity_ids = entity_manager.num_free_entity_ids();
+		statistics.used_size_in_bytes = 0;
+		statistics.allocated_size_in_bytes = 0;
+
+		statistics.component_groups.resize(component_groups.size());
+
+		for (std::ptrdiff_t index = 0; index < component_groups.size(); ++index)
+		{
+			Component_group_statistics& component_group_statistics = statistics.component_groups[index];
+			calculate_statistics(component_groups[index], entity_type_ids[index], component_group_statistics);
+
+			statistics.used_size_in_bytes += component_group_statistics.used_size_in_bytes;
+			statistics.allocated_size_in_bytes += component_group_statistics.allocated_size_in_bytes;
+		}
+	}
+
+	Entity_manager_statistics calculate_statistics(
+		Entity_manager const& entity_manager
+	)
+	{
+		Entity_manager_statistics statistics{};
+		calculate_statistics(entity_manager, statistics);
+		return statistics;
+	}
+
+	void write_json(std::ostream& output_stream, Entity_manager_statistics const& statistics)
+	{
+		nlohmann::json const json = statistics;
+		output_stream << json.dump(1, '\t');
+	}
+}
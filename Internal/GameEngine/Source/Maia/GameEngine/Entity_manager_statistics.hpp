@@ -0,0 +1,91 @@
+#ifndef MAIA_GAMEENGINE_ENTITYMANAGERSTATISTICS_H_INCLUDED
+#define MAIA_GAMEENGINE_ENTITYMANAGERSTATISTICS_H_INCLUDED
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <Maia/GameEngine/Component.hpp>
+#include <Maia/GameEngine/Entity_type.hpp>
+
+namespace Maia::GameEngine
+{
+	class Component_group;
+	class Entity_manager;
+
+
+	struct Component_statistics
+	{
+		Component_ID id;
+		Component_size size;
+		std::size_t used_size_in_bytes;
+		std::size_t allocated_size_in_bytes;
+	};
+
+	void to_json(nlohmann::json& json, Component_statistics const& value);
+
+
+	struct Component_group_statistics
+	{
+		Entity_type_id entity_type_id;
+		std::size_t size;
+		std::size_t capacity;
+		std::size_t capacity_per_chunk;
+		std::size_t num_chunks;
+		std::size_t chunk_size_in_bytes;
+		std::size_t used_size_in_bytes;
+		std::size_t allocated_size_in_bytes;
+
+		// Number of elements that are allocated but not used.
+		std::size_t wasted_tail_capacity;
+
+		// Ratio between size and capacity, in the range [0, 1]. It is 1 if the group has no chunks.
+		float chunk_fill_ratio;
+
+		std::vector<Component_statistics> components;
+	};
+
+	void to_json(nlohmann::json& json, Component_group_statistics const& value);
+
+
+	struct Entity_manager_statistics
+	{
+		std::size_t num_entities;
+		std::size_t num_entity_ids;
+		std::size_t num_free_entity_ids;
+		std::size_t used_size_in_bytes;
+		std::size_t allocated_size_in_bytes;
+
+		std::vector<Component_group_statistics> component_groups;
+	};
+
+	void to_json(nlohmann::json& json, Entity_manager_statistics const& value);
+
+
+	void calculate_statistics(
+		Component_group const& component_group,
+		Entity_type_id entity_type_id,
+		Component_group_statistics& statistics
+	);
+
+	Component_group_statistics calculate_statistics(
+		Component_group const& component_group,
+		Entity_type_id entity_type_id
+	);
+
+	// Reuses the storage of statistics, so that sampling every frame does not allocate once the number of entity types stabilizes.
+	void calculate_statistics(
+		Entity_manager const& entity_manager,
+		Entity_manager_statistics& statistics
+	);
+
+	Entity_manager_statistics calculate_statistics(
+		Entity_manager const& entity_manager
+	);
+
+	void write_json(std::ostream& output_stream, Entity_manager_statistics const& statistics);
+}
+
+#endif
@@ -0,0 +1,202 @@
+#include "Lod_selection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAIA_GAMEENGINE_LOD_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Maia::GameEngine::Lod
+{
+	namespace
+	{
+		constexpr float minimum_distance = 1e-4f;
+
+		// An entity only moves to a finer level once its projected size is larger than the upper threshold and to a
+		// coarser one once it is not larger than the lower threshold, so the current level is clamped to
+		// [number of lower thresholds >= size, number of upper thresholds >= size].
+		struct Hysteresis_thresholds
+		{
+			std::array<float, max_num_lod_levels - 1> lower;
+			std::array<float, max_num_lod_levels - 1> upper;
+			std::size_t count;
+		};
+
+		Hysteresis_thresholds create_hysteresis_thresholds(Lod_group const& lod_group)
+		{
+			assert(get_num_lod_levels(lod_group) <= max_num_lod_levels);
+			assert(std::is_sorted(lod_group.screen_size_thresholds.rbegin(), lod_group.screen_size_thresholds.rend()));
+
+			Hysteresis_thresholds thresholds;
+			thresholds.count = lod_group.screen_size_thresholds.size();
+
+			for (std::size_t index = 0; index < thresholds.count; ++index)
+			{
+				float const threshold = lod_group.screen_size_thresholds[index];
+
+				thresholds.lower[index] = threshold * (1.0f - lod_group.hysteresis);
+				thresholds.upper[index] = threshold * (1.0f + lod_group.hysteresis);
+			}
+
+			return thresholds;
+		}
+
+		std::uint8_t select_lod_level(Hysteresis_thresholds const& thresholds, float const projected_size, std::uint8_t const level)
+		{
+			std::uint8_t finest_level = 0;
+			std::uint8_t coarsest_level = 0;
+
+			for (std::size_t index = 0; index < thresholds.count; ++index)
+			{
+				finest_level += projected_size <= thresholds.lower[index] ? 1 : 0;
+				coarsest_level += projected_size <= thresholds.upper[index] ? 1 : 0;
+			}
+
+			return std::clamp(level, finest_level, coarsest_level);
+		}
+
+		float calculate_projected_size(Spatial::Aabb const& aabb, Eigen::Vector3f const& camera_position, float const projection_scale)
+		{
+			float const extents_x = 0.5f * (aabb.maximum(0) - aabb.minimum(0));
+			float const extents_y = 0.5f * (aabb.maximum(1) - aabb.minimum(1));
+			float const extents_z = 0.5f * (aabb.maximum(2) - aabb.minimum(2));
+
+			float const offset_x = 0.5f * (aabb.minimum(0) + aabb.maximum(0)) - camera_position(0);
+			float const offset_y = 0.5f * (aabb.minimum(1) + aabb.maximum(1)) - camera_position(1);
+			float const offset_z = 0.5f * (aabb.minimum(2) + aabb.maximum(2)) - camera_position(2);
+
+			float const radius = std::sqrt(extents_x * extents_x + extents_y * extents_y + extents_z * extents_z);
+			float const distance = std::sqrt(offset_x * offset_x + offset_y * offset_y + offset_z * offset_z);
+
+			return radius * projection_scale / std::max(distance, minimum_distance);
+		}
+	}
+
+	std::size_t get_num_lod_levels(Lod_group const& lod_group)
+	{
+		return lod_group.screen_size_thresholds.size() + 1;
+	}
+
+
+	float calculate_projection_scale(float const vertical_field_of_view)
+	{
+		return 1.0f / std::tan(0.5f * vertical_field_of_view);
+	}
+
+	void calculate_projected_sizes(
+		gsl::span<Components::World_bounds const> const world_bounds,
+		Eigen::Vector3f const& camera_position,
+		float const projection_scale,
+		float* const projected_sizes
+	)
+	{
+		std::size_t const count = static_cast<std::size_t>(world_bounds.size());
+		std::size_t index = 0;
+
+#if defined(MAIA_GAMEENGINE_LOD_SSE)
+		__m128 const half = _mm_set1_ps(0.5f);
+		__m128 const camera_x = _mm_set1_ps(camera_position(0));
+		__m128 const camera_y = _mm_set1_ps(camera_position(1));
+		__m128 const camera_z = _mm_set1_ps(camera_position(2));
+		__m128 const scale = _mm_set1_ps(projection_scale);
+		__m128 const minimum = _mm_set1_ps(minimum_distance);
+
+		for (; index + 4 <= count; index += 4)
+		{
+			Spatial::Aabb const& aabb_0 = world_bounds[index].value;
+			Spatial::Aabb const& aabb_1 = world_bounds[index + 1].value;
+			Spatial::Aabb const& aabb_2 = world_bounds[index + 2].value;
+			Spatial::Aabb const& aabb_3 = world_bounds[index + 3].value;
+
+			__m128 const minimum_x = _mm_setr_ps(aabb_0.minimum(0), aabb_1.minimum(0), aabb_2.minimum(0), aabb_3.minimum(0));
+			__m128 const minimum_y = _mm_setr_ps(aabb_0.minimum(1), aabb_1.minimum(1), aabb_2.minimum(1), aabb_3.minimum(1));
+			__m128 const minimum_z = _mm_setr_ps(aabb_0.minimum(2), aabb_1.minimum(2), aabb_2.minimum(2), aabb_3.minimum(2));
+			__m128 const maximum_x = _mm_setr_ps(aabb_0.maximum(0), aabb_1.maximum(0), aabb_2.maximum(0), aabb_3.maximum(0));
+			__m128 const maximum_y = _mm_setr_ps(aabb_0.maximum(1), aabb_1.maximum(1), aabb_2.maximum(1), aabb_3.maximum(1));
+			__m128 const maximum_z = _mm_setr_ps(aabb_0.maximum(2), aabb_1.maximum(2), aabb_2.maximum(2), aabb_3.maximum(2));
+
+			__m128 const extents_x = _mm_mul_ps(half, _mm_sub_ps(maximum_x, minimum_x));
+			__m128 const extents_y = _mm_mul_ps(half, _mm_sub_ps(maximum_y, minimum_y));
+			__m128 const extents_z = _mm_mul_ps(half, _mm_sub_ps(maximum_z, minimum_z));
+
+			__m128 const offset_x = _mm_sub_ps(_mm_mul_ps(half, _mm_add_ps(minimum_x, maximum_x)), camera_x);
+			__m128 const offset_y = _mm_sub_ps(_mm_mul_ps(half, _mm_add_ps(minimum_y, maximum_y)), camera_y);
+			__m128 const offset_z = _mm_sub_ps(_mm_mul_ps(half, _mm_add_ps(minimum_z, maximum_z)), camera_z);
+
+			__m128 const radius = _mm_sqrt_ps(
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(extents_x, extents_x), _mm_mul_ps(extents_y, extents_y)), _mm_mul_ps(extents_z, extents_z))
+			);
+			__m128 const distance = _mm_sqrt_ps(
+				_mm_add_ps(_mm_add_ps(_mm_mul_ps(offset_x, offset_x), _mm_mul_ps(offset_y, offset_y)), _mm_mul_ps(offset_z, offset_z))
+			);
+
+			_mm_storeu_ps(projected_sizes + index, _mm_div_ps(_mm_mul_ps(radius, scale), _mm_max_ps(distance, minimum)));
+		}
+#endif
+
+		for (; index < count; ++index)
+		{
+			projected_sizes[index] = calculate_projected_size(world_bounds[index].value, camera_position, projection_scale);
+		}
+	}
+
+	void select_lod_levels(Lod_group const& lod_group, float const* const projected_sizes, std::size_t const count, Components::Lod_level* const levels)
+	{
+#if defined(MAIA_GAMEENGINE_LOD_SSE)
+		static_assert(sizeof(Components::Lod_level) == sizeof(std::uint8_t));
+
+		Hysteresis_thresholds const thresholds = create_hysteresis_thresholds(lod_group);
+
+		std::size_t index = 0;
+
+		for (; index + 4 <= count; index += 4)
+		{
+			__m128 const sizes = _mm_loadu_ps(projected_sizes + index);
+
+			// Comparison masks are -1 where true, so subtracting them counts the thresholds
+			__m128i finest_levels = _mm_setzero_si128();
+			__m128i coarsest_levels = _mm_setzero_si128();
+
+			for (std::size_t threshold_index = 0; threshold_index < thresholds.count; ++threshold_index)
+			{
+				finest_levels = _mm_sub_epi32(finest_levels, _mm_castps_si128(_mm_cmple_ps(sizes, _mm_set1_ps(thresholds.lower[threshold_index]))));
+				coarsest_levels = _mm_sub_epi32(coarsest_levels, _mm_castps_si128(_mm_cmple_ps(sizes, _mm_set1_ps(thresholds.upper[threshold_index]))));
+			}
+
+			std::int32_t packed_levels;
+			std::memcpy(&packed_levels, levels + index, sizeof(packed_levels));
+
+			__m128i const zero = _mm_setzero_si128();
+			__m128i const current_levels = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed_levels), zero), zero);
+
+			// All values are smaller than 2^15, so the 16-bit minimum and maximum are valid for the 32-bit lanes
+			__m128i const new_levels = _mm_min_epi16(_mm_max_epi16(current_levels, finest_levels), coarsest_levels);
+
+			packed_levels = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(new_levels, zero), zero));
+			std::memcpy(levels + index, &packed_levels, sizeof(packed_levels));
+		}
+
+		for (; index < count; ++index)
+		{
+			levels[index].value = select_lod_level(thresholds, projected_sizes[index], levels[index].value);
+		}
+#else
+		select_lod_levels_scalar(lod_group, projected_sizes, count, levels);
+#endif
+	}
+
+	void select_lod_levels_scalar(Lod_group const& lod_group, float const* const projected_sizes, std::size_t const count, Components::Lod_level* const levels)
+	{
+		Hysteresis_thresholds const thresholds = create_hysteresis_thresholds(lod_group);
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			levels[index].value = select_lod_level(thresholds, projected_sizes[index], levels[index].value);
+		}
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef MAIA_GAMEENGINE_LOD_LODSELECTION_H_INCLUDED
+#define MAIA_GAMEENGINE_LOD_LODSELECTION_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/GameEngine/Components/Lod_level.hpp>
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+
+namespace Maia::GameEngine::Lod
+{
+	constexpr std::size_t max_num_lod_levels = 8;
+
+	// Level i is selected while the projected size is larger than screen_size_thresholds[i], so the thresholds
+	// must be in descending order and the group has screen_size_thresholds.size() + 1 levels.
+	// A level is only left once the projected size crosses its thresholds by more than hysteresis times the
+	// threshold, so that entities that stay close to a threshold do not switch levels every frame.
+	struct Lod_group
+	{
+		std::vector<float> screen_size_thresholds;
+		float hysteresis{ 0.1f };
+	};
+
+	std::size_t get_num_lod_levels(Lod_group const& lod_group);
+
+
+	// Scale from the radius over the distance of a bounding sphere to its projected size, given as a fraction of
+	// the screen height.
+	float calculate_projection_scale(float vertical_field_of_view);
+
+	// Writes the projected size of the bounding sphere of each of the world_bounds.
+	void calculate_projected_sizes(
+		gsl::span<Components::World_bounds const> world_bounds,
+		Eigen::Vector3f const& camera_position,
+		float projection_scale,
+		float* projected_sizes
+	);
+
+	// Updates the levels, which hold the levels of the previous frame, from the projected sizes.
+	void select_lod_levels(Lod_group const& lod_group, float const* projected_sizes, std::size_t count, Components::Lod_level* levels);
+
+	void select_lod_levels_scalar(Lod_group const& lod_group, float const* projected_sizes, std::size_t count, Components::Lod_level* levels);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include "Morton_code.hpp"
+
+#include <algorithm>
+
+namespace Maia::GameEngine
+{
+	namespace
+	{
+		std::uint32_t expand_bits(std::uint32_t value)
+		{
+			value &= 0x000003FF;
+			value = (value | (value << 16)) & 0xFF0000FF;
+			value = (value | (value << 8)) & 0x0300F00F;
+			value = (value | (value << 4)) & 0x030C30C3;
+			value = (value | (value << 2)) & 0x09249249;
+			return value;
+		}
+
+		std::uint32_t quantize(float const value, float const minimum, float const maximum)
+		{
+			float const extent = maximum - minimum;
+			float const normalized = extent > 0.0f ? (value - minimum) / extent : 0.0f;
+
+			return static_cast<std::uint32_t>(std::clamp(normalized, 0.0f, 1.0f) * 1023.0f);
+		}
+	}
+
+	std::uint32_t encode_morton_code(std::uint32_t const x, std::uint32_t const y, std::uint32_t const z)
+	{
+		return (expand_bits(x) << 2) | (expand_bits(y) << 1) | expand_bits(z);
+	}
+
+	std::uint32_t calculate_morton_code(
+		Eigen::Vector3f const& position,
+		Eigen::Vector3f const& minimum,
+		Eigen::Vector3f const& maximum
+	)
+	{
+		return encode_morton_code(
+			quantize(position(0), minimum(0), maximum(0)),
+			quantize(position(1), minimum(1), maximum(1)),
+			quantize(position(2), minimum(2), maximum(2))
+		);
+	}
+}
@@ -0,0 +1,22 @@
+#ifndef MAIA_GAMEENGINE_MORTONCODE_H_INCLUDED
+#define MAIA_GAMEENGINE_MORTONCODE_H_INCLUDED
+
+#include <cstdint>
+
+#include <Eigen/Core>
+
+namespace Maia::GameEngine
+{
+	// Interleaves the 10 least significant bits of x, y and z.
+	std::uint32_t encode_morton_code(std::uint32_t x, std::uint32_t y, std::uint32_t z);
+
+	// Quantizes position inside the box [minimum, maximum] to a 1024x1024x1024 grid and returns its Morton code.
+	// Positions outside of the box are clamped.
+	std::uint32_t calculate_morton_code(
+		Eigen::Vector3f const& position,
+		Eigen::Vector3f const& minimum,
+		Eigen::Vector3f const& maximum
+	);
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "Aabb.hpp"
+
+namespace Maia::GameEngine::Spatial
+{
+	bool operator==(Aabb const& lhs, Aabb const& rhs)
+	{
+		return lhs.minimum == rhs.minimum && lhs.maximum == rhs.maximum;
+	}
+
+	bool operator!=(Aabb const& lhs, Aabb const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	Eigen::Vector3f center(Aabb const& aabb)
+	{
+		return 0.5f * (aabb.minimum + aabb.maximum);
+	}
+
+	Eigen::Vector3f extents(Aabb const& aabb)
+	{
+		return 0.5f * (aabb.maximum - aabb.minimum);
+	}
+
+	float surface_area(Aabb const& aabb)
+	{
+		Eigen::Vector3f const size = aabb.maximum - aabb.minimum;
+		return 2.0f * (size(0) * size(1) + size(1) * size(2) + size(2) * size(0));
+	}
+
+	Aabb merge(Aabb const& lhs, Aabb const& rhs)
+	{
+		return { lhs.minimum.cwiseMin(rhs.minimum), lhs.maximum.cwiseMax(rhs.maximum) };
+	}
+
+	Aabb expand(Aabb const& aabb, float const margin)
+	{
+		Eigen::Vector3f const offset{ margin, margin, margin };
+		return { aabb.minimum - offset, aabb.maximum + offset };
+	}
+
+	bool contains(Aabb const& outer, Aabb const& inner)
+	{
+		return (outer.minimum.array() <= inner.minimum.array()).all()
+			&& (inner.maximum.array() <= outer.maximum.array()).all();
+	}
+
+	bool intersects(Aabb const& lhs, Aabb const& rhs)
+	{
+		return (lhs.minimum.array() <= rhs.maximum.array()).all()
+			&& (rhs.minimum.array() <= lhs.maximum.array()).all();
+	}
+
+	Aabb transform(Aabb const& aabb, Eigen::Matrix4f const& transform)
+	{
+		Eigen::Vector3f const local_center = center(aabb);
+		Eigen::Vector3f const local_extents = extents(aabb);
+
+		Eigen::Vector3f const world_center = transform.block<3, 3>(0, 0) * local_center + transform.block<3, 1>(0, 3);
+		Eigen::Vector3f const world_extents = transform.block<3, 3>(0, 0).cwiseAbs() * local_extents;
+
+		return { world_center - world_extents, world_center + world_extents };
+	}
+}
@@ -0,0 +1,36 @@
+#ifndef MAIA_GAMEENGINE_SPATIAL_AABB_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIAL_AABB_H_INCLUDED
+
+#include <Eigen/Core>
+
+namespace Maia::GameEngine::Spatial
+{
+	struct Aabb
+	{
+		Eigen::Vector3f minimum{ 0.0f, 0.0f, 0.0f };
+		Eigen::Vector3f maximum{ 0.0f, 0.0f, 0.0f };
+	};
+
+	bool operator==(Aabb const& lhs, Aabb const& rhs);
+	bool operator!=(Aabb const& lhs, Aabb const& rhs);
+
+
+	Eigen::Vector3f center(Aabb const& aabb);
+
+	Eigen::Vector3f extents(Aabb const& aabb);
+
+	float surface_area(Aabb const& aabb);
+
+	Aabb merge(Aabb const& lhs, Aabb const& rhs);
+
+	Aabb expand(Aabb const& aabb, float margin);
+
+	bool contains(Aabb const& outer, Aabb const& inner);
+
+	bool intersects(Aabb const& lhs, Aabb const& rhs);
+
+	// Returns the box that bounds aabb after being transformed by the affine matrix transform.
+	Aabb transform(Aabb const& aabb, Eigen::Matrix4f const& transform);
+}
+
+#endif
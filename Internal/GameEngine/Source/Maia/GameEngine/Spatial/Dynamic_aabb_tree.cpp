@@ -0,0 +1,418 @@
+#include "Dynamic_aabb_tree.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Maia::GameEngine::Spatial
+{
+	Dynamic_aabb_tree::Dynamic_aabb_tree(float const margin) :
+		m_nodes{},
+		m_root{ null_node },
+		m_free_list{ null_node },
+		m_size{ 0 },
+		m_margin{ margin }
+	{
+	}
+
+
+	Aabb_tree_proxy Dynamic_aabb_tree::insert(Aabb const& aabb, Entity const entity)
+	{
+		std::size_t const leaf_index = allocate_node();
+
+		Node& leaf = m_nodes[leaf_index];
+		leaf.aabb = expand(aabb, m_margin);
+		leaf.entity = entity;
+		leaf.height = 0;
+
+		insert_leaf(leaf_index);
+		++m_size;
+
+		return { leaf_index };
+	}
+
+	void Dynamic_aabb_tree::remove(Aabb_tree_proxy const proxy)
+	{
+		assert(proxy.value < m_nodes.size() && m_nodes[proxy.value].is_leaf());
+
+		remove_leaf(proxy.value);
+		free_node(proxy.value);
+		--m_size;
+	}
+
+	bool Dynamic_aabb_tree::move(Aabb_tree_proxy const proxy, Aabb const& aabb)
+	{
+		assert(proxy.value < m_nodes.size() && m_nodes[proxy.value].is_leaf());
+
+		if (contains(m_nodes[proxy.value].aabb, aabb))
+		{
+			return false;
+		}
+
+		remove_leaf(proxy.value);
+		m_nodes[proxy.value].aabb = expand(aabb, m_margin);
+		insert_leaf(proxy.value);
+
+		return true;
+	}
+
+
+	Aabb const& Dynamic_aabb_tree::get_fat_aabb(Aabb_tree_proxy const proxy) const
+	{
+		return m_nodes[proxy.value].aabb;
+	}
+
+	Entity Dynamic_aabb_tree::get_entity(Aabb_tree_proxy const proxy) const
+	{
+		return m_nodes[proxy.value].entity;
+	}
+
+	std::size_t Dynamic_aabb_tree::size() const
+	{
+		return m_size;
+	}
+
+	std::size_t Dynamic_aabb_tree::height() const
+	{
+		return m_root != null_node ? static_cast<std::size_t>(m_nodes[m_root].height) : 0;
+	}
+
+	float Dynamic_aabb_tree::margin() const
+	{
+		return m_margin;
+	}
+
+
+	namespace
+	{
+		template <typename Query, typename Query_function>
+		void batch_query(
+			gsl::span<Query const> const queries,
+			std::vector<Entity>& results,
+			std::vector<std::size_t>& offsets,
+			Query_function&& query_function
+		)
+		{
+			std::vector<std::size_t> stack;
+
+			results.clear();
+			offsets.resize(queries.size() + 1);
+			offsets[0] = 0;
+
+			for (std::ptrdiff_t index = 0; index < queries.size(); ++index)
+			{
+				query_function(queries[index], stack, [&results](Entity const entity) -> void { results.push_back(entity); });
+				offsets[index + 1] = results.size();
+			}
+		}
+	}
+
+	void Dynamic_aabb_tree::query(gsl::span<Aabb const> const aabbs, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const
+	{
+		batch_query(aabbs, results, offsets, [this](Aabb const& aabb, std::vector<std::size_t>& stack, auto&& function) -> void
+		{
+			query(aabb, stack, function);
+		});
+	}
+
+	void Dynamic_aabb_tree::query(gsl::span<Frustum const> const frustums, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const
+	{
+		batch_query(frustums, results, offsets, [this](Frustum const& frustum, std::vector<std::size_t>& stack, auto&& function) -> void
+		{
+			query(frustum, stack, function);
+		});
+	}
+
+	void Dynamic_aabb_tree::ray_cast(gsl::span<Ray const> const rays, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const
+	{
+		batch_query(rays, results, offsets, [this](Ray const& ray, std::vector<std::size_t>& stack, auto&& function) -> void
+		{
+			ray_cast(ray, stack, function);
+		});
+	}
+
+
+	std::size_t Dynamic_aabb_tree::allocate_node()
+	{
+		if (m_free_list == null_node)
+		{
+			m_nodes.push_back({});
+			m_free_list = m_nodes.size() - 1;
+			m_nodes.back().parent = null_node;
+		}
+
+		std::size_t const node_index = m_free_list;
+		Node& node = m_nodes[node_index];
+		m_free_list = node.parent;
+
+		node.parent = null_node;
+		node.child_0 = null_node;
+		node.child_1 = null_node;
+		node.height = 0;
+
+		return node_index;
+	}
+
+	void Dynamic_aabb_tree::free_node(std::size_t const node_index)
+	{
+		Node& node = m_nodes[node_index];
+		node.parent = m_free_list;
+		node.height = -1;
+
+		m_free_list = node_index;
+	}
+
+	void Dynamic_aabb_tree::insert_leaf(std::size_t const leaf_index)
+	{
+		if (m_root == null_node)
+		{
+			m_root = leaf_index;
+			m_nodes[m_root].parent = null_node;
+			return;
+		}
+
+		Aabb const leaf_aabb = m_nodes[leaf_index].aabb;
+
+		// Find the best sibling by descending the tree using the surface area heuristic
+		std::size_t sibling_index = m_root;
+		while (!m_nodes[sibling_index].is_leaf())
+		{
+			Node const& node = m_nodes[sibling_index];
+
+			float const area = surface_area(node.aabb);
+			float const combined_area = surface_area(merge(node.aabb, leaf_aabb));
+
+			float const cost = 2.0f * combined_area;
+			float const inheritance_cost = 2.0f * (combined_area - area);
+
+			auto const calculate_child_cost = [&](std::size_t const child_index) -> float
+			{
+				Node const& child = m_nodes[child_index];
+				float const merged_area = surface_area(merge(leaf_aabb, child.aabb));
+
+				return child.is_leaf() ?
+					merged_area + inheritance_cost :
+					merged_area - surface_area(child.aabb) + inheritance_cost;
+			};
+
+			float const cost_0 = calculate_child_cost(node.child_0);
+			float const cost_1 = calculate_child_cost(node.child_1);
+
+			if (cost < cost_0 && cost < cost_1)
+			{
+				break;
+			}
+
+			sibling_index = cost_0 < cost_1 ? node.child_0 : node.child_1;
+		}
+
+		std::size_t const old_parent_index = m_nodes[sibling_index].parent;
+		std::size_t const new_parent_index = allocate_node();
+
+		{
+			Node& new_parent = m_nodes[new_parent_index];
+			new_parent.parent = old_parent_index;
+			new_parent.aabb = merge(leaf_aabb, m_nodes[sibling_index].aabb);
+			new_parent.height = m_nodes[sibling_index].height + 1;
+			new_parent.child_0 = sibling_index;
+			new_parent.child_1 = leaf_index;
+		}
+
+		if (old_parent_index != null_node)
+		{
+			Node& old_parent = m_nodes[old_parent_index];
+
+			if (old_parent.child_0 == sibling_index)
+			{
+				old_parent.child_0 = new_parent_index;
+			}
+			else
+			{
+				old_parent.child_1 = new_parent_index;
+			}
+		}
+		else
+		{
+			m_root = new_parent_index;
+		}
+
+		m_nodes[sibling_index].parent = new_parent_index;
+		m_nodes[leaf_index].parent = new_parent_index;
+
+		refit(m_nodes[leaf_index].parent);
+	}
+
+	void Dynamic_aabb_tree::remove_leaf(std::size_t const leaf_index)
+	{
+		if (leaf_index == m_root)
+		{
+			m_root = null_node;
+			return;
+		}
+
+		std::size_t const parent_index = m_nodes[leaf_index].parent;
+		std::size_t const grand_parent_index = m_nodes[parent_index].parent;
+		std::size_t const sibling_index = m_nodes[parent_index].child_0 == leaf_index ?
+			m_nodes[parent_index].child_1 :
+			m_nodes[parent_index].child_0;
+
+		if (grand_parent_index != null_node)
+		{
+			Node& grand_parent = m_nodes[grand_parent_index];
+
+			if (grand_parent.child_0 == parent_index)
+			{
+				grand_parent.child_0 = sibling_index;
+			}
+			else
+			{
+				grand_parent.child_1 = sibling_index;
+			}
+
+			m_nodes[sibling_index].parent = grand_parent_index;
+			free_node(parent_index);
+
+			refit(grand_parent_index);
+		}
+		else
+		{
+			m_root = sibling_index;
+			m_nodes[sibling_index].parent = null_node;
+			free_node(parent_index);
+		}
+
+		m_nodes[leaf_index].parent = null_node;
+	}
+
+	void Dynamic_aabb_tree::refit(std::size_t node_index)
+	{
+		while (node_index != null_node)
+		{
+			node_index = balance(node_index);
+
+			Node& node = m_nodes[node_index];
+			Node const& child_0 = m_nodes[node.child_0];
+			Node const& child_1 = m_nodes[node.child_1];
+
+			node.height = 1 + std::max(child_0.height, child_1.height);
+			node.aabb = merge(child_0.aabb, child_1.aabb);
+
+			node_index = node.parent;
+		}
+	}
+
+	// Rotates the tree around node_index if one of its children is more than one level higher than the other.
+	// Returns the index of the node that takes the place of node_index.
+	std::size_t Dynamic_aabb_tree::balance(std::size_t const a_index)
+	{
+		Node& a = m_nodes[a_index];
+
+		if (a.is_leaf() || a.height < 2)
+		{
+			return a_index;
+		}
+
+		std::size_t const b_index = a.child_0;
+		std::size_t const c_index = a.child_1;
+		Node& b = m_nodes[b_index];
+		Node& c = m_nodes[c_index];
+
+		int const balance = c.height - b.height;
+
+		auto const replace_in_parent = [this](std::size_t const parent_index, std::size_t const old_child_index, std::size_t const new_child_index) -> void
+		{
+			if (parent_index != null_node)
+			{
+				Node& parent = m_nodes[parent_index];
+
+				if (parent.child_0 == old_child_index)
+				{
+					parent.child_0 = new_child_index;
+				}
+				else
+				{
+					parent.child_1 = new_child_index;
+				}
+			}
+			else
+			{
+				m_root = new_child_index;
+			}
+		};
+
+		// Rotate c up
+		if (balance > 1)
+		{
+			std::size_t const f_index = c.child_0;
+			std::size_t const g_index = c.child_1;
+			Node& f = m_nodes[f_index];
+			Node& g = m_nodes[g_index];
+
+			c.child_0 = a_index;
+			c.parent = a.parent;
+			a.parent = c_index;
+			replace_in_parent(c.parent, a_index, c_index);
+
+			if (f.height > g.height)
+			{
+				c.child_1 = f_index;
+				a.child_1 = g_index;
+				g.parent = a_index;
+				a.aabb = merge(b.aabb, g.aabb);
+				c.aabb = merge(a.aabb, f.aabb);
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.child_1 = g_index;
+				a.child_1 = f_index;
+				f.parent = a_index;
+				a.aabb = merge(b.aabb, f.aabb);
+				c.aabb = merge(a.aabb, g.aabb);
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+
+			return c_index;
+		}
+
+		// Rotate b up
+		if (balance < -1)
+		{
+			std::size_t const d_index = b.child_0;
+			std::size_t const e_index = b.child_1;
+			Node& d = m_nodes[d_index];
+			Node& e = m_nodes[e_index];
+
+			b.child_0 = a_index;
+			b.parent = a.parent;
+			a.parent = b_index;
+			replace_in_parent(b.parent, a_index, b_index);
+
+			if (d.height > e.height)
+			{
+				b.child_1 = d_index;
+				a.child_0 = e_index;
+				e.parent = a_index;
+				a.aabb = merge(c.aabb, e.aabb);
+				b.aabb = merge(a.aabb, d.aabb);
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.child_1 = e_index;
+				a.child_0 = d_index;
+				d.parent = a_index;
+				a.aabb = merge(c.aabb, d.aabb);
+				b.aabb = merge(a.aabb, e.aabb);
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+
+			return b_index;
+		}
+
+		return a_index;
+	}
+}
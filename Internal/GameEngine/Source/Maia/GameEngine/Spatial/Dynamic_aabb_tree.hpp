@@ -0,0 +1,210 @@
+#ifndef MAIA_GAMEENGINE_SPATIAL_DYNAMICAABBTREE_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIAL_DYNAMICAABBTREE_H_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity.hpp>
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+#include <Maia/GameEngine/Spatial/Frustum.hpp>
+#include <Maia/GameEngine/Spatial/Ray.hpp>
+
+namespace Maia::GameEngine::Spatial
+{
+	struct Aabb_tree_proxy
+	{
+		std::size_t value;
+	};
+
+
+	// Bounding volume hierarchy where each leaf stores an entity and a fat AABB, which is the entity
+	// bounds expanded by a margin. Moving an entity only touches the tree when its bounds escape the fat AABB.
+	// Query results are conservative, as they are tested against the fat AABBs.
+	class Dynamic_aabb_tree
+	{
+	public:
+
+		static constexpr std::size_t null_node = std::numeric_limits<std::size_t>::max();
+
+		static constexpr float default_margin = 0.1f;
+
+
+		explicit Dynamic_aabb_tree(float margin = default_margin);
+
+
+		Aabb_tree_proxy insert(Aabb const& aabb, Entity entity);
+
+		void remove(Aabb_tree_proxy proxy);
+
+		// Returns true if the proxy was reinserted because aabb is not contained by its fat AABB.
+		bool move(Aabb_tree_proxy proxy, Aabb const& aabb);
+
+
+		Aabb const& get_fat_aabb(Aabb_tree_proxy proxy) const;
+
+		Entity get_entity(Aabb_tree_proxy proxy) const;
+
+		std::size_t size() const;
+
+		std::size_t height() const;
+
+		float margin() const;
+
+
+		template <typename Function>
+		void query(Aabb const& aabb, Function&& function) const
+		{
+			std::vector<std::size_t> stack;
+			query(aabb, stack, function);
+		}
+
+		template <typename Function>
+		void query(Frustum const& frustum, Function&& function) const
+		{
+			std::vector<std::size_t> stack;
+			query(frustum, stack, function);
+		}
+
+		template <typename Function>
+		void ray_cast(Ray const& ray, Function&& function) const
+		{
+			std::vector<std::size_t> stack;
+			ray_cast(ray, stack, function);
+		}
+
+		// Batched queries. The entities found by query i are stored in results[offsets[i]..offsets[i + 1]).
+		void query(gsl::span<Aabb const> aabbs, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const;
+		void query(gsl::span<Frustum const> frustums, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const;
+		void ray_cast(gsl::span<Ray const> rays, std::vector<Entity>& results, std::vector<std::size_t>& offsets) const;
+
+
+	private:
+
+		struct Node
+		{
+			Aabb aabb;
+			Entity entity;
+
+			// Next free node if the node is not in use.
+			std::size_t parent;
+			std::size_t child_0;
+			std::size_t child_1;
+
+			// 0 for leaves, -1 if the node is not in use.
+			int height;
+
+			bool is_leaf() const
+			{
+				return child_0 == null_node;
+			}
+		};
+
+
+		template <typename Overlaps_function, typename Function>
+		void traverse(std::vector<std::size_t>& stack, Overlaps_function&& overlaps, Function&& function) const
+		{
+			stack.clear();
+
+			if (m_root != null_node)
+			{
+				stack.push_back(m_root);
+			}
+
+			while (!stack.empty())
+			{
+				Node const& node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				if (overlaps(node.aabb))
+				{
+					if (node.is_leaf())
+					{
+						function(node.entity);
+					}
+					else
+					{
+						stack.push_back(node.child_0);
+						stack.push_back(node.child_1);
+					}
+				}
+			}
+		}
+
+		template <typename Function>
+		void query(Aabb const& aabb, std::vector<std::size_t>& stack, Function&& function) const
+		{
+			traverse(stack, [&aabb](Aabb const& node_aabb) -> bool { return intersects(aabb, node_aabb); }, function);
+		}
+
+		// Subtrees that are completely inside the frustum are reported without further plane tests.
+		// Nodes that are inside are pushed to the stack with their index negated as ~index.
+		template <typename Function>
+		void query(Frustum const& frustum, std::vector<std::size_t>& stack, Function&& function) const
+		{
+			stack.clear();
+
+			if (m_root != null_node)
+			{
+				stack.push_back(m_root);
+			}
+
+			while (!stack.empty())
+			{
+				std::size_t const stack_value = stack.back();
+				stack.pop_back();
+
+				bool const is_inside = stack_value >= m_nodes.size();
+				Node const& node = m_nodes[is_inside ? ~stack_value : stack_value];
+
+				Intersection const intersection = is_inside ? Intersection::Inside : classify(frustum, node.aabb);
+
+				if (intersection != Intersection::Outside)
+				{
+					if (node.is_leaf())
+					{
+						function(node.entity);
+					}
+					else if (intersection == Intersection::Inside)
+					{
+						stack.push_back(~node.child_0);
+						stack.push_back(~node.child_1);
+					}
+					else
+					{
+						stack.push_back(node.child_0);
+						stack.push_back(node.child_1);
+					}
+				}
+			}
+		}
+
+		template <typename Function>
+		void ray_cast(Ray const& ray, std::vector<std::size_t>& stack, Function&& function) const
+		{
+			traverse(stack, [&ray](Aabb const& node_aabb) -> bool { return intersects(ray, node_aabb); }, function);
+		}
+
+
+		std::size_t allocate_node();
+		void free_node(std::size_t node_index);
+
+		void insert_leaf(std::size_t leaf_index);
+		void remove_leaf(std::size_t leaf_index);
+
+		void refit(std::size_t node_index);
+		std::size_t balance(std::size_t node_index);
+
+
+		std::vector<Node> m_nodes;
+		std::size_t m_root;
+		std::size_t m_free_list;
+		std::size_t m_size;
+		float m_margin;
+
+	};
+}
+
+#endif
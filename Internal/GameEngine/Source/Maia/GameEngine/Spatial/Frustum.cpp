@@ -0,0 +1,73 @@
+#include "Frustum.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Maia::GameEngine::Spatial
+{
+	namespace
+	{
+		Plane normalize(Plane const& plane)
+		{
+			float const length = plane.head<3>().norm();
+
+			// The far plane of an infinite projection is at infinity and has no normal, so nothing is outside of it
+			if (length <= std::numeric_limits<float>::epsilon() * std::abs(plane(3)) || length == 0.0f)
+			{
+				return { 0.0f, 0.0f, 0.0f, std::numeric_limits<float>::infinity() };
+			}
+
+			return plane / length;
+		}
+	}
+
+	Frustum create_frustum(Eigen::Matrix4f const& view_projection_matrix)
+	{
+		Eigen::Vector4f const row_0 = view_projection_matrix.row(0).transpose();
+		Eigen::Vector4f const row_1 = view_projection_matrix.row(1).transpose();
+		Eigen::Vector4f const row_2 = view_projection_matrix.row(2).transpose();
+		Eigen::Vector4f const row_3 = view_projection_matrix.row(3).transpose();
+
+		return
+		{
+			{
+				normalize(row_3 + row_0),
+				normalize(row_3 - row_0),
+				normalize(row_3 + row_1),
+				normalize(row_3 - row_1),
+				normalize(row_2),
+				normalize(row_3 - row_2)
+			}
+		};
+	}
+
+	Intersection classify(Frustum const& frustum, Aabb const& aabb)
+	{
+		Eigen::Vector3f const aabb_center = center(aabb);
+		Eigen::Vector3f const aabb_extents = extents(aabb);
+
+		Intersection result = Intersection::Inside;
+
+		for (Plane const& plane : frustum.planes)
+		{
+			float const distance = plane.head<3>().dot(aabb_center) + plane(3);
+			float const radius = plane.head<3>().cwiseAbs().dot(aabb_extents);
+
+			if (distance + radius < 0.0f)
+			{
+				return Intersection::Outside;
+			}
+			else if (distance - radius < 0.0f)
+			{
+				result = Intersection::Intersecting;
+			}
+		}
+
+		return result;
+	}
+
+	bool intersects(Frustum const& frustum, Aabb const& aabb)
+	{
+		return classify(frustum, aabb) != Intersection::Outside;
+	}
+}
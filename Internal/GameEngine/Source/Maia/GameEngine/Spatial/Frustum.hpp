@@ -0,0 +1,39 @@
+#ifndef MAIA_GAMEENGINE_SPATIAL_FRUSTUM_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIAL_FRUSTUM_H_INCLUDED
+
+#include <array>
+
+#include <Eigen/Core>
+
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+
+namespace Maia::GameEngine::Spatial
+{
+	// Plane (a, b, c, d) where points with a*x + b*y + c*z + d >= 0 are inside.
+	using Plane = Eigen::Vector4f;
+
+	struct Frustum
+	{
+		// Left, right, bottom, top, near and far.
+		std::array<Plane, 6> planes;
+	};
+
+	// Extracts the normalized planes of view_projection_matrix, where clip = view_projection_matrix * position
+	// and the visible depth range is [0, w]. A plane at infinity, like the far plane of an infinite projection, is
+	// replaced by { 0, 0, 0, +infinity }, which every point is inside of.
+	Frustum create_frustum(Eigen::Matrix4f const& view_projection_matrix);
+
+
+	enum class Intersection
+	{
+		Outside,
+		Intersecting,
+		Inside
+	};
+
+	Intersection classify(Frustum const& frustum, Aabb const& aabb);
+
+	bool intersects(Frustum const& frustum, Aabb const& aabb);
+}
+
+#endif
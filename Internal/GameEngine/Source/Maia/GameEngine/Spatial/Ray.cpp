@@ -0,0 +1,31 @@
+#include "Ray.hpp"
+
+#include <algorithm>
+
+namespace Maia::GameEngine::Spatial
+{
+	std::optional<float> intersect(Ray const& ray, Aabb const& aabb)
+	{
+		Eigen::Array3f const inverse_direction = ray.direction.array().inverse();
+
+		Eigen::Array3f const t_0 = (aabb.minimum - ray.origin).array() * inverse_direction;
+		Eigen::Array3f const t_1 = (aabb.maximum - ray.origin).array() * inverse_direction;
+
+		float const t_enter = std::max(t_0.min(t_1).maxCoeff(), 0.0f);
+		float const t_exit = std::min(t_0.max(t_1).minCoeff(), ray.max_distance);
+
+		if (t_enter <= t_exit)
+		{
+			return t_enter;
+		}
+		else
+		{
+			return {};
+		}
+	}
+
+	bool intersects(Ray const& ray, Aabb const& aabb)
+	{
+		return intersect(ray, aabb).has_value();
+	}
+}
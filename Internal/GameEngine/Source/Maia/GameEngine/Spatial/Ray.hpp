@@ -0,0 +1,27 @@
+#ifndef MAIA_GAMEENGINE_SPATIAL_RAY_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIAL_RAY_H_INCLUDED
+
+#include <limits>
+#include <optional>
+
+#include <Eigen/Core>
+
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+
+namespace Maia::GameEngine::Spatial
+{
+	struct Ray
+	{
+		Eigen::Vector3f origin{ 0.0f, 0.0f, 0.0f };
+		Eigen::Vector3f direction{ 0.0f, 0.0f, 1.0f };
+		float max_distance{ std::numeric_limits<float>::max() };
+	};
+
+	// Returns the distance along the ray, in units of direction, at which the ray enters aabb.
+	// If the origin is inside aabb, the distance is 0.
+	std::optional<float> intersect(Ray const& ray, Aabb const& aabb);
+
+	bool intersects(Ray const& ray, Aabb const& aabb);
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include "Lod_selection_system.hpp"
+
+#include <cassert>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	using Components::World_bounds;
+
+
+	void Lod_selection_system::execute(
+		Entity_manager& entity_manager,
+		gsl::span<Entity_type_id const> const entity_type_ids,
+		gsl::span<Lod::Lod_group const> const lod_groups,
+		Eigen::Vector3f const& camera_position,
+		float const projection_scale
+	)
+	{
+		assert(entity_type_ids.size() == lod_groups.size());
+
+		gsl::span<Component_group_mask const> const component_types_groups =
+			entity_manager.get_component_types_groups();
+
+		for (std::ptrdiff_t entity_type_index = 0; entity_type_index < entity_type_ids.size(); ++entity_type_index)
+		{
+			Entity_type_id const entity_type_id = entity_type_ids[entity_type_index];
+
+			if (!component_types_groups[entity_type_id.value].contains<World_bounds, Lod_level>())
+			{
+				continue;
+			}
+
+			Lod::Lod_group const& lod_group = lod_groups[entity_type_index];
+			Component_group& component_group = entity_manager.get_component_group(entity_type_id);
+
+			for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+			{
+				gsl::span<World_bounds const> const world_bounds = component_group.components<World_bounds>(chunk_index);
+				gsl::span<Lod_level> const lod_levels = component_group.components<Lod_level>(chunk_index);
+				std::size_t const count = static_cast<std::size_t>(world_bounds.size());
+
+				m_projected_sizes.resize(count);
+				Lod::calculate_projected_sizes(world_bounds, camera_position, projection_scale, m_projected_sizes.data());
+
+				Lod::select_lod_levels(lod_group, m_projected_sizes.data(), count, lod_levels.data());
+			}
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef MAIA_GAMEENGINE_LODSELECTIONSYSTEM_H_INCLUDED
+#define MAIA_GAMEENGINE_LODSELECTIONSYSTEM_H_INCLUDED
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Entity_type.hpp>
+#include <Maia/GameEngine/Components/Lod_level.hpp>
+#include <Maia/GameEngine/Lod/Lod_selection.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	using Lod_level = Components::Lod_level;
+
+
+	// Updates the Lod_level of the entities of entity_type_ids[i] that have World_bounds and Lod_level with
+	// lod_groups[i], from the projected size of their bounds seen from camera_position.
+	class Lod_selection_system
+	{
+	public:
+
+		// See Lod::calculate_projection_scale.
+		void execute(
+			Entity_manager& entity_manager,
+			gsl::span<Entity_type_id const> entity_type_ids,
+			gsl::span<Lod::Lod_group const> lod_groups,
+			Eigen::Vector3f const& camera_position,
+			float projection_scale
+		);
+
+	private:
+
+		std::vector<float> m_projected_sizes;
+
+	};
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "Spatial_index_system.hpp"
+
+namespace Maia::GameEngine::Systems
+{
+	namespace
+	{
+		constexpr Spatial::Aabb_tree_proxy null_proxy{ Spatial::Dynamic_aabb_tree::null_node };
+	}
+
+	Spatial_index_system::Spatial_index_system(float const margin) :
+		m_tree{ margin },
+		m_proxies{}
+	{
+	}
+
+
+	void Spatial_index_system::execute(Entity_manager& entity_manager)
+	{
+		gsl::span<Component_group_mask const> const component_types_groups =
+			entity_manager.get_component_types_groups();
+
+		gsl::span<Component_group> const component_groups =
+			entity_manager.get_component_groups();
+
+		for (std::ptrdiff_t component_group_index = 0; component_group_index < component_groups.size(); ++component_group_index)
+		{
+			Component_group_mask const component_types = component_types_groups[component_group_index];
+
+			if (component_types.contains<Local_bounds, Transform_matrix, World_bounds>())
+			{
+				Component_group& component_group = component_groups[component_group_index];
+
+				for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+				{
+					gsl::span<Entity const> entities = component_group.components<Entity>(chunk_index);
+					gsl::span<World_bounds> world_bounds = component_group.components<World_bounds>(chunk_index);
+
+					transform_bounds(
+						component_group.components<Local_bounds>(chunk_index),
+						component_group.components<Transform_matrix>(chunk_index),
+						world_bounds
+					);
+
+					for (std::ptrdiff_t component_index = 0; component_index < entities.size(); ++component_index)
+					{
+						update(entities[component_index], world_bounds[component_index].value);
+					}
+				}
+			}
+		}
+	}
+
+	void Spatial_index_system::execute(Entity_manager& entity_manager, gsl::span<Entity const> const changed_entities)
+	{
+		World_bounds_system{}.execute(entity_manager, changed_entities);
+
+		for (Entity const entity : changed_entities)
+		{
+			if (entity_manager.exists(entity)
+				&& entity_manager.has_component<Local_bounds>(entity)
+				&& entity_manager.has_component<Transform_matrix>(entity)
+				&& entity_manager.has_component<World_bounds>(entity))
+			{
+				update(entity, entity_manager.get_component_data<World_bounds>(entity).value);
+			}
+		}
+	}
+
+	void Spatial_index_system::remove(Entity const entity)
+	{
+		if (contains(entity))
+		{
+			m_tree.remove(m_proxies[entity.value]);
+			m_proxies[entity.value] = null_proxy;
+		}
+	}
+
+
+	bool Spatial_index_system::contains(Entity const entity) const
+	{
+		return entity.value < m_proxies.size() && m_proxies[entity.value].value != null_proxy.value;
+	}
+
+	Spatial::Dynamic_aabb_tree const& Spatial_index_system::get_tree() const
+	{
+		return m_tree;
+	}
+
+
+	void Spatial_index_system::update(Entity const entity, Spatial::Aabb const& world_bounds)
+	{
+		if (contains(entity))
+		{
+			m_tree.move(m_proxies[entity.value], world_bounds);
+		}
+		else
+		{
+			if (entity.value >= m_proxies.size())
+			{
+				m_proxies.resize(entity.value + std::size_t{ 1 }, null_proxy);
+			}
+
+			m_proxies[entity.value] = m_tree.insert(world_bounds, entity);
+		}
+	}
+}
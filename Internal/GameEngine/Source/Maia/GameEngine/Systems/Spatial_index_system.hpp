@@ -0,0 +1,55 @@
+#ifndef MAIA_GAMEENGINE_SPATIALINDEXSYSTEM_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIALINDEXSYSTEM_H_INCLUDED
+
+#include <vector>
+
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity.hpp>
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Spatial/Dynamic_aabb_tree.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/GameEngine/Systems/World_bounds_system.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	// Keeps a Dynamic_aabb_tree with the World_bounds of every entity that has Local_bounds, Transform_matrix and World_bounds.
+	// Frame culling does not use it yet: Frustum_culling_system tests the World_bounds of every chunk, which are kept in
+	// spatial order by Spatial_sort_system. The tree is meant for queries such as ray casts.
+	class Spatial_index_system
+	{
+	public:
+
+		explicit Spatial_index_system(float margin = Spatial::Dynamic_aabb_tree::default_margin);
+
+
+		// Updates the World_bounds of every entity and moves them in the tree.
+		void execute(Entity_manager& entity_manager);
+
+		// Only updates changed_entities, for example the entities whose Transform_matrix changed this frame. Their World_bounds
+		// are updated by World_bounds_system.
+		void execute(Entity_manager& entity_manager, gsl::span<Entity const> changed_entities);
+
+		// Must be called before entity is destroyed.
+		void remove(Entity entity);
+
+
+		bool contains(Entity entity) const;
+
+		Spatial::Dynamic_aabb_tree const& get_tree() const;
+
+
+	private:
+
+		void update(Entity entity, Spatial::Aabb const& world_bounds);
+
+
+		Spatial::Dynamic_aabb_tree m_tree;
+
+		// Indexed by Entity.value
+		std::vector<Spatial::Aabb_tree_proxy> m_proxies;
+
+	};
+}
+
+#endif
@@ -0,0 +1,95 @@
+#include "Spatial_sort_system.hpp"
+
+#include <cstdint>
+
+#include <Maia/GameEngine/Morton_code.hpp>
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Spatial/Aabb.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	using Components::World_bounds;
+
+
+	namespace
+	{
+		bool is_sortable(Entity_manager const& entity_manager, Entity_type_id const entity_type_id)
+		{
+			return entity_manager.get_component_types_groups()[entity_type_id.value].contains<World_bounds>()
+				&& entity_manager.get_component_group(entity_type_id).size() > 1;
+		}
+
+		Spatial::Aabb calculate_bounds(Component_group const& component_group)
+		{
+			Spatial::Aabb bounds = component_group.get_component_data<World_bounds>({ 0 }).value;
+
+			for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+			{
+				for (World_bounds const& world_bounds : component_group.components<World_bounds>(chunk_index))
+				{
+					bounds = Spatial::merge(bounds, world_bounds.value);
+				}
+			}
+
+			return bounds;
+		}
+
+		auto create_morton_key_function(Spatial::Aabb const& bounds)
+		{
+			return [bounds](World_bounds const& world_bounds) -> std::uint32_t
+			{
+				return calculate_morton_code(Spatial::center(world_bounds.value), bounds.minimum, bounds.maximum);
+			};
+		}
+	}
+
+	void Spatial_sort_system::sort(Entity_manager& entity_manager, gsl::span<Entity_type_id const> const entity_type_ids)
+	{
+		for (Entity_type_id const entity_type_id : entity_type_ids)
+		{
+			if (!is_sortable(entity_manager, entity_type_id))
+			{
+				continue;
+			}
+
+			Spatial::Aabb const bounds = calculate_bounds(entity_manager.get_component_group(entity_type_id));
+			entity_manager.sort_entities<World_bounds>(entity_type_id, create_morton_key_function(bounds));
+		}
+	}
+
+	void Spatial_sort_system::execute(Entity_manager& entity_manager, gsl::span<Entity_type_id const> const entity_type_ids, std::size_t const max_num_swaps)
+	{
+		if (entity_type_ids.empty())
+		{
+			return;
+		}
+
+		if (!m_is_sorting)
+		{
+			m_next_entity_type_index %= static_cast<std::size_t>(entity_type_ids.size());
+			Entity_type_id const entity_type_id = entity_type_ids[m_next_entity_type_index];
+			++m_next_entity_type_index;
+
+			if (!is_sortable(entity_manager, entity_type_id))
+			{
+				return;
+			}
+
+			Spatial::Aabb const bounds = calculate_bounds(entity_manager.get_component_group(entity_type_id));
+			entity_manager.begin_sort_entities<World_bounds>(entity_type_id, create_morton_key_function(bounds), m_sort_state);
+			m_is_sorting = true;
+		}
+
+		if (entity_manager.continue_sort_entities(m_sort_state, max_num_swaps))
+		{
+			m_is_sorting = false;
+		}
+	}
+
+	void Spatial_sort_system::reset()
+	{
+		m_sort_state.sorted_entities.clear();
+		m_is_sorting = false;
+		m_next_entity_type_index = 0;
+	}
+}
@@ -0,0 +1,38 @@
+#ifndef MAIA_GAMEENGINE_SPATIALSORTSYSTEM_H_INCLUDED
+#define MAIA_GAMEENGINE_SPATIALSORTSYSTEM_H_INCLUDED
+
+#include <cstddef>
+
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Entity_type.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	// Sorts the entities of the given entity types that have World_bounds by the Morton code of the center of their
+	// bounds, so that entities that are close in space are close in memory and are culled and drawn together.
+	class Spatial_sort_system
+	{
+	public:
+
+		// Sorts every entity type at once, for example when a scene is loaded.
+		static void sort(Entity_manager& entity_manager, gsl::span<Entity_type_id const> entity_type_ids);
+
+		// Sorts one entity type at a time, moving at most max_num_swaps entities per call, so that entities that
+		// have moved since the last sort are put back in order over several frames.
+		void execute(Entity_manager& entity_manager, gsl::span<Entity_type_id const> entity_type_ids, std::size_t max_num_swaps);
+
+		// Drops the sort in progress. Must be called when the entity manager or the entity types change.
+		void reset();
+
+	private:
+
+		Entity_sort_state m_sort_state{};
+		bool m_is_sorting{ false };
+		std::size_t m_next_entity_type_index{ 0 };
+
+	};
+}
+
+#endif
@@ -1,7 +1,10 @@
 #include <Maia/GameEngine/Systems/Transform_system.hpp>
 
+#include <cassert>
 #include <iostream>
 
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
 namespace Maia::GameEngine::Systems
 {
 	Transform_matrix create_transform(Local_position const& position, Local_rotation const& rotation)
@@ -21,10 +24,11 @@ namespace Maia::GameEngine::Systems
 
 	Transforms_tree create_transforms_tree(
 		Entity_manager const& entity_manager,
-		Entity root_transform_entity
+		Entity root_transform_entity,
+		std::pmr::memory_resource* const memory_resource
 	)
 	{
-		Transforms_tree transforms_tree;
+		Transforms_tree transforms_tree{ memory_resource };
 
 		gsl::span<Component_group_mask const> const component_types_groups =
 			entity_manager.get_component_types_groups();
@@ -62,7 +66,7 @@ namespace Maia::GameEngine::Systems
 
 	namespace
 	{
-		using transforms_tree_iterator = std::unordered_multimap<Transform_parent, Entity>::const_iterator;
+		using transforms_tree_iterator = Transforms_tree::const_iterator;
 
 		void update_child_transforms_aux(
 			Entity_manager& entity_manager,
@@ -100,6 +104,111 @@ namespace Maia::GameEngine::Systems
 		update_child_transforms_aux(entity_manager, transforms_tree, root_transform_entity, root_transform_matrix, children_range);
 	}
 
+	Transform_hierarchy create_transform_hierarchy(
+		Entity_manager const& entity_manager
+	)
+	{
+		Transform_hierarchy transform_hierarchy;
+
+		gsl::span<Component_group_mask const> const component_types_groups =
+			entity_manager.get_component_types_groups();
+
+		gsl::span<Component_group const> const component_groups =
+			entity_manager.get_component_groups();
+
+		for (std::ptrdiff_t component_group_index = 0; component_group_index < component_groups.size(); ++component_group_index)
+		{
+			Component_group_mask const component_types = component_types_groups[component_group_index];
+
+			if (component_types.contains<Transform_parent>())
+			{
+				Component_group const& component_group = component_groups[component_group_index];
+
+				for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+				{
+					gsl::span<Transform_parent const> parents = component_group.components<Transform_parent>(chunk_index);
+					gsl::span<Entity const> entities = component_group.components<Entity>(chunk_index);
+
+					for (std::ptrdiff_t component_index = 0; component_index < parents.size(); ++component_index)
+					{
+						transform_hierarchy.set_parent(entities[component_index], parents[component_index].entity);
+					}
+				}
+			}
+		}
+
+		return transform_hierarchy;
+	}
+
+	void set_transform_parent(
+		Entity_manager& entity_manager,
+		Transform_hierarchy& transform_hierarchy,
+		Entity const child,
+		Entity const parent
+	)
+	{
+		assert(entity_manager.has_component<Transform_parent>(child) && entity_manager.has_component<Transform_root>(child));
+
+		Entity const root = entity_manager.has_component<Transform_root>(parent) ?
+			entity_manager.get_component_data<Transform_root>(parent).entity :
+			parent;
+
+		entity_manager.set_component_data(child, Transform_parent{ parent });
+		transform_hierarchy.set_parent(child, parent);
+
+		entity_manager.set_component_data(child, Transform_root{ root });
+		transform_hierarchy.for_each_descendant(child, [&entity_manager, root](Entity const entity, Entity) -> void
+		{
+			entity_manager.set_component_data(entity, Transform_root{ root });
+		});
+
+		assert(entity_manager.has_component<Transform_tree_dirty>(root));
+		entity_manager.set_component_data(root, Transform_tree_dirty{ true });
+	}
+
+	void destroy_transform_entity(
+		Entity_manager& entity_manager,
+		Transform_hierarchy& transform_hierarchy,
+		Entity const entity
+	)
+	{
+		Maia::Utilities::Scratch_scope scratch_scope;
+
+		std::pmr::vector<Entity> entities{ scratch_scope.resource() };
+		entities.push_back(entity);
+		transform_hierarchy.for_each_descendant(entity, [&entities](Entity const descendant, Entity) -> void
+		{
+			entities.push_back(descendant);
+		});
+
+		for (Entity const entity_to_destroy : entities)
+		{
+			transform_hierarchy.remove(entity_to_destroy);
+			entity_manager.destroy_entity(entity_to_destroy);
+		}
+	}
+
+	void update_child_transforms(
+		Entity_manager& entity_manager,
+		Transform_hierarchy const& transform_hierarchy,
+		Entity root_transform_entity,
+		Transform_matrix const& root_transform_matrix
+	)
+	{
+		entity_manager.set_component_data(root_transform_entity, root_transform_matrix);
+
+		transform_hierarchy.for_each_descendant(root_transform_entity, [&entity_manager](Entity const child_entity, Entity const parent_entity) -> void
+		{
+			Transform_matrix const parent_transform_matrix = entity_manager.get_component_data<Transform_matrix>(parent_entity);
+
+			auto const[position, rotation] = entity_manager.get_components_data<Local_position, Local_rotation>(child_entity);
+			Transform_matrix const local_transform_matrix = create_transform(position, rotation);
+
+			Transform_matrix const world_transform_matrix{ parent_transform_matrix.value * local_transform_matrix.value };
+			entity_manager.set_component_data(child_entity, world_transform_matrix);
+		});
+	}
+
 	namespace
 	{
 		void update_transform_tree(Entity_manager& entity_manager, Entity const root_entity, Local_position const root_position, Local_rotation const root_rotation)
@@ -107,55 +216,109 @@ namespace Maia::GameEngine::Systems
 			Transform_matrix const root_transform = create_transform(root_position, root_rotation);
 			entity_manager.set_component_data(root_entity, root_transform);
 
-			Transforms_tree const transforms_tree = create_transforms_tree(entity_manager, root_entity);
+			Maia::Utilities::Scratch_scope scratch_scope;
+			Transforms_tree const transforms_tree = create_transforms_tree(entity_manager, root_entity, scratch_scope.resource());
 
 			update_child_transforms(entity_manager, transforms_tree, root_entity, root_transform);
 		}
-	}
-	void Transform_system::execute(Entity_manager& entity_manager)
-	{
-		gsl::span<Component_group_mask const> const component_types_groups =
-			entity_manager.get_component_types_groups();
 
-		gsl::span<Component_group> const component_groups =
-			entity_manager.get_component_groups();
+		void update_transform_tree(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, Entity const root_entity, Local_position const root_position, Local_rotation const root_rotation)
+		{
+			Transform_matrix const root_transform = create_transform(root_position, root_rotation);
 
-		for (std::ptrdiff_t component_group_index = 0; component_group_index < component_groups.size(); ++component_group_index)
+			update_child_transforms(entity_manager, transform_hierarchy, root_entity, root_transform);
+		}
+
+		template <typename Update_function>
+		void update_dirty_transform_trees(Entity_manager& entity_manager, Update_function&& update_function)
 		{
-			Component_group_mask const component_types = component_types_groups[component_group_index];
+			gsl::span<Component_group_mask const> const component_types_groups =
+				entity_manager.get_component_types_groups();
+
+			gsl::span<Component_group> const component_groups =
+				entity_manager.get_component_groups();
 
-			if (component_types.contains<Transform_tree_dirty>())
+			for (std::ptrdiff_t component_group_index = 0; component_group_index < component_groups.size(); ++component_group_index)
 			{
-				Component_group& component_group = component_groups[component_group_index];
+				Component_group_mask const component_types = component_types_groups[component_group_index];
 
-				for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+				if (component_types.contains<Transform_tree_dirty>())
 				{
-					gsl::span<Entity const> entities
-						= component_group.components<Entity>(chunk_index);
+					Component_group& component_group = component_groups[component_group_index];
 
-					gsl::span<Local_position const> positions
-						= component_group.components<Local_position>(chunk_index);
+					for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+					{
+						gsl::span<Entity const> entities
+							= component_group.components<Entity>(chunk_index);
 
-					gsl::span<Local_rotation const> rotations
-						= component_group.components<Local_rotation>(chunk_index);
+						gsl::span<Local_position const> positions
+							= component_group.components<Local_position>(chunk_index);
 
-					gsl::span<Transform_tree_dirty> transform_trees_dirty 
-						= component_group.components<Transform_tree_dirty>(chunk_index);
+						gsl::span<Local_rotation const> rotations
+							= component_group.components<Local_rotation>(chunk_index);
 
-					for (std::ptrdiff_t component_index = 0; component_index < transform_trees_dirty.size(); ++component_index)
-					{
-						if (transform_trees_dirty[component_index].value)
+						gsl::span<Transform_tree_dirty> transform_trees_dirty 
+							= component_group.components<Transform_tree_dirty>(chunk_index);
+
+						for (std::ptrdiff_t component_index = 0; component_index < transform_trees_dirty.size(); ++component_index)
 						{
-							// TODO Create a new thread
+							if (transform_trees_dirty[component_index].value)
 							{
-								update_transform_tree(entity_manager, entities[component_index], positions[component_index], rotations[component_index]);
-							}
+								// TODO Create a new thread
+								{
+									update_function(entities[component_index], positions[component_index], rotations[component_index]);
+								}
 
-							transform_trees_dirty[component_index].value = false;
+								transform_trees_dirty[component_index].value = false;
+							}
 						}
 					}
 				}
 			}
 		}
 	}
+
+	namespace
+	{
+		template <typename Entities>
+		void update_dirty_transform_trees_and_append(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, Entities& changed_entities)
+		{
+			update_dirty_transform_trees(entity_manager, [&entity_manager, &transform_hierarchy, &changed_entities](Entity const root_entity, Local_position const root_position, Local_rotation const root_rotation) -> void
+			{
+				update_transform_tree(entity_manager, transform_hierarchy, root_entity, root_position, root_rotation);
+
+				changed_entities.push_back(root_entity);
+				transform_hierarchy.for_each_descendant(root_entity, [&changed_entities](Entity const entity, Entity) -> void
+				{
+					changed_entities.push_back(entity);
+				});
+			});
+		}
+	}
+
+	void Transform_system::execute(Entity_manager& entity_manager)
+	{
+		update_dirty_transform_trees(entity_manager, [&entity_manager](Entity const root_entity, Local_position const root_position, Local_rotation const root_rotation) -> void
+		{
+			update_transform_tree(entity_manager, root_entity, root_position, root_rotation);
+		});
+	}
+
+	void Transform_system::execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy)
+	{
+		update_dirty_transform_trees(entity_manager, [&entity_manager, &transform_hierarchy](Entity const root_entity, Local_position const root_position, Local_rotation const root_rotation) -> void
+		{
+			update_transform_tree(entity_manager, transform_hierarchy, root_entity, root_position, root_rotation);
+		});
+	}
+
+	void Transform_system::execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, std::vector<Entity>& changed_entities)
+	{
+		update_dirty_transform_trees_and_append(entity_manager, transform_hierarchy, changed_entities);
+	}
+
+	void Transform_system::execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, Maia::Utilities::Arena_vector<Entity>& changed_entities)
+	{
+		update_dirty_transform_trees_and_append(entity_manager, transform_hierarchy, changed_entities);
+	}
 }
@@ -4,14 +4,19 @@
 #include <deque>
 #include <functional>
 #include <future>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
 #include <Maia/GameEngine/Entity.hpp>
 #include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Transform_hierarchy.hpp>
 #include <Maia/GameEngine/Components/Local_position.hpp>
 #include <Maia/GameEngine/Components/Local_rotation.hpp>
+#include <Maia/Utilities/Allocators/Forward_allocator.hpp>
 
 namespace Maia::GameEngine::Systems
 {
@@ -61,7 +66,7 @@ namespace Maia::GameEngine::Systems
 		return outputStream;
 	}
 
-	using Transforms_tree = std::unordered_multimap<Transform_parent, Entity>;
+	using Transforms_tree = std::pmr::unordered_multimap<Transform_parent, Entity>;
 }
 
 namespace std
@@ -89,7 +94,8 @@ namespace Maia::GameEngine::Systems
 
 	Transforms_tree create_transforms_tree(
 		Entity_manager const& entity_manager,
-		Entity root_transform_entity
+		Entity root_transform_entity,
+		std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource()
 	);
 
 	void update_child_transforms(
@@ -99,6 +105,36 @@ namespace Maia::GameEngine::Systems
 		Transform_matrix const& root_transform_matrix
 	);
 
+	// Builds the hierarchy from the Transform_parent components of every entity.
+	Transform_hierarchy create_transform_hierarchy(
+		Entity_manager const& entity_manager
+	);
+
+	// Sets the Transform_parent of child and attaches it to parent in transform_hierarchy. The Transform_root of child
+	// and of its descendants is set to the root of parent, and the tree of that root is marked dirty.
+	// Setting the Transform_parent component directly leaves transform_hierarchy with the previous parent.
+	void set_transform_parent(
+		Entity_manager& entity_manager,
+		Transform_hierarchy& transform_hierarchy,
+		Entity child,
+		Entity parent
+	);
+
+	// Destroys entity and its descendants, and removes them from transform_hierarchy.
+	// Destroying them directly leaves links to their values in transform_hierarchy, which are then reused by new entities.
+	void destroy_transform_entity(
+		Entity_manager& entity_manager,
+		Transform_hierarchy& transform_hierarchy,
+		Entity entity
+	);
+
+	void update_child_transforms(
+		Entity_manager& entity_manager,
+		Transform_hierarchy const& transform_hierarchy,
+		Entity root_transform_entity,
+		Transform_matrix const& root_transform_matrix
+	);
+
 
 	class Transform_system
 	{
@@ -106,6 +142,13 @@ namespace Maia::GameEngine::Systems
 
 		void execute(Entity_manager& entity_manager);
 
+		void execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy);
+
+		// Appends to changed_entities every entity whose Transform_matrix was updated.
+		void execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, std::vector<Entity>& changed_entities);
+
+		void execute(Entity_manager& entity_manager, Transform_hierarchy const& transform_hierarchy, Maia::Utilities::Arena_vector<Entity>& changed_entities);
+
 		// void execute(ThreadPool& thread_pool, Entity_manager& entity_manager);
 		
 		// std::future<void> execute_async(Entity_manager& entity_manager);
@@ -0,0 +1,138 @@
+#include "World_bounds_system.hpp"
+
+#include <cassert>
+
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAIA_GAMEENGINE_WORLD_BOUNDS_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Maia::GameEngine::Systems
+{
+	void transform_bounds(
+		gsl::span<Local_bounds const> const local_bounds,
+		gsl::span<Transform_matrix const> const transform_matrices,
+		gsl::span<World_bounds> const world_bounds
+	)
+	{
+		assert(local_bounds.size() == transform_matrices.size());
+		assert(local_bounds.size() == world_bounds.size());
+
+#if defined(MAIA_GAMEENGINE_WORLD_BOUNDS_SSE)
+		__m128 const half = _mm_set1_ps(0.5f);
+		__m128 const sign_mask = _mm_set1_ps(-0.0f);
+
+		for (std::ptrdiff_t index = 0; index < local_bounds.size(); ++index)
+		{
+			Spatial::Aabb const& aabb = local_bounds[index].value;
+
+			__m128 const minimum = _mm_setr_ps(aabb.minimum.x(), aabb.minimum.y(), aabb.minimum.z(), 0.0f);
+			__m128 const maximum = _mm_setr_ps(aabb.maximum.x(), aabb.maximum.y(), aabb.maximum.z(), 0.0f);
+
+			__m128 const local_center = _mm_mul_ps(_mm_add_ps(maximum, minimum), half);
+			__m128 const local_extents = _mm_mul_ps(_mm_sub_ps(maximum, minimum), half);
+
+			// Eigen matrices are column major, so each column is 4 contiguous floats
+			float const* const matrix = transform_matrices[index].value.data();
+			__m128 const column_0 = _mm_loadu_ps(matrix);
+			__m128 const column_1 = _mm_loadu_ps(matrix + 4);
+			__m128 const column_2 = _mm_loadu_ps(matrix + 8);
+			__m128 const column_3 = _mm_loadu_ps(matrix + 12);
+
+			__m128 world_center = column_3;
+			world_center = _mm_add_ps(world_center, _mm_mul_ps(column_0, _mm_shuffle_ps(local_center, local_center, _MM_SHUFFLE(0, 0, 0, 0))));
+			world_center = _mm_add_ps(world_center, _mm_mul_ps(column_1, _mm_shuffle_ps(local_center, local_center, _MM_SHUFFLE(1, 1, 1, 1))));
+			world_center = _mm_add_ps(world_center, _mm_mul_ps(column_2, _mm_shuffle_ps(local_center, local_center, _MM_SHUFFLE(2, 2, 2, 2))));
+
+			__m128 world_extents = _mm_mul_ps(_mm_andnot_ps(sign_mask, column_0), _mm_shuffle_ps(local_extents, local_extents, _MM_SHUFFLE(0, 0, 0, 0)));
+			world_extents = _mm_add_ps(world_extents, _mm_mul_ps(_mm_andnot_ps(sign_mask, column_1), _mm_shuffle_ps(local_extents, local_extents, _MM_SHUFFLE(1, 1, 1, 1))));
+			world_extents = _mm_add_ps(world_extents, _mm_mul_ps(_mm_andnot_ps(sign_mask, column_2), _mm_shuffle_ps(local_extents, local_extents, _MM_SHUFFLE(2, 2, 2, 2))));
+
+			float world_minimum[4];
+			_mm_storeu_ps(world_minimum, _mm_sub_ps(world_center, world_extents));
+
+			float world_maximum[4];
+			_mm_storeu_ps(world_maximum, _mm_add_ps(world_center, world_extents));
+
+			world_bounds[index].value =
+			{
+				{ world_minimum[0], world_minimum[1], world_minimum[2] },
+				{ world_maximum[0], world_maximum[1], world_maximum[2] }
+			};
+		}
+#else
+		for (std::ptrdiff_t index = 0; index < local_bounds.size(); ++index)
+		{
+			world_bounds[index].value = Spatial::transform(local_bounds[index].value, transform_matrices[index].value);
+		}
+#endif
+	}
+
+
+	void World_bounds_system::execute(Entity_manager& entity_manager)
+	{
+		gsl::span<Component_group_mask const> const component_types_groups =
+			entity_manager.get_component_types_groups();
+
+		gsl::span<Component_group> const component_groups =
+			entity_manager.get_component_groups();
+
+		for (std::ptrdiff_t component_group_index = 0; component_group_index < component_groups.size(); ++component_group_index)
+		{
+			Component_group_mask const component_types = component_types_groups[component_group_index];
+
+			if (component_types.contains<Local_bounds, Transform_matrix, World_bounds>())
+			{
+				Component_group& component_group = component_groups[component_group_index];
+
+				for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+				{
+					transform_bounds(
+						component_group.components<Local_bounds>(chunk_index),
+						component_group.components<Transform_matrix>(chunk_index),
+						component_group.components<World_bounds>(chunk_index)
+					);
+				}
+			}
+		}
+	}
+
+	void World_bounds_system::execute(Entity_manager& entity_manager, gsl::span<Entity const> const changed_entities)
+	{
+		Maia::Utilities::Scratch_scope const scratch_scope;
+
+		// Changed entities are scattered between chunks, so their bounds are gathered to be transformed in a single batch
+		Maia::Utilities::Arena_vector<Entity> entities{ scratch_scope.allocator<Entity>() };
+		Maia::Utilities::Arena_vector<Local_bounds> local_bounds{ scratch_scope.allocator<Local_bounds>() };
+		Maia::Utilities::Arena_vector<Transform_matrix> transform_matrices{ scratch_scope.allocator<Transform_matrix>() };
+
+		entities.reserve(changed_entities.size());
+		local_bounds.reserve(changed_entities.size());
+		transform_matrices.reserve(changed_entities.size());
+
+		for (Entity const entity : changed_entities)
+		{
+			if (entity_manager.exists(entity)
+				&& entity_manager.has_component<Local_bounds>(entity)
+				&& entity_manager.has_component<Transform_matrix>(entity)
+				&& entity_manager.has_component<World_bounds>(entity))
+			{
+				auto const[entity_local_bounds, transform_matrix] = entity_manager.get_components_data<Local_bounds, Transform_matrix>(entity);
+
+				entities.push_back(entity);
+				local_bounds.push_back(entity_local_bounds);
+				transform_matrices.push_back(transform_matrix);
+			}
+		}
+
+		Maia::Utilities::Arena_vector<World_bounds> world_bounds{ entities.size(), World_bounds{}, scratch_scope.allocator<World_bounds>() };
+		transform_bounds(local_bounds, transform_matrices, world_bounds);
+
+		for (std::size_t index = 0; index < entities.size(); ++index)
+		{
+			entity_manager.set_component_data(entities[index], world_bounds[index]);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#ifndef MAIA_GAMEENGINE_WORLDBOUNDSSYSTEM_H_INCLUDED
+#define MAIA_GAMEENGINE_WORLDBOUNDSSYSTEM_H_INCLUDED
+
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity.hpp>
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Components/Local_bounds.hpp>
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+
+namespace Maia::GameEngine::Systems
+{
+	using Local_bounds = Components::Local_bounds;
+	using World_bounds = Components::World_bounds;
+
+
+	// Sets world_bounds[i] to local_bounds[i] transformed by transform_matrices[i].
+	void transform_bounds(
+		gsl::span<Local_bounds const> local_bounds,
+		gsl::span<Transform_matrix const> transform_matrices,
+		gsl::span<World_bounds> world_bounds
+	);
+
+
+	// Updates the World_bounds of the entities that have Local_bounds, Transform_matrix and World_bounds.
+	class World_bounds_system
+	{
+	public:
+
+		// Updates every entity, one chunk at a time.
+		void execute(Entity_manager& entity_manager);
+
+		// Only updates changed_entities, for example the ones reported by Transform_system. Their bounds are transformed
+		// by a single call to transform_bounds.
+		void execute(Entity_manager& entity_manager, gsl::span<Entity const> changed_entities);
+	};
+}
+
+#endif
@@ -0,0 +1,153 @@
+#include "Transform_hierarchy.hpp"
+
+#include <cassert>
+
+namespace Maia::GameEngine
+{
+	Transform_hierarchy::Node const Transform_hierarchy::s_empty_node{};
+
+
+	void Transform_hierarchy::set_parent(Entity const child, Entity const parent)
+	{
+		assert(child != parent);
+		assert(!is_ancestor(child, parent) && "Cycles are not allowed");
+
+		detach(child);
+
+		Node& parent_node = get_or_create_node(parent);
+		Entity const next_sibling = parent_node.first_child;
+		parent_node.first_child = child;
+
+		if (next_sibling != null_entity)
+		{
+			get_or_create_node(next_sibling).previous_sibling = child;
+		}
+
+		Node& child_node = get_or_create_node(child);
+		child_node.parent = parent;
+		child_node.next_sibling = next_sibling;
+		child_node.previous_sibling = null_entity;
+	}
+
+	void Transform_hierarchy::remove_parent(Entity const child)
+	{
+		detach(child);
+	}
+
+	void Transform_hierarchy::remove(Entity const entity)
+	{
+		if (entity.value >= m_nodes.size())
+		{
+			return;
+		}
+
+		detach(entity);
+
+		Entity child = m_nodes[entity.value].first_child;
+
+		while (child != null_entity)
+		{
+			Node& child_node = m_nodes[child.value];
+			Entity const next_sibling = child_node.next_sibling;
+
+			child_node.parent = null_entity;
+			child_node.next_sibling = null_entity;
+			child_node.previous_sibling = null_entity;
+
+			child = next_sibling;
+		}
+
+		m_nodes[entity.value].first_child = null_entity;
+	}
+
+
+	std::optional<Entity> Transform_hierarchy::get_parent(Entity const entity) const
+	{
+		Entity const parent = get_node(entity).parent;
+
+		if (parent != null_entity)
+		{
+			return parent;
+		}
+		else
+		{
+			return {};
+		}
+	}
+
+	bool Transform_hierarchy::has_children(Entity const entity) const
+	{
+		return get_node(entity).first_child != null_entity;
+	}
+
+	std::vector<Entity> Transform_hierarchy::get_children(Entity const parent) const
+	{
+		std::vector<Entity> children;
+		for_each_child(parent, [&children](Entity const child) -> void { children.push_back(child); });
+		return children;
+	}
+
+	bool Transform_hierarchy::is_ancestor(Entity const ancestor, Entity const entity) const
+	{
+		for (Entity current = get_node(entity).parent; current != null_entity; current = get_node(current).parent)
+		{
+			if (current == ancestor)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	Transform_hierarchy::Node const& Transform_hierarchy::get_node(Entity const entity) const
+	{
+		return entity.value < m_nodes.size() ? m_nodes[entity.value] : s_empty_node;
+	}
+
+	Transform_hierarchy::Node& Transform_hierarchy::get_or_create_node(Entity const entity)
+	{
+		assert(entity != null_entity);
+
+		if (entity.value >= m_nodes.size())
+		{
+			m_nodes.resize(entity.value + std::size_t{ 1 });
+		}
+
+		return m_nodes[entity.value];
+	}
+
+	void Transform_hierarchy::detach(Entity const child)
+	{
+		if (child.value >= m_nodes.size())
+		{
+			return;
+		}
+
+		Node& child_node = m_nodes[child.value];
+
+		if (child_node.parent == null_entity)
+		{
+			return;
+		}
+
+		if (child_node.previous_sibling != null_entity)
+		{
+			m_nodes[child_node.previous_sibling.value].next_sibling = child_node.next_sibling;
+		}
+		else
+		{
+			m_nodes[child_node.parent.value].first_child = child_node.next_sibling;
+		}
+
+		if (child_node.next_sibling != null_entity)
+		{
+			m_nodes[child_node.next_sibling.value].previous_sibling = child_node.previous_sibling;
+		}
+
+		child_node.parent = null_entity;
+		child_node.next_sibling = null_entity;
+		child_node.previous_sibling = null_entity;
+	}
+}
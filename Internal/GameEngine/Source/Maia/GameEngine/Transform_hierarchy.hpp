@@ -0,0 +1,103 @@
+#ifndef MAIA_GAMEENGINE_TRANSFORMHIERARCHY_H_INCLUDED
+#define MAIA_GAMEENGINE_TRANSFORMHIERARCHY_H_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <Maia/GameEngine/Entity.hpp>
+
+namespace Maia::GameEngine
+{
+	// Parent to children index stored as first-child/next-sibling links, indexed by Entity.value.
+	// Attaching, detaching and reparenting are O(1), and children and subtree traversals are O(visited entities).
+	class Transform_hierarchy
+	{
+	public:
+
+		static constexpr Entity null_entity{ std::numeric_limits<Entity::Integral_type>::max() };
+
+
+		// Attaches child to parent, detaching it from its previous parent if it had one.
+		void set_parent(Entity child, Entity parent);
+
+		void remove_parent(Entity child);
+
+		// Detaches entity from its parent and from its children. Must be called when entity is destroyed.
+		void remove(Entity entity);
+
+
+		std::optional<Entity> get_parent(Entity entity) const;
+
+		bool has_children(Entity entity) const;
+
+		std::vector<Entity> get_children(Entity parent) const;
+
+		bool is_ancestor(Entity ancestor, Entity entity) const;
+
+
+		template <typename Function>
+		void for_each_child(Entity const parent, Function&& function) const
+		{
+			for (Entity child = get_node(parent).first_child; child != null_entity; child = get_node(child).next_sibling)
+			{
+				function(child);
+			}
+		}
+
+		// Visits every descendant of root in depth-first pre-order, calling function(entity, parent_entity).
+		// A parent is always visited before its children.
+		template <typename Function>
+		void for_each_descendant(Entity const root, Function&& function) const
+		{
+			Entity entity = get_node(root).first_child;
+
+			while (entity != null_entity)
+			{
+				Node const& node = get_node(entity);
+				function(entity, node.parent);
+
+				if (node.first_child != null_entity)
+				{
+					entity = node.first_child;
+				}
+				else
+				{
+					while (entity != root && get_node(entity).next_sibling == null_entity)
+					{
+						entity = get_node(entity).parent;
+					}
+
+					entity = entity != root ? get_node(entity).next_sibling : null_entity;
+				}
+			}
+		}
+
+
+	private:
+
+		struct Node
+		{
+			Entity parent{ null_entity };
+			Entity first_child{ null_entity };
+			Entity next_sibling{ null_entity };
+			Entity previous_sibling{ null_entity };
+		};
+
+
+		Node const& get_node(Entity entity) const;
+		Node& get_or_create_node(Entity entity);
+
+		void detach(Entity child);
+
+
+		static Node const s_empty_node;
+
+		// Indexed by Entity.value
+		std::vector<Node> m_nodes;
+
+	};
+}
+
+#endif
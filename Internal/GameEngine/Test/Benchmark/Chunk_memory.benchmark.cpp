@@ -0,0 +1,191 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/Utilities/Allocators/Virtual_memory_arena.hpp>
+
+namespace Maia::GameEngine::Benchmark
+{
+	using Systems::Local_position;
+	using Systems::Transform_matrix;
+
+	namespace
+	{
+		// Counts the data TLB misses of the calling thread, if the kernel allows it.
+		class Dtlb_miss_counter
+		{
+		public:
+
+			Dtlb_miss_counter() noexcept
+			{
+#if defined(__linux__)
+				perf_event_attr attributes{};
+				attributes.type = PERF_TYPE_HW_CACHE;
+				attributes.size = sizeof(perf_event_attr);
+				attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+				attributes.disabled = 1;
+				attributes.exclude_kernel = 1;
+				attributes.exclude_hv = 1;
+
+				m_file_descriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+			}
+			Dtlb_miss_counter(Dtlb_miss_counter const&) = delete;
+
+			~Dtlb_miss_counter() noexcept
+			{
+#if defined(__linux__)
+				if (m_file_descriptor >= 0)
+				{
+					close(m_file_descriptor);
+				}
+#endif
+			}
+
+			Dtlb_miss_counter& operator=(Dtlb_miss_counter const&) = delete;
+
+
+			void start() noexcept
+			{
+#if defined(__linux__)
+				if (m_file_descriptor >= 0)
+				{
+					ioctl(m_file_descriptor, PERF_EVENT_IOC_RESET, 0);
+					ioctl(m_file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+				}
+#endif
+			}
+
+			std::optional<std::uint64_t> stop() noexcept
+			{
+#if defined(__linux__)
+				std::uint64_t count = 0;
+
+				if (m_file_descriptor >= 0)
+				{
+					ioctl(m_file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+					if (read(m_file_descriptor, &count, sizeof(count)) == sizeof(count))
+					{
+						return count;
+					}
+				}
+#endif
+				return std::nullopt;
+			}
+
+		private:
+
+			int m_file_descriptor = -1;
+
+		};
+
+		// Creates the entities one chunk at a time. With interleave_allocations, heap allocations of random sizes are
+		// made between the chunks, like the other allocations of a running game would.
+		Entity_type_id create_entities(Entity_manager& entity_manager, std::size_t const count, bool const interleave_allocations, std::vector<std::unique_ptr<std::byte[]>>& other_allocations)
+		{
+			constexpr std::size_t capacity_per_chunk = 64;
+
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<Local_position, Transform_matrix, Entity>(capacity_per_chunk, Space{ 0 });
+
+			std::mt19937 random_engine{ 0 };
+			std::uniform_int_distribution<std::size_t> size_distribution{ 64, 64 * 1024 };
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				entity_manager.create_entity(entity_type_id, Local_position{ { static_cast<float>(index), 0.0f, 0.0f } }, Transform_matrix{});
+
+				if (interleave_allocations && index % capacity_per_chunk == 0)
+				{
+					other_allocations.push_back(std::make_unique<std::byte[]>(size_distribution(random_engine)));
+				}
+			}
+
+			return entity_type_id;
+		}
+
+		// Writes the translation of every Transform_matrix from its Local_position.
+		void sweep(Entity_manager& entity_manager, Entity_type_id const entity_type_id)
+		{
+			Component_group& component_group = entity_manager.get_component_group(entity_type_id);
+
+			for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+			{
+				gsl::span<Local_position const> const positions = component_group.components<Local_position>(chunk_index);
+				gsl::span<Transform_matrix> const transform_matrices = component_group.components<Transform_matrix>(chunk_index);
+
+				for (std::ptrdiff_t index = 0; index < positions.size(); ++index)
+				{
+					transform_matrices[index].value.block<3, 1>(0, 3) = positions[index].value;
+				}
+			}
+		}
+
+		void benchmark_sweep(benchmark::State& state, std::pmr::memory_resource* const chunk_memory_resource, bool const interleave_allocations)
+		{
+			std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+			std::vector<std::unique_ptr<std::byte[]>> other_allocations;
+			Entity_manager entity_manager{ chunk_memory_resource };
+			Entity_type_id const entity_type_id = create_entities(entity_manager, count, interleave_allocations, other_allocations);
+
+			Dtlb_miss_counter dtlb_miss_counter;
+			std::uint64_t dtlb_misses = 0;
+			bool dtlb_misses_counted = true;
+
+			for (auto _ : state)
+			{
+				dtlb_miss_counter.start();
+
+				sweep(entity_manager, entity_type_id);
+				benchmark::ClobberMemory();
+
+				std::optional<std::uint64_t> const iteration_dtlb_misses = dtlb_miss_counter.stop();
+				dtlb_misses_counted &= iteration_dtlb_misses.has_value();
+				dtlb_misses += iteration_dtlb_misses.value_or(0);
+			}
+
+			state.SetItemsProcessed(state.iterations() * count);
+
+			if (dtlb_misses_counted)
+			{
+				state.counters["dtlb_misses_per_sweep"] = benchmark::Counter(static_cast<double>(dtlb_misses), benchmark::Counter::kAvgIterations);
+			}
+		}
+	}
+
+	void sweep_heap_chunks(benchmark::State& state)
+	{
+		benchmark_sweep(state, std::pmr::new_delete_resource(), true);
+	}
+	BENCHMARK(sweep_heap_chunks)->Arg(1 << 20);
+
+	void sweep_virtual_memory_chunks(benchmark::State& state)
+	{
+		Maia::Utilities::Virtual_memory_arena arena{ 1024 * 1024 * 1024, false };
+		benchmark_sweep(state, &arena, true);
+	}
+	BENCHMARK(sweep_virtual_memory_chunks)->Arg(1 << 20);
+
+	void sweep_virtual_memory_chunks_with_huge_pages(benchmark::State& state)
+	{
+		Maia::Utilities::Virtual_memory_arena arena{ 1024 * 1024 * 1024, true };
+		benchmark_sweep(state, &arena, true);
+	}
+	BENCHMARK(sweep_virtual_memory_chunks_with_huge_pages)->Arg(1 << 20);
+}
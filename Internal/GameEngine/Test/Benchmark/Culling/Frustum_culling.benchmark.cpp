@@ -0,0 +1,158 @@
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+
+namespace Maia::GameEngine::Culling::Benchmark
+{
+	using Components::World_bounds;
+	using Systems::Transform_matrix;
+
+	namespace
+	{
+		Spatial::Frustum create_benchmark_frustum()
+		{
+			float const near_z = 0.25f;
+			float const far_z = 100.0f;
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			return Spatial::create_frustum(projection_matrix);
+		}
+
+		struct Aabbs_soa
+		{
+			std::vector<float> center_x, center_y, center_z;
+			std::vector<float> extents_x, extents_y, extents_z;
+
+			Aabbs_view view() const
+			{
+				return { center_x.data(), center_y.data(), center_z.data(), extents_x.data(), extents_y.data(), extents_z.data() };
+			}
+		};
+
+		Aabbs_soa create_random_aabbs(std::size_t const count)
+		{
+			std::mt19937 random_engine{ 0 };
+			std::uniform_real_distribution<float> position_distribution{ -100.0f, 100.0f };
+			std::uniform_real_distribution<float> extents_distribution{ 0.1f, 1.0f };
+
+			Aabbs_soa aabbs;
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				aabbs.center_x.push_back(position_distribution(random_engine));
+				aabbs.center_y.push_back(position_distribution(random_engine));
+				aabbs.center_z.push_back(position_distribution(random_engine));
+				aabbs.extents_x.push_back(extents_distribution(random_engine));
+				aabbs.extents_y.push_back(extents_distribution(random_engine));
+				aabbs.extents_z.push_back(extents_distribution(random_engine));
+			}
+
+			return aabbs;
+		}
+
+		template <typename Cull_function>
+		void benchmark_kernel(benchmark::State& state, Cull_function&& cull_function)
+		{
+			std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+			Culling_planes const planes = create_culling_planes(create_benchmark_frustum());
+			Aabbs_soa const aabbs = create_random_aabbs(count);
+			std::vector<std::uint32_t> visible_indices(count);
+
+			for (auto _ : state)
+			{
+				std::size_t const num_visible = cull_function(planes, aabbs.view(), count, visible_indices.data());
+				benchmark::DoNotOptimize(num_visible);
+				benchmark::ClobberMemory();
+			}
+
+			state.SetItemsProcessed(state.iterations() * count);
+		}
+	}
+
+	void cull_aabbs_scalar(benchmark::State& state)
+	{
+		benchmark_kernel(state, [](auto&&... arguments) -> std::size_t { return Culling::cull_aabbs_scalar(arguments...); });
+	}
+	BENCHMARK(cull_aabbs_scalar)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+	void cull_aabbs_sse(benchmark::State& state)
+	{
+		if (!Culling::is_supported(Culling::Culling_instruction_set::SSE))
+		{
+			state.SkipWithError("SSE is not supported");
+			return;
+		}
+
+		benchmark_kernel(state, [](auto&&... arguments) -> std::size_t { return Culling::cull_aabbs(Culling::Culling_instruction_set::SSE, arguments...); });
+	}
+	BENCHMARK(cull_aabbs_sse)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+	void cull_aabbs_avx(benchmark::State& state)
+	{
+		if (!Culling::is_supported(Culling::Culling_instruction_set::AVX))
+		{
+			state.SkipWithError("AVX is not supported");
+			return;
+		}
+
+		benchmark_kernel(state, [](auto&&... arguments) -> std::size_t { return Culling::cull_aabbs(Culling::Culling_instruction_set::AVX, arguments...); });
+	}
+	BENCHMARK(cull_aabbs_avx)->Arg(1024)->Arg(64 * 1024)->Arg(1024 * 1024);
+
+
+	void frustum_culling_system(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+		std::size_t const num_threads = static_cast<std::size_t>(state.range(1));
+
+		Entity_manager entity_manager;
+		Entity_type_id const entity_type_id = entity_manager.create_entity_type<Transform_matrix, World_bounds, Entity>(256, Space{ 0 });
+
+		{
+			std::mt19937 random_engine{ 0 };
+			std::uniform_real_distribution<float> position_distribution{ -100.0f, 100.0f };
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Eigen::Vector3f const position{ position_distribution(random_engine), position_distribution(random_engine), position_distribution(random_engine) };
+				Eigen::Vector3f const extents{ 0.5f, 0.5f, 0.5f };
+
+				entity_manager.create_entity(entity_type_id, Transform_matrix{}, World_bounds{ { position - extents, position + extents } });
+			}
+		}
+
+		Spatial::Frustum const frustum = create_benchmark_frustum();
+		std::vector<Entity_type_id> const entity_type_ids{ entity_type_id };
+
+		Maia::Utilities::Worker_threads worker_threads{ num_threads };
+		Frustum_culling_system culling_system{ worker_threads };
+		Visible_instances visible_instances;
+
+		for (auto _ : state)
+		{
+			culling_system.execute(entity_manager, entity_type_ids, frustum, visible_instances);
+			benchmark::DoNotOptimize(visible_instances.counts.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(frustum_culling_system)
+		->Args({ 64 * 1024, 1 })
+		->Args({ 64 * 1024, 4 })
+		->Args({ 256 * 1024, 1 })
+		->Args({ 256 * 1024, 4 })
+		->UseRealTime();
+}
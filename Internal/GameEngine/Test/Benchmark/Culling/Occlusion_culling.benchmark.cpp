@@ -0,0 +1,159 @@
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+
+namespace Maia::GameEngine::Culling::Benchmark
+{
+	using Components::World_bounds;
+	using Systems::Transform_matrix;
+
+	namespace
+	{
+		Eigen::Matrix4f create_benchmark_projection()
+		{
+			float const near_z = 0.25f;
+			float const far_z = 100.0f;
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			return projection_matrix;
+		}
+
+		// A corridor of walls made of boxes of 12 triangles, like the occluders of an indoor scene
+		std::vector<Occluder> create_walls(std::size_t const count)
+		{
+			std::mt19937 random_engine{ 0 };
+			std::uniform_real_distribution<float> x_distribution{ -20.0f, 20.0f };
+			std::uniform_real_distribution<float> z_distribution{ 5.0f, 30.0f };
+
+			std::vector<Occluder> occluders;
+			occluders.reserve(count);
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Eigen::Vector3f const center{ x_distribution(random_engine), 0.0f, z_distribution(random_engine) };
+				Eigen::Vector3f const extents{ 4.0f, 10.0f, 0.25f };
+
+				Occluder occluder;
+
+				for (std::size_t corner_index = 0; corner_index < 8; ++corner_index)
+				{
+					occluder.vertices.push_back(center + Eigen::Vector3f
+					{
+						(corner_index & 1) ? extents(0) : -extents(0),
+						(corner_index & 2) ? extents(1) : -extents(1),
+						(corner_index & 4) ? extents(2) : -extents(2)
+					});
+				}
+
+				occluder.indices =
+				{
+					0, 1, 3, 0, 3, 2,
+					4, 6, 7, 4, 7, 5,
+					0, 2, 6, 0, 6, 4,
+					1, 5, 7, 1, 7, 3,
+					0, 4, 5, 0, 5, 1,
+					2, 3, 7, 2, 7, 6
+				};
+
+				occluders.push_back(std::move(occluder));
+			}
+
+			return occluders;
+		}
+	}
+
+	void occlusion_buffer_render(benchmark::State& state)
+	{
+		std::size_t const num_occluders = static_cast<std::size_t>(state.range(0));
+		std::size_t const num_threads = static_cast<std::size_t>(state.range(1));
+
+		std::vector<Occluder> const occluders = create_walls(num_occluders);
+		Maia::Utilities::Worker_threads worker_threads{ num_threads };
+		Occlusion_buffer occlusion_buffer{ 256, 128, worker_threads };
+
+		for (auto _ : state)
+		{
+			occlusion_buffer.render(occluders, create_benchmark_projection());
+			benchmark::ClobberMemory();
+		}
+
+		state.counters["triangles"] = static_cast<double>(occlusion_buffer.num_rasterized_triangles());
+	}
+	BENCHMARK(occlusion_buffer_render)
+		->Args({ 64, 1 })
+		->Args({ 64, 4 })
+		->Args({ 512, 1 })
+		->Args({ 512, 4 })
+		->Unit(benchmark::kMillisecond)
+		->UseRealTime();
+
+
+	void occlusion_culling_system(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+		std::size_t const num_threads = static_cast<std::size_t>(state.range(1));
+
+		Entity_manager entity_manager;
+		Entity_type_id const entity_type_id = entity_manager.create_entity_type<Transform_matrix, World_bounds, Entity>(256, Space{ 0 });
+
+		{
+			std::mt19937 random_engine{ 1 };
+			std::uniform_real_distribution<float> x_distribution{ -40.0f, 40.0f };
+			std::uniform_real_distribution<float> y_distribution{ -8.0f, 8.0f };
+			std::uniform_real_distribution<float> z_distribution{ 1.0f, 80.0f };
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Eigen::Vector3f const position{ x_distribution(random_engine), y_distribution(random_engine), z_distribution(random_engine) };
+				Eigen::Vector3f const extents{ 0.5f, 0.5f, 0.5f };
+
+				entity_manager.create_entity(entity_type_id, Transform_matrix{}, World_bounds{ { position - extents, position + extents } });
+			}
+		}
+
+		std::vector<Occluder> const occluders = create_walls(64);
+		Eigen::Matrix4f const view_projection = create_benchmark_projection();
+		Spatial::Frustum const frustum = Spatial::create_frustum(view_projection);
+		std::vector<Entity_type_id> const entity_type_ids{ entity_type_id };
+
+		Maia::Utilities::Worker_threads worker_threads{ num_threads };
+		Occlusion_buffer occlusion_buffer{ 256, 128, worker_threads };
+		Frustum_culling_system culling_system{ worker_threads };
+		Visible_instances visible_instances;
+
+		for (auto _ : state)
+		{
+			occlusion_buffer.render(occluders, view_projection);
+			culling_system.execute(entity_manager, entity_type_ids, frustum, occlusion_buffer, visible_instances);
+			benchmark::DoNotOptimize(visible_instances.counts.data());
+			benchmark::ClobberMemory();
+		}
+
+		culling_system.execute(entity_manager, entity_type_ids, frustum, visible_instances);
+		std::size_t const num_in_frustum = visible_instances.counts[0];
+
+		culling_system.execute(entity_manager, entity_type_ids, frustum, occlusion_buffer, visible_instances);
+		std::size_t const num_visible = visible_instances.counts[0];
+
+		state.counters["frustum_cull_rate"] = 1.0 - static_cast<double>(num_in_frustum) / static_cast<double>(count);
+		state.counters["occlusion_cull_rate"] = num_in_frustum > 0 ? 1.0 - static_cast<double>(num_visible) / static_cast<double>(num_in_frustum) : 0.0;
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(occlusion_culling_system)
+		->Args({ 64 * 1024, 1 })
+		->Args({ 64 * 1024, 4 })
+		->Unit(benchmark::kMillisecond)
+		->UseRealTime();
+}
@@ -1,13 +1,24 @@
+#include <cstdint>
 #include <optional>
+#include <memory_resource>
 
 #include <catch2/catch.hpp>
 
 #include <Test_components.hpp>
 
 #include <Maia/GameEngine/Component_group.hpp>
+#include <Maia/Utilities/Allocators/Virtual_memory_arena.hpp>
 
 namespace Maia::GameEngine::Test
 {
+	namespace
+	{
+		struct alignas(16) Aligned_rotation
+		{
+			float a, b, c, w;
+		};
+	}
+
 	SCENARIO("Create a component group, add, remove and set components", "[Component_group]")
 	{
 		GIVEN("A component group consisting of Position and Rotation components and capacity per chunk equals 2 elements")
@@ -273,4 +284,224 @@ namespace Maia::GameEngine::Test
 			}
 		}
 	}
+
+	SCENARIO("Release the empty chunks of a component group to a chunk pool", "[Component_group]")
+	{
+		GIVEN("A component group with capacity per chunk equals 2 elements and a chunk pool")
+		{
+			Component_group component_group{ make_component_group<Entity, Position>(2) };
+			Components_chunk_pool chunk_pool;
+
+			WHEN("Five elements are pushed back and four of them are erased")
+			{
+				component_group.reserve(5, chunk_pool);
+
+				for (Entity::Integral_type index = 0; index < 5; ++index)
+				{
+					component_group.push_back(Entity{ index }, Position{ static_cast<float>(index), 0.0f, 0.0f });
+				}
+
+				component_group.erase({ 4 });
+				component_group.erase({ 3 });
+				component_group.erase({ 0 });
+				component_group.erase({ 1 });
+
+				THEN("Two trailing chunks are empty")
+				{
+					CHECK(component_group.num_chunks() == 3);
+					CHECK(component_group.num_empty_chunks() == 2);
+				}
+
+				THEN("The components of the empty chunks are empty spans")
+				{
+					CHECK(component_group.components<Position>(0).size() == 1);
+					CHECK(component_group.components<Position>(1).size() == 0);
+					CHECK(component_group.components<Position>(2).size() == 0);
+				}
+
+				AND_WHEN("At most one empty chunk is released")
+				{
+					std::size_t const released_chunks = component_group.release_empty_chunks(chunk_pool, 1);
+
+					THEN("Only one chunk is moved to the pool")
+					{
+						CHECK(released_chunks == 1);
+						CHECK(component_group.num_chunks() == 2);
+						CHECK(chunk_pool.num_chunks() == 1);
+						CHECK(chunk_pool.size_in_bytes() == component_group.chunk_size_in_bytes());
+					}
+				}
+
+				AND_WHEN("All empty chunks are released")
+				{
+					std::size_t const released_chunks = component_group.release_empty_chunks(chunk_pool, component_group.num_chunks());
+
+					THEN("The remaining element is kept")
+					{
+						CHECK(released_chunks == 2);
+						CHECK(component_group.size() == 1);
+						CHECK(component_group.capacity() == 2);
+						CHECK(component_group.get_component_data<Entity>({ 0 }) == Entity{ 2 });
+						CHECK(component_group.get_component_data<Position>({ 0 }) == Position{ 2.0f, 0.0f, 0.0f });
+					}
+
+					AND_WHEN("The component group grows again using the pool")
+					{
+						component_group.reserve(4, chunk_pool);
+
+						THEN("The chunks are reused instead of allocated")
+						{
+							CHECK(component_group.num_chunks() == 2);
+							CHECK(chunk_pool.num_chunks() == 1);
+						}
+					}
+
+					AND_WHEN("The pool is trimmed to the size of one chunk")
+					{
+						chunk_pool.set_max_size_in_bytes(component_group.chunk_size_in_bytes());
+						chunk_pool.trim();
+
+						THEN("Only one chunk is kept")
+						{
+							CHECK(chunk_pool.num_chunks() == 1);
+							CHECK(chunk_pool.size_in_bytes() == component_group.chunk_size_in_bytes());
+						}
+					}
+
+					AND_WHEN("A chunk of another size is released after them and the component group grows again")
+					{
+						chunk_pool.release(Components_chunk{ 3 * component_group.chunk_size_in_bytes() });
+						component_group.reserve(4, chunk_pool);
+
+						THEN("A chunk of the size of the group is reused and the other one is kept")
+						{
+							CHECK(component_group.num_chunks() == 2);
+							CHECK(chunk_pool.num_chunks() == 2);
+							CHECK(chunk_pool.size_in_bytes() == 4 * component_group.chunk_size_in_bytes());
+						}
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Allocate the chunks of a component group from a memory resource", "[Component_group]")
+	{
+		GIVEN("A component group whose chunks are allocated from a virtual memory arena")
+		{
+			Maia::Utilities::Virtual_memory_arena arena{ 1024 * 1024, false };
+			Component_group component_group{ make_component_group<Entity, Position>(2, &arena) };
+
+			WHEN("Elements are pushed back without a chunk pool")
+			{
+				for (Entity::Integral_type index = 0; index < 3; ++index)
+				{
+					component_group.push_back(Entity{ index }, Position{ static_cast<float>(index), 0.0f, 0.0f });
+				}
+
+				THEN("The chunks are allocated from the arena")
+				{
+					REQUIRE(component_group.num_chunks() == 2);
+					CHECK(reinterpret_cast<std::byte const*>(component_group.components<Entity>(0).data()) >= arena.data());
+					CHECK(reinterpret_cast<std::byte const*>(component_group.components<Entity>(1).data()) < arena.data() + arena.used_size());
+				}
+
+				AND_WHEN("The elements are erased and the group is shrunk")
+				{
+					component_group.pop_back();
+					component_group.pop_back();
+					component_group.pop_back();
+					component_group.shrink_to_fit();
+
+					THEN("The chunks are deallocated to the arena")
+					{
+						CHECK(component_group.num_chunks() == 0);
+						CHECK(arena.free_size() >= 2 * component_group.chunk_size_in_bytes());
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Reorder the elements of a component group", "[Component_group]")
+	{
+		GIVEN("A component group with capacity per chunk equals 2 elements and 5 elements")
+		{
+			Component_group component_group{ make_component_group<Entity, Position>(2) };
+
+			for (Entity::Integral_type index = 0; index < 5; ++index)
+			{
+				component_group.push_back(Entity{ index }, Position{ static_cast<float>(index), 0.0f, 0.0f });
+			}
+
+			WHEN("Elements 0 and 3 are swapped")
+			{
+				component_group.swap({ 0 }, { 3 });
+
+				THEN("All components of both elements are swapped")
+				{
+					CHECK(component_group.get_component_data<Entity>({ 0 }) == Entity{ 3 });
+					CHECK(component_group.get_component_data<Position>({ 0 }) == Position{ 3.0f, 0.0f, 0.0f });
+					CHECK(component_group.get_component_data<Entity>({ 3 }) == Entity{ 0 });
+					CHECK(component_group.get_component_data<Position>({ 3 }) == Position{ 0.0f, 0.0f, 0.0f });
+				}
+			}
+
+			WHEN("The permutation { 4, 2, 0, 3, 1 } is applied")
+			{
+				std::array<std::size_t, 5> const permutation{ 4, 2, 0, 3, 1 };
+				component_group.apply_permutation(permutation);
+
+				THEN("Each element is moved from its permuted position")
+				{
+					for (std::size_t index = 0; index < permutation.size(); ++index)
+					{
+						Entity::Integral_type const expected = static_cast<Entity::Integral_type>(permutation[index]);
+
+						CHECK(component_group.get_component_data<Entity>({ index }) == Entity{ expected });
+						CHECK(component_group.get_component_data<Position>({ index }) == Position{ static_cast<float>(expected), 0.0f, 0.0f });
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Align the component columns of a component group", "[Component_group]")
+	{
+		GIVEN("A component group of Entity and a 16 bytes aligned component with capacity per chunk equals 3 elements")
+		{
+			Component_group component_group{ make_component_group<Entity, Aligned_rotation>(3) };
+
+			THEN("The column of the aligned component starts at an aligned offset")
+			{
+				gsl::span<Component_type_info const> const type_infos = component_group.component_type_infos();
+				REQUIRE(type_infos.size() == 2);
+
+				CHECK(type_infos[1].offset == 16);
+				CHECK(component_group.chunk_size_in_bytes() == 16 + 3 * sizeof(Aligned_rotation));
+			}
+
+			WHEN("Elements that fill two chunks are pushed back")
+			{
+				for (Entity::Integral_type index = 0; index < 6; ++index)
+				{
+					component_group.push_back(Entity{ index }, Aligned_rotation{ static_cast<float>(index), 0.0f, 0.0f, 1.0f });
+				}
+
+				THEN("Every aligned component is at an aligned address")
+				{
+					for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
+					{
+						for (Aligned_rotation const& rotation : component_group.components<Aligned_rotation>(chunk_index))
+						{
+							CHECK(reinterpret_cast<std::uintptr_t>(&rotation) % alignof(Aligned_rotation) == 0);
+						}
+					}
+
+					CHECK(component_group.get_component_data<Entity>({ 5 }) == Entity{ 5 });
+					CHECK(component_group.get_component_data<Aligned_rotation>({ 5 }).a == 5.0f);
+				}
+			}
+		}
+	}
 }
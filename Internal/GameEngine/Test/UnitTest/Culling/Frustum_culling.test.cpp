@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+
+namespace Maia::GameEngine::Culling::Test
+{
+	using Components::World_bounds;
+	using Systems::Transform_matrix;
+
+	namespace
+	{
+		Eigen::Matrix4f create_perspective_projection(float const near_z, float const far_z)
+		{
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			return projection_matrix;
+		}
+
+		Eigen::Matrix4f create_infinite_perspective_projection(float const near_z)
+		{
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, -near_z,
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			return projection_matrix;
+		}
+
+		Spatial::Frustum create_test_frustum()
+		{
+			return Spatial::create_frustum(create_perspective_projection(1.0f, 50.0f));
+		}
+
+		// AABBs in structure of arrays layout.
+		struct Random_aabbs
+		{
+			Random_aabbs(std::size_t const count, unsigned int const seed) :
+				count{ count }
+			{
+				std::mt19937 random_engine{ seed };
+				std::uniform_real_distribution<float> position_distribution{ -60.0f, 60.0f };
+				std::uniform_real_distribution<float> extents_distribution{ 0.0f, 2.0f };
+
+				for (std::size_t index = 0; index < count; ++index)
+				{
+					center_x.push_back(position_distribution(random_engine));
+					center_y.push_back(position_distribution(random_engine));
+					center_z.push_back(position_distribution(random_engine));
+					extents_x.push_back(extents_distribution(random_engine));
+					extents_y.push_back(extents_distribution(random_engine));
+					extents_z.push_back(extents_distribution(random_engine));
+				}
+			}
+
+			Aabbs_view view() const
+			{
+				return
+				{
+					center_x.data(), center_y.data(), center_z.data(),
+					extents_x.data(), extents_y.data(), extents_z.data()
+				};
+			}
+
+			Spatial::Aabb aabb(std::size_t const index) const
+			{
+				Eigen::Vector3f const center{ center_x[index], center_y[index], center_z[index] };
+				Eigen::Vector3f const extents{ extents_x[index], extents_y[index], extents_z[index] };
+
+				return { center - extents, center + extents };
+			}
+
+			std::size_t count;
+			std::vector<float> center_x, center_y, center_z, extents_x, extents_y, extents_z;
+		};
+
+		std::vector<Culling_instruction_set> get_supported_instruction_sets()
+		{
+			std::vector<Culling_instruction_set> instruction_sets;
+
+			for (Culling_instruction_set const instruction_set : { Culling_instruction_set::Scalar, Culling_instruction_set::SSE, Culling_instruction_set::AVX })
+			{
+				if (is_supported(instruction_set))
+				{
+					instruction_sets.push_back(instruction_set);
+				}
+			}
+
+			return instruction_sets;
+		}
+
+		std::vector<std::uint32_t> cull(Culling_instruction_set const instruction_set, Culling_planes const& planes, Random_aabbs const& aabbs)
+		{
+			std::vector<std::uint32_t> visible_indices(aabbs.count);
+			visible_indices.resize(cull_aabbs(instruction_set, planes, aabbs.view(), aabbs.count, visible_indices.data()));
+			return visible_indices;
+		}
+
+		Eigen::Matrix4f create_translation(Eigen::Vector3f const& translation)
+		{
+			Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+			matrix.block<3, 1>(0, 3) = translation;
+			return matrix;
+		}
+	}
+
+	SCENARIO("Cull AABBs with the SIMD kernel", "[Frustum_culling]")
+	{
+		GIVEN("A frustum and 1003 random AABBs")
+		{
+			Culling_planes const planes = create_culling_planes(create_test_frustum());
+			Random_aabbs const aabbs{ 1003, 3 };
+
+			WHEN("The AABBs are culled with each supported kernel and with the scalar one")
+			{
+				std::vector<std::uint32_t> const expected_visible_indices = cull(Culling_instruction_set::Scalar, planes, aabbs);
+
+				THEN("All produce the same visible indices")
+				{
+					CHECK(expected_visible_indices.size() > 0);
+					CHECK(expected_visible_indices.size() < aabbs.count);
+
+					for (Culling_instruction_set const instruction_set : get_supported_instruction_sets())
+					{
+						CHECK(cull(instruction_set, planes, aabbs) == expected_visible_indices);
+					}
+
+					std::vector<std::uint32_t> visible_indices(aabbs.count);
+					visible_indices.resize(cull_aabbs(planes, aabbs.view(), aabbs.count, visible_indices.data()));
+					CHECK(visible_indices == expected_visible_indices);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Cull AABBs with the planes of a view projection matrix", "[Frustum_culling]")
+	{
+		GIVEN("A camera at { 5, 0, -20 } looking at +Z and 1003 random AABBs")
+		{
+			Eigen::Matrix4f const view_matrix = create_translation({ -5.0f, 0.0f, 20.0f });
+			Random_aabbs const aabbs{ 1003, 7 };
+
+			auto const check_kernels = [&](Spatial::Frustum const& frustum) -> void
+			{
+				Culling_planes const planes = create_culling_planes(frustum);
+
+				std::vector<std::uint32_t> expected_visible_indices;
+				for (std::size_t index = 0; index < aabbs.count; ++index)
+				{
+					if (Spatial::intersects(frustum, aabbs.aabb(index)))
+					{
+						expected_visible_indices.push_back(static_cast<std::uint32_t>(index));
+					}
+				}
+
+				REQUIRE(expected_visible_indices.size() > 0);
+				CHECK(expected_visible_indices.size() < aabbs.count);
+
+				for (Culling_instruction_set const instruction_set : get_supported_instruction_sets())
+				{
+					CHECK(cull(instruction_set, planes, aabbs) == expected_visible_indices);
+				}
+			};
+
+			WHEN("The frustum of a finite perspective projection is used")
+			{
+				Spatial::Frustum const frustum = Spatial::create_frustum(create_perspective_projection(1.0f, 50.0f) * view_matrix);
+
+				THEN("Every kernel keeps the AABBs that intersect the frustum")
+				{
+					check_kernels(frustum);
+				}
+			}
+
+			WHEN("The frustum of an infinite perspective projection is used")
+			{
+				Spatial::Frustum const frustum = Spatial::create_frustum(create_infinite_perspective_projection(1.0f) * view_matrix);
+
+				THEN("Every kernel keeps the AABBs that intersect the frustum, however far they are")
+				{
+					check_kernels(frustum);
+
+					Random_aabbs far_aabbs{ 9, 11 };
+					std::fill(far_aabbs.center_x.begin(), far_aabbs.center_x.end(), 5.0f);
+					std::fill(far_aabbs.center_y.begin(), far_aabbs.center_y.end(), 0.0f);
+					std::fill(far_aabbs.center_z.begin(), far_aabbs.center_z.end(), 10000.0f);
+
+					for (Culling_instruction_set const instruction_set : get_supported_instruction_sets())
+					{
+						CHECK(cull(instruction_set, create_culling_planes(frustum), far_aabbs).size() == 9);
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Cull the instances of several entity types", "[Frustum_culling]")
+	{
+		GIVEN("An entity type with World_bounds, where even entities are in front of the camera and odd ones behind it")
+		{
+			Entity_manager entity_manager;
+
+			Entity_type_id const bounded_type = entity_manager.create_entity_type<Transform_matrix, World_bounds, Entity>(4, Space{ 0 });
+			Entity_type_id const unbounded_type = entity_manager.create_entity_type<Transform_matrix, Entity>(4, Space{ 0 });
+
+			for (std::size_t index = 0; index < 10; ++index)
+			{
+				float const z = index % 2 == 0 ? 10.0f : -10.0f;
+				Eigen::Vector3f const position{ static_cast<float>(index) * 0.1f, 0.0f, z };
+
+				entity_manager.create_entity(
+					bounded_type,
+					Transform_matrix{ create_translation(position) },
+					World_bounds{ { position - Eigen::Vector3f{ 0.5f, 0.5f, 0.5f }, position + Eigen::Vector3f{ 0.5f, 0.5f, 0.5f } } }
+				);
+			}
+
+			AND_GIVEN("An entity type without World_bounds with 3 entities")
+			{
+				for (std::size_t index = 0; index < 3; ++index)
+				{
+					entity_manager.create_entity(unbounded_type, Transform_matrix{});
+				}
+
+				std::vector<Entity_type_id> const entity_type_ids{ bounded_type, unbounded_type };
+
+				auto const check_visible_instances = [&](Visible_instances const& visible_instances) -> void
+				{
+					REQUIRE(visible_instances.counts.size() == 2);
+
+					gsl::span<Transform_matrix const> const visible_transforms = get_visible_transform_matrices(visible_instances, 0);
+					REQUIRE(visible_transforms.size() == 5);
+
+					for (std::ptrdiff_t index = 0; index < visible_transforms.size(); ++index)
+					{
+						Eigen::Vector3f const expected_position{ static_cast<float>(index * 2) * 0.1f, 0.0f, 10.0f };
+						CHECK(visible_transforms[index].value.block<3, 1>(0, 3).isApprox(expected_position));
+					}
+
+					CHECK(visible_instances.counts[1] == 3);
+				};
+
+				WHEN("The instances are culled in a single thread")
+				{
+					Maia::Utilities::Worker_threads single_thread{ 1 };
+					Frustum_culling_system frustum_culling_system{ single_thread };
+					Visible_instances visible_instances;
+					frustum_culling_system.execute(entity_manager, entity_type_ids, create_test_frustum(), visible_instances);
+
+					THEN("Only the instances in front of the camera are kept, in order, and unbounded instances are kept")
+					{
+						check_visible_instances(visible_instances);
+					}
+				}
+
+				WHEN("The instances are culled in several threads, twice with the same output")
+				{
+					Maia::Utilities::Worker_threads worker_threads{ 4 };
+					Frustum_culling_system frustum_culling_system{ worker_threads };
+					Visible_instances visible_instances;
+					frustum_culling_system.execute(entity_manager, entity_type_ids, create_test_frustum(), visible_instances);
+					frustum_culling_system.execute(entity_manager, entity_type_ids, create_test_frustum(), visible_instances);
+
+					THEN("The result is the same as in a single thread")
+					{
+						check_visible_instances(visible_instances);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,221 @@
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Culling/Depth_rasterizer.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+
+namespace Maia::GameEngine::Culling::Test
+{
+	using Components::World_bounds;
+	using Systems::Transform_matrix;
+
+	namespace
+	{
+		Eigen::Matrix4f create_test_projection()
+		{
+			float const near_z = 1.0f;
+			float const far_z = 50.0f;
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			return projection_matrix;
+		}
+
+		Occluder create_quad(float const half_size, float const z)
+		{
+			return
+			{
+				{
+					{ -half_size, -half_size, z },
+					{ half_size, -half_size, z },
+					{ half_size, half_size, z },
+					{ -half_size, half_size, z }
+				},
+				{ 0, 1, 2, 0, 2, 3 }
+			};
+		}
+
+		Spatial::Aabb create_box(Eigen::Vector3f const& center, float const half_size)
+		{
+			return { center - Eigen::Vector3f::Constant(half_size), center + Eigen::Vector3f::Constant(half_size) };
+		}
+	}
+
+	SCENARIO("Rasterize triangles into a depth buffer with the SIMD rasterizer", "[Occlusion_culling]")
+	{
+		GIVEN("200 random triangles in front of the camera")
+		{
+			std::mt19937 random_engine{ 5 };
+			std::uniform_real_distribution<float> xy_distribution{ -15.0f, 15.0f };
+			std::uniform_real_distribution<float> z_distribution{ 2.0f, 40.0f };
+
+			std::vector<Eigen::Vector3f> vertices;
+			std::vector<std::uint32_t> indices;
+
+			for (std::uint32_t index = 0; index < 600; ++index)
+			{
+				vertices.push_back({ xy_distribution(random_engine), xy_distribution(random_engine), z_distribution(random_engine) });
+				indices.push_back(index);
+			}
+
+			std::size_t const width = 64;
+			std::size_t const height = 37;
+
+			std::vector<Screen_triangle> triangles;
+			setup_triangles(vertices, indices, create_test_projection(), width, height, triangles);
+
+			WHEN("They are rasterized with the SIMD and the scalar rasterizers")
+			{
+				std::vector<float> depths(width * height, 1.0f);
+				rasterize_triangles({ depths.data(), width, height }, triangles, 0, height);
+
+				std::vector<float> expected_depths(width * height, 1.0f);
+				rasterize_triangles_scalar({ expected_depths.data(), width, height }, triangles, 0, height);
+
+				THEN("Both produce the same depth buffer")
+				{
+					CHECK(triangles.size() == 200);
+					CHECK(depths == expected_depths);
+				}
+			}
+
+			WHEN("They are rasterized in two bands of rows")
+			{
+				std::vector<float> depths(width * height, 1.0f);
+				rasterize_triangles({ depths.data(), width, height }, triangles, 0, 20);
+				rasterize_triangles({ depths.data(), width, height }, triangles, 20, height);
+
+				std::vector<float> expected_depths(width * height, 1.0f);
+				rasterize_triangles({ expected_depths.data(), width, height }, triangles, 0, height);
+
+				THEN("The result is the same as rasterizing all rows at once")
+				{
+					CHECK(depths == expected_depths);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Test boxes against the hierarchical depth buffer of an occluder", "[Occlusion_culling]")
+	{
+		GIVEN("An occlusion buffer with a quad occluder that covers the center of the screen")
+		{
+			std::vector<Occluder> const occluders{ create_quad(5.0f, 10.0f) };
+
+			Maia::Utilities::Worker_threads worker_threads{ 3 };
+			Occlusion_buffer occlusion_buffer{ 62, 32, worker_threads };
+			occlusion_buffer.render(occluders, create_test_projection());
+
+			THEN("The width is rounded up to a multiple of 4 and the pyramid ends in a single texel")
+			{
+				CHECK(occlusion_buffer.width() == 64);
+				CHECK(occlusion_buffer.height() == 32);
+				CHECK(occlusion_buffer.num_levels() == 7);
+				CHECK(occlusion_buffer.num_rasterized_triangles() == 2);
+			}
+
+			THEN("The center of the screen has the depth of the quad and the top of the pyramid the farthest depth")
+			{
+				CHECK(occlusion_buffer.get_depth(0, 32, 16) < 1.0f);
+				CHECK(occlusion_buffer.get_depth(0, 0, 0) == 1.0f);
+				CHECK(occlusion_buffer.get_depth(occlusion_buffer.num_levels() - 1, 0, 0) == 1.0f);
+			}
+
+			THEN("A box behind the center of the quad is occluded")
+			{
+				CHECK(occlusion_buffer.is_occluded(create_box({ 0.0f, 0.0f, 20.0f }, 1.0f)));
+			}
+
+			THEN("A box in front of the quad is not occluded")
+			{
+				CHECK(!occlusion_buffer.is_occluded(create_box({ 0.0f, 0.0f, 5.0f }, 1.0f)));
+			}
+
+			THEN("A box behind the quad that sticks out of it is not occluded")
+			{
+				CHECK(!occlusion_buffer.is_occluded(create_box({ 20.0f, 0.0f, 30.0f }, 1.0f)));
+				CHECK(!occlusion_buffer.is_occluded(create_box({ 0.0f, 0.0f, 20.0f }, 15.0f)));
+			}
+
+			THEN("A box that crosses the near plane is not occluded")
+			{
+				CHECK(!occlusion_buffer.is_occluded(create_box({ 0.0f, 0.0f, 0.0f }, 1.0f)));
+			}
+
+			WHEN("The buffer is rendered in a single band")
+			{
+				Maia::Utilities::Worker_threads single_thread{ 1 };
+				Occlusion_buffer single_band_occlusion_buffer{ 62, 32, single_thread };
+				single_band_occlusion_buffer.render(occluders, create_test_projection());
+
+				THEN("The depth buffer is the same")
+				{
+					for (std::size_t y = 0; y < occlusion_buffer.height(); ++y)
+					{
+						for (std::size_t x = 0; x < occlusion_buffer.width(); ++x)
+						{
+							CHECK(single_band_occlusion_buffer.get_depth(0, x, y) == occlusion_buffer.get_depth(0, x, y));
+						}
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Cull instances hidden by occluders", "[Occlusion_culling]")
+	{
+		GIVEN("Two instances behind a quad occluder and one to its side")
+		{
+			Entity_manager entity_manager;
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<Transform_matrix, World_bounds, Entity>(4, Space{ 0 });
+
+			std::vector<Eigen::Vector3f> const positions{ { 0.0f, 0.0f, 20.0f }, { 20.0f, 0.0f, 30.0f }, { 1.0f, 1.0f, 25.0f } };
+			std::vector<Entity> entities;
+
+			for (Eigen::Vector3f const& position : positions)
+			{
+				Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+				matrix.block<3, 1>(0, 3) = position;
+
+				entities.push_back(entity_manager.create_entity(entity_type_id, Transform_matrix{ matrix }, World_bounds{ create_box(position, 1.0f) }));
+			}
+
+			std::vector<Occluder> const occluders{ create_quad(5.0f, 10.0f) };
+
+			Maia::Utilities::Worker_threads worker_threads{ 2 };
+			Occlusion_buffer occlusion_buffer{ 64, 32, worker_threads };
+			occlusion_buffer.render(occluders, create_test_projection());
+
+			WHEN("The instances are culled against the frustum and the occlusion buffer")
+			{
+				std::vector<Entity_type_id> const entity_type_ids{ entity_type_id };
+
+				Frustum_culling_system frustum_culling_system{ worker_threads };
+				Visible_instances visible_instances;
+				frustum_culling_system.execute(entity_manager, entity_type_ids, Spatial::create_frustum(create_test_projection()), occlusion_buffer, visible_instances);
+
+				THEN("Only the instance to the side of the occluder is visible")
+				{
+					gsl::span<Transform_matrix const> const visible_transforms = get_visible_transform_matrices(visible_instances, 0);
+
+					REQUIRE(visible_transforms.size() == 1);
+					CHECK(visible_transforms[0].value.block<3, 1>(0, 3).isApprox(positions[1]));
+
+					gsl::span<Entity const> const visible_entities = get_visible_entities(visible_instances, 0, 0);
+
+					REQUIRE(visible_entities.size() == 1);
+					CHECK(visible_entities[0] == entities[1]);
+				}
+			}
+		}
+	}
+}
@@ -1,4 +1,8 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -9,6 +13,7 @@
 #include <Maia/GameEngine/Entity.hpp>
 #include <Maia/GameEngine/Entity_hash.hpp>
 #include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/Utilities/Allocators/Virtual_memory_arena.hpp>
 
 namespace Maia::GameEngine::Test
 {
@@ -469,8 +474,16 @@ namespace Maia::GameEngine::Test
 
 					AND_WHEN("A new entity is created")
 					{
+						Entity const destroyed_entity = entities[0];
 						entities[0] = entity_manager.create_entity(position_entity_type, positions[0]);
 
+						THEN("It reuses the value of the destroyed entity with a new generation")
+						{
+							CHECK(entities[0] == destroyed_entity);
+							CHECK(entity_manager.get_generation(entities[0]) == 1);
+							CHECK(entity_manager.get_generation(entities[1]) == 0);
+						}
+
 						THEN("The entities component data should be valid")
 						{
 							for (std::size_t entity_index = 0; entity_index < entities.size(); ++entity_index)
@@ -493,4 +506,256 @@ namespace Maia::GameEngine::Test
 			}
 		}
 	}
+
+	SCENARIO("Defragment an entity manager after destroying most of its entities")
+	{
+		GIVEN("An entity manager with two entity types and capacity per chunk equals 2")
+		{
+			Entity_manager entity_manager;
+
+			Entity_type_id const position_type_id = entity_manager.create_entity_type<Entity, Position>(2, Space{ 0 });
+			Entity_type_id const rotation_type_id = entity_manager.create_entity_type<Entity, Rotation>(2, Space{ 0 });
+
+			std::array<Entity, 6> const positions = entity_manager.create_entities<6>(position_type_id, Position{ 1.0f, 2.0f, 3.0f });
+			std::array<Entity, 2> const rotations = entity_manager.create_entities<2>(rotation_type_id, Rotation{});
+
+			WHEN("All but one position entity are destroyed and the manager is defragmented")
+			{
+				for (std::size_t index = 0; index < 5; ++index)
+				{
+					entity_manager.destroy_entity(positions[index]);
+				}
+
+				Defragment_result const result = entity_manager.defragment(std::chrono::seconds{ 1 });
+
+				THEN("The empty chunks are released and all component groups are visited")
+				{
+					CHECK(result.completed);
+					CHECK(result.visited_component_groups == 2);
+					CHECK(result.released_chunks == 2);
+					CHECK(entity_manager.get_component_group(position_type_id).num_chunks() == 1);
+					CHECK(entity_manager.get_component_group(rotation_type_id).num_chunks() == 1);
+					CHECK(entity_manager.get_chunk_pool().num_chunks() == 2);
+				}
+
+				THEN("The remaining entities keep their data")
+				{
+					CHECK(entity_manager.get_component_data<Position>(positions[5]) == Position{ 1.0f, 2.0f, 3.0f });
+					CHECK(entity_manager.exists(rotations[0]));
+					CHECK(entity_manager.exists(rotations[1]));
+				}
+
+				AND_WHEN("New position entities are created")
+				{
+					std::array<Entity, 3> const new_positions = entity_manager.create_entities<3>(position_type_id, Position{ 4.0f, 5.0f, 6.0f });
+
+					THEN("They reuse the pooled chunks")
+					{
+						CHECK(entity_manager.get_component_group(position_type_id).num_chunks() == 2);
+						CHECK(entity_manager.get_chunk_pool().num_chunks() == 1);
+						CHECK(entity_manager.get_component_data<Position>(new_positions[2]) == Position{ 4.0f, 5.0f, 6.0f });
+					}
+				}
+			}
+
+			WHEN("The chunk pool has no space and the manager is defragmented")
+			{
+				entity_manager.get_chunk_pool().set_max_size_in_bytes(0);
+
+				for (std::size_t index = 0; index < 4; ++index)
+				{
+					entity_manager.destroy_entity(positions[index]);
+				}
+
+				entity_manager.defragment(std::chrono::seconds{ 1 });
+
+				THEN("The released chunks are deallocated")
+				{
+					CHECK(entity_manager.get_component_group(position_type_id).num_chunks() == 1);
+					CHECK(entity_manager.get_chunk_pool().num_chunks() == 0);
+					CHECK(entity_manager.get_chunk_pool().size_in_bytes() == 0);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Allocate the chunks of an entity manager from a virtual memory arena")
+	{
+		GIVEN("An entity manager whose chunks are allocated from a virtual memory arena")
+		{
+			Maia::Utilities::Virtual_memory_arena arena{ 4 * 1024 * 1024 };
+			Entity_manager entity_manager{ &arena };
+
+			Entity_type_id const position_type_id = entity_manager.create_entity_type<Entity, Position>(4, Space{ 0 });
+
+			WHEN("Entities that fill three chunks are created")
+			{
+				std::array<Entity, 12> const positions = entity_manager.create_entities<12>(position_type_id, Position{ 1.0f, 2.0f, 3.0f });
+
+				THEN("The chunks are contiguous in the arena and keep the component data")
+				{
+					Component_group const& component_group = entity_manager.get_component_group(position_type_id);
+					REQUIRE(component_group.num_chunks() == 3);
+
+					std::size_t const alignment = Components_chunk::alignment_in_bytes;
+					std::ptrdiff_t const chunk_stride = static_cast<std::ptrdiff_t>((component_group.chunk_size_in_bytes() + alignment - 1) / alignment * alignment);
+
+					std::byte const* const first_chunk = reinterpret_cast<std::byte const*>(component_group.components<Entity>(0).data());
+					std::byte const* const second_chunk = reinterpret_cast<std::byte const*>(component_group.components<Entity>(1).data());
+					std::byte const* const third_chunk = reinterpret_cast<std::byte const*>(component_group.components<Entity>(2).data());
+
+					CHECK(first_chunk >= arena.data());
+					CHECK(third_chunk < arena.data() + arena.used_size());
+					CHECK(second_chunk - first_chunk == chunk_stride);
+					CHECK(third_chunk - second_chunk == chunk_stride);
+
+					CHECK(entity_manager.get_component_data<Position>(positions[11]) == Position{ 1.0f, 2.0f, 3.0f });
+				}
+
+				AND_WHEN("The entities are destroyed, the manager is defragmented and the entities are created again")
+				{
+					for (Entity const entity : positions)
+					{
+						entity_manager.destroy_entity(entity);
+					}
+
+					entity_manager.defragment(std::chrono::nanoseconds::max());
+
+					std::size_t const num_pooled_chunks = entity_manager.get_chunk_pool().num_chunks();
+					std::size_t const used_size = arena.used_size();
+
+					entity_manager.create_entities<12>(position_type_id, Position{ 1.0f, 2.0f, 3.0f });
+
+					THEN("The released chunks are kept by the pool and recycled instead of allocated from the arena")
+					{
+						CHECK(num_pooled_chunks == 3);
+						CHECK(entity_manager.get_chunk_pool().num_chunks() == 0);
+						CHECK(arena.used_size() == used_size);
+					}
+				}
+			}
+		}
+
+		GIVEN("An entity manager with chunks of several pages allocated from a virtual memory arena and an empty chunk pool")
+		{
+			Maia::Utilities::Virtual_memory_arena arena{ 4 * 1024 * 1024, false };
+			Entity_manager entity_manager{ &arena };
+			entity_manager.get_chunk_pool().set_max_size_in_bytes(0);
+
+			Entity_type_id const position_type_id = entity_manager.create_entity_type<Entity, Position>(4096, Space{ 0 });
+			std::size_t const chunk_size = entity_manager.get_component_group(position_type_id).chunk_size_in_bytes();
+
+			WHEN("Entities that fill two chunks are destroyed and the manager is defragmented")
+			{
+				std::vector<Entity> entities;
+				for (std::size_t index = 0; index < 2 * 4096; ++index)
+				{
+					entities.push_back(entity_manager.create_entity(position_type_id, Position{ 1.0f, 2.0f, 3.0f }));
+				}
+
+				for (Entity const entity : entities)
+				{
+					entity_manager.destroy_entity(entity);
+				}
+
+				entity_manager.defragment(std::chrono::nanoseconds::max());
+
+				std::size_t const used_size = arena.used_size();
+
+				THEN("The chunks are deallocated to the arena, which gives their pages back to the system")
+				{
+					CHECK(entity_manager.get_chunk_pool().num_chunks() == 0);
+					CHECK(arena.free_size() >= 2 * chunk_size);
+					CHECK(arena.decommitted_size() > 0);
+				}
+
+				AND_WHEN("An entity is created again")
+				{
+					Entity const entity = entity_manager.create_entity(position_type_id, Position{ 4.0f, 5.0f, 6.0f });
+
+					THEN("A deallocated chunk is reused from the arena")
+					{
+						CHECK(arena.used_size() == used_size);
+						CHECK(entity_manager.get_component_data<Position>(entity) == Position{ 4.0f, 5.0f, 6.0f });
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Sort the entities of an entity type by a key")
+	{
+		GIVEN("An entity manager with 7 position entities in reverse order and capacity per chunk equals 3")
+		{
+			Entity_manager entity_manager;
+
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<Entity, Position>(3, Space{ 0 });
+
+			std::vector<Entity> entities;
+			for (std::size_t index = 0; index < 7; ++index)
+			{
+				entities.push_back(entity_manager.create_entity(entity_type_id, Position{ static_cast<float>(7 - index), 0.0f, 0.0f }));
+			}
+
+			auto const key_function = [](Position const& position) -> float { return position.x; };
+
+			auto const check_sorted = [&]() -> void
+			{
+				Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
+
+				for (std::size_t index = 1; index < component_group.size(); ++index)
+				{
+					CHECK(component_group.get_component_data<Position>({ index - 1 }).x <= component_group.get_component_data<Position>({ index }).x);
+				}
+
+				for (Entity const entity : entities)
+				{
+					if (entity_manager.exists(entity))
+					{
+						CHECK(entity_manager.get_component_data<Entity>(entity) == entity);
+					}
+				}
+			};
+
+			WHEN("The entities are sorted by position x")
+			{
+				entity_manager.sort_entities<Position>(entity_type_id, key_function);
+
+				THEN("The component group is sorted and every entity points to its own components")
+				{
+					check_sorted();
+					CHECK(entity_manager.get_component_data<Position>(entities[6]) == Position{ 1.0f, 0.0f, 0.0f });
+				}
+			}
+
+			WHEN("The entities are sorted incrementally with at most 2 swaps per step")
+			{
+				Entity_sort_state state = entity_manager.begin_sort_entities<Position>(entity_type_id, key_function);
+
+				bool const completed_first_step = entity_manager.continue_sort_entities(state, 2);
+
+				THEN("The first step does not complete the sort")
+				{
+					CHECK(!completed_first_step);
+				}
+
+				AND_WHEN("An entity is destroyed between steps and the steps are continued until completion")
+				{
+					entity_manager.destroy_entity(entities[3]);
+
+					std::size_t num_steps = 1;
+					while (!entity_manager.continue_sort_entities(state, 2))
+					{
+						++num_steps;
+					}
+
+					THEN("The remaining entities are sorted and point to their own components")
+					{
+						CHECK(num_steps > 1);
+						check_sorted();
+					}
+				}
+			}
+		}
+	}
 }
@@ -0,0 +1,113 @@
+#include <sstream>
+
+#include <catch2/catch.hpp>
+#include <nlohmann/json.hpp>
+
+#include <Test_components.hpp>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Entity_manager_statistics.hpp>
+
+namespace Maia::GameEngine::Test
+{
+	SCENARIO("Calculate the memory and occupancy statistics of an entity manager", "[Entity_manager_statistics]")
+	{
+		GIVEN("An entity manager with a Position entity type and capacity per chunk equals 4")
+		{
+			Entity_manager entity_manager;
+
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<Position, Entity>(4, Space{ 0 });
+
+			WHEN("No entities are created")
+			{
+				Entity_manager_statistics const statistics = calculate_statistics(entity_manager);
+
+				THEN("There is one empty component group")
+				{
+					CHECK(statistics.num_entities == 0);
+					CHECK(statistics.allocated_size_in_bytes == 0);
+					REQUIRE(statistics.component_groups.size() == 1);
+					CHECK(statistics.component_groups[0].num_chunks == 0);
+					CHECK(statistics.component_groups[0].chunk_fill_ratio == 1.0f);
+				}
+			}
+
+			WHEN("Six entities are created and two of them are destroyed")
+			{
+				std::array<Entity, 6> const entities = entity_manager.create_entities<6>(entity_type_id, Position{});
+				entity_manager.destroy_entity(entities[1]);
+				entity_manager.destroy_entity(entities[4]);
+
+				Entity_manager_statistics const statistics = calculate_statistics(entity_manager);
+
+				THEN("The entity counters take the free list into account")
+				{
+					CHECK(statistics.num_entities == 4);
+					CHECK(statistics.num_entity_ids == 6);
+					CHECK(statistics.num_free_entity_ids == 2);
+				}
+
+				THEN("The component group reports two chunks and the wasted tail capacity")
+				{
+					REQUIRE(statistics.component_groups.size() == 1);
+
+					Component_group_statistics const& group_statistics = statistics.component_groups[0];
+					std::size_t const element_size = sizeof(Position) + sizeof(Entity);
+
+					CHECK(group_statistics.entity_type_id == entity_type_id);
+					CHECK(group_statistics.size == 4);
+					CHECK(group_statistics.capacity == 8);
+					CHECK(group_statistics.num_chunks == 2);
+					CHECK(group_statistics.chunk_size_in_bytes == 4 * element_size);
+					CHECK(group_statistics.used_size_in_bytes == 4 * element_size);
+					CHECK(group_statistics.allocated_size_in_bytes == 8 * element_size);
+					CHECK(group_statistics.wasted_tail_capacity == 4);
+					CHECK(group_statistics.chunk_fill_ratio == Approx(0.5f));
+				}
+
+				THEN("The per component byte totals are reported")
+				{
+					Component_group_statistics const& group_statistics = statistics.component_groups[0];
+					REQUIRE(group_statistics.components.size() == 2);
+
+					for (Component_statistics const& component_statistics : group_statistics.components)
+					{
+						if (component_statistics.id == Component_ID::get<Position>())
+						{
+							CHECK(component_statistics.used_size_in_bytes == 4 * sizeof(Position));
+							CHECK(component_statistics.allocated_size_in_bytes == 8 * sizeof(Position));
+						}
+						else
+						{
+							CHECK(component_statistics.id == Component_ID::get<Entity>());
+							CHECK(component_statistics.used_size_in_bytes == 4 * sizeof(Entity));
+						}
+					}
+				}
+
+				THEN("The totals match the sum of the component groups")
+				{
+					CHECK(statistics.used_size_in_bytes == statistics.component_groups[0].used_size_in_bytes);
+					CHECK(statistics.allocated_size_in_bytes == statistics.component_groups[0].allocated_size_in_bytes);
+				}
+
+				AND_WHEN("The statistics are written as JSON")
+				{
+					std::stringstream output_stream;
+					write_json(output_stream, statistics);
+
+					nlohmann::json const json = nlohmann::json::parse(output_stream.str());
+
+					THEN("The JSON contains the same values")
+					{
+						CHECK(json.at("num_entities").get<std::size_t>() == 4);
+						CHECK(json.at("num_free_entity_ids").get<std::size_t>() == 2);
+						REQUIRE(json.at("component_groups").size() == 1);
+						CHECK(json.at("component_groups").at(0).at("wasted_tail_capacity").get<std::size_t>() == 4);
+						CHECK(json.at("component_groups").at(0).at("components").size() == 2);
+					}
+				}
+			}
+		}
+	}
+}
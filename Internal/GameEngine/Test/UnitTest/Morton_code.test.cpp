@@ -0,0 +1,49 @@
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Morton_code.hpp>
+
+namespace Maia::GameEngine::Test
+{
+	SCENARIO("Encode Morton codes", "[Morton_code]")
+	{
+		GIVEN("Grid coordinates")
+		{
+			THEN("The bits of x, y and z are interleaved")
+			{
+				CHECK(encode_morton_code(0, 0, 0) == 0);
+				CHECK(encode_morton_code(0, 0, 1) == 0b001);
+				CHECK(encode_morton_code(0, 1, 0) == 0b010);
+				CHECK(encode_morton_code(1, 0, 0) == 0b100);
+				CHECK(encode_morton_code(3, 0, 0) == 0b100100);
+				CHECK(encode_morton_code(1023, 1023, 1023) == 0x3FFFFFFF);
+			}
+		}
+
+		GIVEN("A box from { 0, 0, 0 } to { 1, 1, 1 }")
+		{
+			Eigen::Vector3f const minimum{ 0.0f, 0.0f, 0.0f };
+			Eigen::Vector3f const maximum{ 1.0f, 1.0f, 1.0f };
+
+			THEN("The corners map to the first and last codes")
+			{
+				CHECK(calculate_morton_code({ 0.0f, 0.0f, 0.0f }, minimum, maximum) == 0);
+				CHECK(calculate_morton_code({ 1.0f, 1.0f, 1.0f }, minimum, maximum) == 0x3FFFFFFF);
+			}
+
+			THEN("Positions outside the box are clamped")
+			{
+				CHECK(calculate_morton_code({ -2.0f, -2.0f, -2.0f }, minimum, maximum) == 0);
+				CHECK(calculate_morton_code({ 5.0f, 5.0f, 5.0f }, minimum, maximum) == 0x3FFFFFFF);
+			}
+
+			THEN("Nearby positions have closer codes than distant positions")
+			{
+				std::uint32_t const origin = calculate_morton_code({ 0.1f, 0.1f, 0.1f }, minimum, maximum);
+				std::uint32_t const near = calculate_morton_code({ 0.11f, 0.1f, 0.1f }, minimum, maximum);
+				std::uint32_t const far = calculate_morton_code({ 0.9f, 0.9f, 0.9f }, minimum, maximum);
+
+				CHECK(near - origin < far - origin);
+			}
+		}
+	}
+}
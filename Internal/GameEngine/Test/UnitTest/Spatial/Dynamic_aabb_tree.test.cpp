@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Spatial/Dynamic_aabb_tree.hpp>
+
+namespace Maia::GameEngine::Spatial::Test
+{
+	namespace
+	{
+		std::vector<Aabb> create_random_aabbs(std::size_t const count, unsigned int const seed)
+		{
+			std::mt19937 random_engine{ seed };
+			std::uniform_real_distribution<float> position_distribution{ -50.0f, 50.0f };
+			std::uniform_real_distribution<float> size_distribution{ 0.1f, 2.0f };
+
+			std::vector<Aabb> aabbs;
+			aabbs.reserve(count);
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Eigen::Vector3f const minimum{ position_distribution(random_engine), position_distribution(random_engine), position_distribution(random_engine) };
+				Eigen::Vector3f const size{ size_distribution(random_engine), size_distribution(random_engine), size_distribution(random_engine) };
+
+				aabbs.push_back({ minimum, minimum + size });
+			}
+
+			return aabbs;
+		}
+
+		std::vector<Entity::Integral_type> to_sorted_values(std::vector<Entity> const& entities)
+		{
+			std::vector<Entity::Integral_type> values;
+			values.reserve(entities.size());
+
+			for (Entity const entity : entities)
+			{
+				values.push_back(entity.value);
+			}
+
+			std::sort(values.begin(), values.end());
+			return values;
+		}
+	}
+
+	SCENARIO("Insert, move and remove boxes in a dynamic AABB tree", "[Dynamic_aabb_tree]")
+	{
+		GIVEN("A dynamic AABB tree with a margin of 0.5")
+		{
+			Dynamic_aabb_tree tree{ 0.5f };
+
+			THEN("It is empty")
+			{
+				CHECK(tree.size() == 0);
+				CHECK(tree.height() == 0);
+			}
+
+			WHEN("A box is inserted")
+			{
+				Aabb const aabb{ { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+				Aabb_tree_proxy const proxy = tree.insert(aabb, Entity{ 7 });
+
+				THEN("Its fat AABB is expanded by the margin")
+				{
+					CHECK(tree.size() == 1);
+					CHECK(tree.get_entity(proxy) == Entity{ 7 });
+					CHECK(tree.get_fat_aabb(proxy) == Aabb{ { -0.5f, -0.5f, -0.5f }, { 1.5f, 1.5f, 1.5f } });
+				}
+
+				THEN("Moving it inside its fat AABB does not reinsert it")
+				{
+					CHECK(!tree.move(proxy, { { 0.25f, 0.0f, 0.0f }, { 1.25f, 1.0f, 1.0f } }));
+				}
+
+				THEN("Moving it outside of its fat AABB reinserts it")
+				{
+					CHECK(tree.move(proxy, { { 2.0f, 0.0f, 0.0f }, { 3.0f, 1.0f, 1.0f } }));
+					CHECK(tree.get_fat_aabb(proxy) == Aabb{ { 1.5f, -0.5f, -0.5f }, { 3.5f, 1.5f, 1.5f } });
+				}
+
+				AND_WHEN("It is removed")
+				{
+					tree.remove(proxy);
+
+					THEN("The tree is empty")
+					{
+						CHECK(tree.size() == 0);
+
+						std::size_t num_found = 0;
+						tree.query(aabb, [&num_found](Entity) -> void { ++num_found; });
+						CHECK(num_found == 0);
+					}
+				}
+			}
+
+			WHEN("1000 boxes are inserted in a row")
+			{
+				for (Entity::Integral_type index = 0; index < 1000; ++index)
+				{
+					float const x = static_cast<float>(index) * 2.0f;
+					tree.insert({ { x, 0.0f, 0.0f }, { x + 1.0f, 1.0f, 1.0f } }, Entity{ index });
+				}
+
+				THEN("The tree stays balanced")
+				{
+					CHECK(tree.size() == 1000);
+					CHECK(tree.height() <= 20);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Query a dynamic AABB tree", "[Dynamic_aabb_tree]")
+	{
+		GIVEN("A dynamic AABB tree with 500 random boxes, where some of them were moved and removed")
+		{
+			Dynamic_aabb_tree tree{ 0.0f };
+
+			std::vector<Aabb> aabbs = create_random_aabbs(500, 1);
+			std::vector<Aabb> const moved_aabbs = create_random_aabbs(100, 2);
+			std::vector<bool> removed(aabbs.size(), false);
+			std::vector<Aabb_tree_proxy> proxies;
+
+			for (std::size_t index = 0; index < aabbs.size(); ++index)
+			{
+				proxies.push_back(tree.insert(aabbs[index], Entity{ static_cast<Entity::Integral_type>(index) }));
+			}
+
+			for (std::size_t index = 0; index < moved_aabbs.size(); ++index)
+			{
+				aabbs[index] = moved_aabbs[index];
+				tree.move(proxies[index], aabbs[index]);
+			}
+
+			for (std::size_t index = 100; index < 150; ++index)
+			{
+				tree.remove(proxies[index]);
+				removed[index] = true;
+			}
+
+			auto const brute_force = [&](auto&& overlaps) -> std::vector<Entity::Integral_type>
+			{
+				std::vector<Entity::Integral_type> values;
+
+				for (std::size_t index = 0; index < aabbs.size(); ++index)
+				{
+					if (!removed[index] && overlaps(aabbs[index]))
+					{
+						values.push_back(static_cast<Entity::Integral_type>(index));
+					}
+				}
+
+				return values;
+			};
+
+			WHEN("Querying with boxes")
+			{
+				std::vector<Aabb> const query_aabbs = create_random_aabbs(20, 3);
+
+				std::vector<Entity> results;
+				std::vector<std::size_t> offsets;
+				tree.query(query_aabbs, results, offsets);
+
+				THEN("The results match a brute force search")
+				{
+					REQUIRE(offsets.size() == query_aabbs.size() + 1);
+
+					for (std::size_t query_index = 0; query_index < query_aabbs.size(); ++query_index)
+					{
+						std::vector<Entity> const query_results{ results.begin() + offsets[query_index], results.begin() + offsets[query_index + 1] };
+
+						CHECK(to_sorted_values(query_results) == brute_force([&](Aabb const& aabb) -> bool { return intersects(query_aabbs[query_index], aabb); }));
+					}
+				}
+			}
+
+			WHEN("Querying with a frustum")
+			{
+				Eigen::Matrix4f view_projection_matrix = Eigen::Matrix4f::Identity();
+				view_projection_matrix(0, 0) = 1.0f / 20.0f;
+				view_projection_matrix(1, 1) = 1.0f / 20.0f;
+				view_projection_matrix(2, 2) = 1.0f / 40.0f;
+
+				Frustum const frustum = create_frustum(view_projection_matrix);
+
+				std::vector<Entity> results;
+				tree.query(frustum, [&results](Entity const entity) -> void { results.push_back(entity); });
+
+				THEN("The results match a brute force search")
+				{
+					CHECK(to_sorted_values(results) == brute_force([&](Aabb const& aabb) -> bool { return intersects(frustum, aabb); }));
+				}
+			}
+
+			WHEN("Casting rays")
+			{
+				std::vector<Ray> const rays
+				{
+					{ { -60.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } },
+					{ { 0.0f, -60.0f, 10.0f }, { 0.0f, 1.0f, 0.0f }, 70.0f },
+					{ { 0.0f, 0.0f, 0.0f }, Eigen::Vector3f{ 1.0f, 1.0f, 1.0f }.normalized() }
+				};
+
+				std::vector<Entity> results;
+				std::vector<std::size_t> offsets;
+				tree.ray_cast(rays, results, offsets);
+
+				THEN("The results match a brute force search")
+				{
+					for (std::size_t ray_index = 0; ray_index < rays.size(); ++ray_index)
+					{
+						std::vector<Entity> const ray_results{ results.begin() + offsets[ray_index], results.begin() + offsets[ray_index + 1] };
+
+						CHECK(to_sorted_values(ray_results) == brute_force([&](Aabb const& aabb) -> bool { return intersects(rays[ray_index], aabb); }));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,105 @@
+#include <cmath>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Spatial/Frustum.hpp>
+
+namespace Maia::GameEngine::Spatial::Test
+{
+	SCENARIO("Classify boxes against a frustum", "[Frustum]")
+	{
+		GIVEN("The frustum of an identity view projection matrix, which is the box from { -1, -1, 0 } to { 1, 1, 1 }")
+		{
+			Frustum const frustum = create_frustum(Eigen::Matrix4f::Identity());
+
+			THEN("A box in the center is inside")
+			{
+				CHECK(classify(frustum, { { -0.5f, -0.5f, 0.25f }, { 0.5f, 0.5f, 0.75f } }) == Intersection::Inside);
+			}
+
+			THEN("A box crossing the right plane is intersecting")
+			{
+				CHECK(classify(frustum, { { 0.5f, -0.5f, 0.25f }, { 1.5f, 0.5f, 0.75f } }) == Intersection::Intersecting);
+			}
+
+			THEN("A box behind the near plane is outside")
+			{
+				CHECK(classify(frustum, { { -0.5f, -0.5f, -2.0f }, { 0.5f, 0.5f, -1.0f } }) == Intersection::Outside);
+				CHECK(!intersects(frustum, { { -0.5f, -0.5f, -2.0f }, { 0.5f, 0.5f, -1.0f } }));
+			}
+		}
+
+		GIVEN("The frustum of a perspective projection looking at +Z with near 1 and far 10")
+		{
+			float const near_z = 1.0f;
+			float const far_z = 10.0f;
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			Frustum const frustum = create_frustum(projection_matrix);
+
+			THEN("A box in front of the camera is inside")
+			{
+				CHECK(classify(frustum, { { -0.5f, -0.5f, 4.5f }, { 0.5f, 0.5f, 5.5f } }) == Intersection::Inside);
+			}
+
+			THEN("Boxes behind the camera, past the far plane or to the side are outside")
+			{
+				CHECK(classify(frustum, { { -0.5f, -0.5f, -5.5f }, { 0.5f, 0.5f, -4.5f } }) == Intersection::Outside);
+				CHECK(classify(frustum, { { -0.5f, -0.5f, 11.0f }, { 0.5f, 0.5f, 12.0f } }) == Intersection::Outside);
+				CHECK(classify(frustum, { { 7.0f, -0.5f, 4.5f }, { 8.0f, 0.5f, 5.5f } }) == Intersection::Outside);
+			}
+
+			THEN("A box containing the camera is intersecting")
+			{
+				CHECK(classify(frustum, { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } }) == Intersection::Intersecting);
+			}
+		}
+
+		GIVEN("The frustum of an infinite perspective projection looking at +Z with near 1, behind a view matrix")
+		{
+			float const near_z = 1.0f;
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, -near_z,
+				0.0f, 0.0f, 1.0f, 0.0f;
+
+			Eigen::Matrix4f view_matrix = Eigen::Matrix4f::Identity();
+			view_matrix.block<3, 1>(0, 3) = Eigen::Vector3f{ 1.0f, 2.0f, 3.0f };
+
+			Frustum const frustum = create_frustum(projection_matrix * view_matrix);
+
+			THEN("The far plane has no normal and lets everything through, and the other planes are valid")
+			{
+				CHECK(frustum.planes[5].head<3>().isZero());
+				CHECK(std::isinf(frustum.planes[5](3)));
+				CHECK(frustum.planes[5](3) > 0.0f);
+
+				for (std::size_t plane_index = 0; plane_index < 5; ++plane_index)
+				{
+					CHECK(frustum.planes[plane_index].allFinite());
+				}
+			}
+
+			THEN("Boxes in front of the camera are inside, however far they are")
+			{
+				CHECK(classify(frustum, { { -1.5f, -2.5f, 1.5f }, { -0.5f, -1.5f, 2.5f } }) == Intersection::Inside);
+				CHECK(classify(frustum, { { -1.5f, -2.5f, 10000.0f }, { -0.5f, -1.5f, 10001.0f } }) == Intersection::Inside);
+			}
+
+			THEN("Boxes behind the camera or to the side are outside")
+			{
+				CHECK(classify(frustum, { { -1.5f, -2.5f, -10.0f }, { -0.5f, -1.5f, -9.0f } }) == Intersection::Outside);
+				CHECK(classify(frustum, { { 20.0f, -2.5f, 5.0f }, { 21.0f, -1.5f, 6.0f } }) == Intersection::Outside);
+			}
+		}
+	}
+}
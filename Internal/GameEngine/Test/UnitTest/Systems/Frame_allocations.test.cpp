@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/GameEngine/Systems/World_bounds_system.hpp>
+#include <Maia/Renderer/Frame_packet.hpp>
+#include <Maia/Renderer/Instance_slots.hpp>
+#include <Maia/Renderer/Render_queue.hpp>
+#include <Maia/Utilities/Allocators/Frame_arenas.hpp>
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
+namespace
+{
+	std::atomic<std::size_t> g_num_heap_allocations{ 0 };
+
+	void* aligned_allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes) noexcept
+	{
+#if defined(_WIN32)
+		return _aligned_malloc(size_in_bytes != 0 ? size_in_bytes : 1, alignment_in_bytes);
+#else
+		// aligned_alloc requires a size that is a multiple of the alignment
+		std::size_t const aligned_size = ((size_in_bytes + alignment_in_bytes - 1) / alignment_in_bytes) * alignment_in_bytes;
+		return std::aligned_alloc(alignment_in_bytes, aligned_size != 0 ? aligned_size : alignment_in_bytes);
+#endif
+	}
+
+	void aligned_deallocate(void* const data) noexcept
+	{
+#if defined(_WIN32)
+		_aligned_free(data);
+#else
+		std::free(data);
+#endif
+	}
+}
+
+// Counts the general heap allocations of the whole test executable, including the over-aligned ones.
+void* operator new(std::size_t const size_in_bytes)
+{
+	++g_num_heap_allocations;
+
+	if (void* const data = std::malloc(size_in_bytes != 0 ? size_in_bytes : 1))
+	{
+		return data;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t const size_in_bytes, std::nothrow_t const&) noexcept
+{
+	++g_num_heap_allocations;
+
+	return std::malloc(size_in_bytes != 0 ? size_in_bytes : 1);
+}
+
+void* operator new(std::size_t const size_in_bytes, std::align_val_t const alignment)
+{
+	++g_num_heap_allocations;
+
+	if (void* const data = aligned_allocate(size_in_bytes, static_cast<std::size_t>(alignment)))
+	{
+		return data;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t const size_in_bytes, std::align_val_t const alignment, std::nothrow_t const&) noexcept
+{
+	++g_num_heap_allocations;
+
+	return aligned_allocate(size_in_bytes, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const data) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::size_t) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::nothrow_t const&) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::align_val_t) noexcept
+{
+	aligned_deallocate(data);
+}
+
+void operator delete(void* const data, std::size_t, std::align_val_t) noexcept
+{
+	aligned_deallocate(data);
+}
+
+void operator delete(void* const data, std::align_val_t, std::nothrow_t const&) noexcept
+{
+	aligned_deallocate(data);
+}
+
+namespace Maia::GameEngine::Systems::Test
+{
+	SCENARIO("Update and cull a steady state frame without heap allocations", "[Frame_allocations]")
+	{
+		GIVEN("A transform hierarchy with bounds and the systems of a frame, using frame and scratch arenas")
+		{
+			Entity_manager entity_manager{};
+
+			auto const root_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_tree_dirty, Local_bounds, World_bounds, Entity>(4, Space{ 0 });
+			auto const child_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_root, Transform_parent, Local_bounds, World_bounds, Entity>(4, Space{ 0 });
+
+			Local_bounds const local_bounds{ { { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } } };
+
+			Entity const root_entity = entity_manager.create_entity(
+				root_entity_type,
+				Local_position{ { 0.0f, 0.0f, 10.0f } },
+				Local_rotation{},
+				Transform_matrix{},
+				Transform_tree_dirty{ true },
+				local_bounds,
+				World_bounds{}
+			);
+
+			Entity parent_entity = root_entity;
+
+			for (int index = 0; index < 10; ++index)
+			{
+				parent_entity = entity_manager.create_entity(
+					child_entity_type,
+					Local_position{ { 1.0f, 0.0f, 0.0f } },
+					Local_rotation{},
+					Transform_matrix{},
+					Transform_root{ root_entity },
+					Transform_parent{ parent_entity },
+					local_bounds,
+					World_bounds{}
+				);
+			}
+
+			Transform_hierarchy const transform_hierarchy = create_transform_hierarchy(entity_manager);
+			std::vector<Entity_type_id> const entity_type_ids{ root_entity_type, child_entity_type };
+
+			Eigen::Matrix4f projection_matrix;
+			projection_matrix <<
+				1.0f, 0.0f, 0.0f, 0.0f,
+				0.0f, 1.0f, 0.0f, 0.0f,
+				0.0f, 0.0f, 50.0f / 49.0f, -50.0f / 49.0f,
+				0.0f, 0.0f, 1.0f, 0.0f;
+			Spatial::Frustum const frustum = Spatial::create_frustum(projection_matrix);
+
+			Maia::Utilities::Frame_arenas frame_arenas{ 2, 64 * 1024 };
+			Maia::Utilities::Worker_threads single_thread{ 1 };
+			Culling::Frustum_culling_system frustum_culling_system{ single_thread };
+			Culling::Visible_instances visible_instances;
+
+			auto const run_frame = [&]() -> std::size_t
+			{
+				frame_arenas.begin_frame();
+				Maia::Utilities::get_thread_scratch_arena().reset();
+
+				entity_manager.set_component_data(root_entity, Transform_tree_dirty{ true });
+
+				Maia::Utilities::Arena_vector<Entity> changed_entities{ Maia::Utilities::Forward_allocator<Entity>{ frame_arenas.current() } };
+				Transform_system{}.execute(entity_manager, transform_hierarchy, changed_entities);
+				World_bounds_system{}.execute(entity_manager, changed_entities);
+				frustum_culling_system.execute(entity_manager, entity_type_ids, frustum, visible_instances);
+
+				return changed_entities.size();
+			};
+
+			// Behind every entity, so that it is rasterized without hiding anything
+			std::vector<Culling::Occluder> const occluders
+			{
+				{ { { -40.0f, -40.0f, 40.0f }, { 40.0f, -40.0f, 40.0f }, { 40.0f, 40.0f, 40.0f }, { -40.0f, 40.0f, 40.0f } }, { 0, 1, 2, 0, 2, 3 } }
+			};
+
+			// Enough draw items for the render queue to sort them with every thread
+			std::size_t const num_draw_items = 4 * 16 * 1024;
+
+			Maia::Utilities::Worker_threads worker_threads{ 4 };
+			Culling::Frustum_culling_system parallel_frustum_culling_system{ worker_threads };
+			Culling::Occlusion_buffer occlusion_buffer{ 64, 32, worker_threads };
+			Maia::Renderer::Render_queue render_queue{ worker_threads };
+			Maia::Renderer::Instance_slots instance_slots;
+			std::vector<Maia::Renderer::Slot_update> slot_updates;
+			std::vector<std::uint32_t> extracted_instance_slots(num_draw_items);
+			Maia::Renderer::Frame_packet frame_packet{};
+
+			auto const run_parallel_frame = [&]() -> std::size_t
+			{
+				frame_arenas.begin_frame();
+				Maia::Utilities::get_thread_scratch_arena().reset();
+
+				entity_manager.set_component_data(root_entity, Transform_tree_dirty{ true });
+
+				Maia::Utilities::Arena_vector<Entity> changed_entities{ Maia::Utilities::Forward_allocator<Entity>{ frame_arenas.current() } };
+				Transform_system{}.execute(entity_manager, transform_hierarchy, changed_entities);
+				World_bounds_system{}.execute(entity_manager, changed_entities);
+
+				occlusion_buffer.render(occluders, projection_matrix);
+				parallel_frustum_culling_system.execute(entity_manager, entity_type_ids, frustum, occlusion_buffer, visible_instances);
+
+				render_queue.clear();
+				for (std::size_t item_index = 0; item_index < num_draw_items; ++item_index)
+				{
+					render_queue.push(((item_index * 2654435761u) & 0xFFFFFFFF) << 16, static_cast<std::uint32_t>(item_index));
+				}
+				render_queue.sort();
+
+				// The uploads of the changed instances and the instanced draws of the packet
+				slot_updates.clear();
+				for (Entity const entity : changed_entities)
+				{
+					std::uint32_t const slot = instance_slots.assign(entity.value, entity_manager.get_generation(entity)).first;
+					slot_updates.push_back({ slot, entity_manager.get_component_data<Transform_matrix>(entity).value });
+				}
+
+				for (std::size_t item_index = 0; item_index < num_draw_items; ++item_index)
+				{
+					extracted_instance_slots[item_index] = static_cast<std::uint32_t>(item_index % 11);
+				}
+
+				Maia::Renderer::write_draws(render_queue, extracted_instance_slots, frame_packet);
+				Maia::Renderer::coalesce_slot_updates(slot_updates, frame_packet.updated_slot_ranges, frame_packet.updated_transforms);
+
+				return visible_instances.counts[0] + visible_instances.counts[1];
+			};
+
+			WHEN("Frames are run after a warm up frame")
+			{
+				run_frame();
+				run_frame();
+
+				std::size_t const num_heap_allocations = g_num_heap_allocations;
+				std::size_t num_changed_entities = 0;
+
+				for (int frame = 0; frame < 4; ++frame)
+				{
+					num_changed_entities += run_frame();
+				}
+
+				std::size_t const num_frame_heap_allocations = g_num_heap_allocations - num_heap_allocations;
+
+				THEN("Every entity is updated and the general heap is never used")
+				{
+					CHECK(num_changed_entities == 4 * 11);
+					CHECK(num_frame_heap_allocations == 0);
+				}
+			}
+
+			WHEN("Frames that cull, rasterize occluders, sort draw items on worker threads and write a frame packet are run after a warm up frame")
+			{
+				run_parallel_frame();
+				run_parallel_frame();
+
+				std::size_t const num_heap_allocations = g_num_heap_allocations;
+				std::size_t num_visible_instances = 0;
+
+				for (int frame = 0; frame < 4; ++frame)
+				{
+					num_visible_instances += run_parallel_frame();
+				}
+
+				std::size_t const num_frame_heap_allocations = g_num_heap_allocations - num_heap_allocations;
+
+				THEN("Every entity is visible, the draw items are sorted, every changed instance is uploaded and the general heap is never used")
+				{
+					CHECK(frame_packet.updated_transforms.size() == 11);
+					CHECK(frame_packet.instance_slots.size() == num_draw_items);
+					CHECK(occlusion_buffer.num_rasterized_triangles() == 2);
+					CHECK(num_visible_instances == 4 * 11);
+					CHECK(render_queue.get_items().size() == num_draw_items);
+					CHECK(std::is_sorted(render_queue.get_items().begin(), render_queue.get_items().end(), [](auto const& lhs, auto const& rhs) { return lhs.sort_key < rhs.sort_key; }));
+					CHECK(num_frame_heap_allocations == 0);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,176 @@
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+#include <Maia/GameEngine/Systems/Lod_selection_system.hpp>
+
+namespace Maia::GameEngine::Systems::Test
+{
+	using Components::World_bounds;
+
+	namespace
+	{
+		std::vector<Lod_level> select(Lod::Lod_group const& lod_group, std::vector<float> const& projected_sizes, std::vector<Lod_level> levels)
+		{
+			Lod::select_lod_levels(lod_group, projected_sizes.data(), projected_sizes.size(), levels.data());
+			return levels;
+		}
+
+		std::vector<std::uint8_t> get_values(std::vector<Lod_level> const& levels)
+		{
+			std::vector<std::uint8_t> values;
+
+			for (Lod_level const level : levels)
+			{
+				values.push_back(level.value);
+			}
+
+			return values;
+		}
+	}
+
+	SCENARIO("Select levels of detail from projected sizes")
+	{
+		GIVEN("A group of three levels with thresholds 0.5 and 0.25 and a hysteresis of 10%")
+		{
+			Lod::Lod_group const lod_group{ { 0.5f, 0.25f }, 0.1f };
+
+			CHECK(Lod::get_num_lod_levels(lod_group) == 3);
+
+			WHEN("The levels of entities close to the thresholds are selected")
+			{
+				std::vector<float> const projected_sizes{ 0.47f, 0.44f, 0.53f, 0.56f, 0.1f, 0.26f, 0.24f, 1.0f };
+				std::vector<Lod_level> const levels{ { 0 }, { 0 }, { 1 }, { 1 }, { 0 }, { 2 }, { 1 }, { 2 } };
+
+				std::vector<std::uint8_t> const selected_levels = get_values(select(lod_group, projected_sizes, levels));
+
+				THEN("They only change once the projected size crosses a threshold by more than the hysteresis")
+				{
+					CHECK(selected_levels == std::vector<std::uint8_t>{ 0, 1, 1, 0, 2, 2, 1, 0 });
+				}
+			}
+		}
+
+		GIVEN("Random projected sizes and previous levels")
+		{
+			Lod::Lod_group const lod_group{ { 0.8f, 0.4f, 0.2f, 0.1f, 0.05f }, 0.15f };
+
+			std::mt19937 random_engine{ 7 };
+			std::uniform_real_distribution<float> size_distribution{ 0.0f, 1.0f };
+			std::uniform_int_distribution<int> level_distribution{ 0, 5 };
+
+			std::vector<float> projected_sizes;
+			std::vector<Lod_level> levels;
+
+			for (std::size_t index = 0; index < 103; ++index)
+			{
+				projected_sizes.push_back(size_distribution(random_engine));
+				levels.push_back({ static_cast<std::uint8_t>(level_distribution(random_engine)) });
+			}
+
+			WHEN("They are selected with the SIMD and the scalar kernels")
+			{
+				std::vector<Lod_level> simd_levels = levels;
+				Lod::select_lod_levels(lod_group, projected_sizes.data(), projected_sizes.size(), simd_levels.data());
+
+				std::vector<Lod_level> scalar_levels = levels;
+				Lod::select_lod_levels_scalar(lod_group, projected_sizes.data(), projected_sizes.size(), scalar_levels.data());
+
+				THEN("Both select the same levels")
+				{
+					CHECK(get_values(simd_levels) == get_values(scalar_levels));
+				}
+			}
+		}
+	}
+
+	SCENARIO("Select the level of detail of entities and cull them into per level lists")
+	{
+		GIVEN("Five entities with world bounds at different distances from the camera")
+		{
+			Entity_manager entity_manager{};
+
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<Transform_matrix, World_bounds, Lod_level, Entity>(2, Space{ 0 });
+
+			std::vector<float> const distances{ 100.0f, 2.0f, 10.0f, 3.0f, 12.0f };
+
+			for (float const distance : distances)
+			{
+				Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+				matrix(2, 3) = distance;
+
+				Spatial::Aabb const bounds{ { -1.0f, -1.0f, distance - 1.0f }, { 1.0f, 1.0f, distance + 1.0f } };
+
+				entity_manager.create_entity(entity_type_id, Transform_matrix{ matrix }, World_bounds{ bounds }, Lod_level{ 0 });
+			}
+
+			std::vector<Entity_type_id> const entity_type_ids{ entity_type_id };
+			std::vector<Lod::Lod_group> const lod_groups{ { { 0.5f, 0.1f }, 0.1f } };
+
+			WHEN("The levels are selected from a camera at the origin")
+			{
+				float const projection_scale = Lod::calculate_projection_scale(1.5707964f);
+				CHECK(projection_scale == Approx(1.0f));
+
+				Lod_selection_system lod_selection_system;
+				lod_selection_system.execute(entity_manager, entity_type_ids, lod_groups, Eigen::Vector3f::Zero(), projection_scale);
+
+				THEN("Closer entities get more detailed levels")
+				{
+					std::vector<std::uint8_t> levels;
+
+					for (std::size_t chunk_index = 0; chunk_index < entity_manager.get_component_group(entity_type_id).num_chunks(); ++chunk_index)
+					{
+						for (Lod_level const level : entity_manager.get_component_group(entity_type_id).components<Lod_level>(chunk_index))
+						{
+							levels.push_back(level.value);
+						}
+					}
+
+					CHECK(levels == std::vector<std::uint8_t>{ 2, 0, 1, 0, 1 });
+				}
+
+				AND_WHEN("The entities are culled")
+				{
+					float const near_z = 1.0f;
+					float const far_z = 1000.0f;
+
+					Eigen::Matrix4f projection_matrix;
+					projection_matrix <<
+						1.0f, 0.0f, 0.0f, 0.0f,
+						0.0f, 1.0f, 0.0f, 0.0f,
+						0.0f, 0.0f, far_z / (far_z - near_z), -near_z * far_z / (far_z - near_z),
+						0.0f, 0.0f, 1.0f, 0.0f;
+
+					Maia::Utilities::Worker_threads worker_threads{ 2 };
+					Culling::Frustum_culling_system frustum_culling_system{ worker_threads };
+					Culling::Visible_instances visible_instances;
+					frustum_culling_system.execute(entity_manager, entity_type_ids, Spatial::create_frustum(projection_matrix), visible_instances);
+
+					THEN("The visible instances are grouped by level")
+					{
+						auto const get_distances = [&visible_instances](std::size_t const lod_level) -> std::vector<float>
+						{
+							std::vector<float> distances;
+
+							for (Transform_matrix const& transform_matrix : Culling::get_visible_transform_matrices(visible_instances, 0, lod_level))
+							{
+								distances.push_back(transform_matrix.value(2, 3));
+							}
+
+							return distances;
+						};
+
+						CHECK(Culling::get_visible_transform_matrices(visible_instances, 0).size() == 5);
+						CHECK(get_distances(0) == std::vector<float>{ 2.0f, 3.0f });
+						CHECK(get_distances(1) == std::vector<float>{ 10.0f, 12.0f });
+						CHECK(get_distances(2) == std::vector<float>{ 100.0f });
+						CHECK(get_distances(3).empty());
+					}
+				}
+			}
+		}
+	}
+}
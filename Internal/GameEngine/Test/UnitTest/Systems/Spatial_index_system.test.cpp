@@ -0,0 +1,81 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Systems/Spatial_index_system.hpp>
+
+namespace Maia::GameEngine::Systems::Test
+{
+	SCENARIO("Keep a spatial index of the world bounds of entities")
+	{
+		GIVEN("An entity manager with two entities with unit local bounds")
+		{
+			Entity_manager entity_manager{};
+
+			auto const entity_type = entity_manager.create_entity_type<Local_bounds, Transform_matrix, World_bounds, Entity>(2, Space{ 0 });
+
+			Local_bounds const local_bounds{ { { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } } };
+
+			Eigen::Matrix4f translation_matrix = Eigen::Matrix4f::Identity();
+			translation_matrix(0, 3) = 10.0f;
+
+			Entity const entity_0 = entity_manager.create_entity(entity_type, local_bounds, Transform_matrix{}, World_bounds{});
+			Entity const entity_1 = entity_manager.create_entity(entity_type, local_bounds, Transform_matrix{ translation_matrix }, World_bounds{});
+
+			Spatial_index_system spatial_index_system{ 0.0f };
+
+			auto const query = [&spatial_index_system](Spatial::Aabb const& aabb) -> std::vector<Entity>
+			{
+				std::vector<Entity> entities;
+				spatial_index_system.get_tree().query(aabb, [&entities](Entity const entity) -> void { entities.push_back(entity); });
+				return entities;
+			};
+
+			WHEN("The spatial index system is executed")
+			{
+				spatial_index_system.execute(entity_manager);
+
+				THEN("The world bounds are calculated from the transform matrices")
+				{
+					World_bounds const world_bounds = entity_manager.get_component_data<World_bounds>(entity_1);
+
+					CHECK(world_bounds.value == Spatial::Aabb{ { 9.5f, -0.5f, -0.5f }, { 10.5f, 0.5f, 0.5f } });
+				}
+
+				THEN("Both entities can be found in the tree")
+				{
+					CHECK(spatial_index_system.contains(entity_0));
+					CHECK(spatial_index_system.contains(entity_1));
+					CHECK(query({ { 9.0f, -1.0f, -1.0f }, { 11.0f, 1.0f, 1.0f } }) == std::vector<Entity>{ entity_1 });
+				}
+
+				AND_WHEN("Entity 0 is moved and only the changed entities are updated")
+				{
+					Eigen::Matrix4f new_matrix = Eigen::Matrix4f::Identity();
+					new_matrix(1, 3) = 20.0f;
+					entity_manager.set_component_data(entity_0, Transform_matrix{ new_matrix });
+
+					std::vector<Entity> const changed_entities{ entity_0 };
+					spatial_index_system.execute(entity_manager, changed_entities);
+
+					THEN("Entity 0 is found at its new position")
+					{
+						CHECK(query({ { -1.0f, 19.0f, -1.0f }, { 1.0f, 21.0f, 1.0f } }) == std::vector<Entity>{ entity_0 });
+						CHECK(query({ { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } }).empty());
+					}
+				}
+
+				AND_WHEN("Entity 1 is removed")
+				{
+					spatial_index_system.remove(entity_1);
+
+					THEN("It is no longer in the tree")
+					{
+						CHECK(!spatial_index_system.contains(entity_1));
+						CHECK(spatial_index_system.get_tree().size() == 1);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Components/World_bounds.hpp>
+#include <Maia/GameEngine/Systems/Spatial_sort_system.hpp>
+
+namespace Maia::GameEngine::Systems::Test
+{
+	using Components::World_bounds;
+
+	namespace
+	{
+		World_bounds create_bounds(float const x)
+		{
+			return { { { x - 0.5f, -0.5f, -0.5f }, { x + 0.5f, 0.5f, 0.5f } } };
+		}
+
+		std::vector<float> get_centers(Entity_manager const& entity_manager, Entity_type_id const entity_type_id)
+		{
+			Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
+
+			std::vector<float> centers;
+
+			for (std::size_t index = 0; index < component_group.size(); ++index)
+			{
+				centers.push_back(Spatial::center(component_group.get_component_data<World_bounds>({ index }).value)(0));
+			}
+
+			return centers;
+		}
+	}
+
+	SCENARIO("Sort entities by the Morton code of their world bounds")
+	{
+		GIVEN("An entity manager with five entities along the x axis in chunks of two")
+		{
+			Entity_manager entity_manager{};
+
+			Entity_type_id const entity_type = entity_manager.create_entity_type<World_bounds, Entity>(2, Space{ 0 });
+			Entity_type_id const entity_type_ids[] = { entity_type };
+
+			Entity const entity_3 = entity_manager.create_entity(entity_type, create_bounds(3.0f));
+			entity_manager.create_entity(entity_type, create_bounds(0.0f));
+			entity_manager.create_entity(entity_type, create_bounds(4.0f));
+			Entity const entity_1 = entity_manager.create_entity(entity_type, create_bounds(1.0f));
+			entity_manager.create_entity(entity_type, create_bounds(2.0f));
+
+			WHEN("They are sorted at once")
+			{
+				Spatial_sort_system::sort(entity_manager, entity_type_ids);
+
+				THEN("They are ordered along the axis and can still be found")
+				{
+					CHECK(get_centers(entity_manager, entity_type) == std::vector<float>{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f });
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_1).value == create_bounds(1.0f).value);
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_3).value == create_bounds(3.0f).value);
+				}
+			}
+
+			WHEN("They are sorted incrementally, one swap at a time")
+			{
+				Spatial_sort_system spatial_sort_system;
+
+				std::size_t num_executions = 0;
+
+				while (get_centers(entity_manager, entity_type) != std::vector<float>{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f } && num_executions < 10)
+				{
+					spatial_sort_system.execute(entity_manager, entity_type_ids, 1);
+					++num_executions;
+				}
+
+				THEN("They end up ordered along the axis after several executions")
+				{
+					CHECK(num_executions > 1);
+					CHECK(get_centers(entity_manager, entity_type) == std::vector<float>{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f });
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_1).value == create_bounds(1.0f).value);
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_3).value == create_bounds(3.0f).value);
+				}
+
+				AND_WHEN("An entity moves to the other end and the system keeps running")
+				{
+					entity_manager.set_component_data(entity_1, create_bounds(5.0f));
+
+					for (std::size_t execution = 0; execution < 10; ++execution)
+					{
+						spatial_sort_system.execute(entity_manager, entity_type_ids, 1);
+					}
+
+					THEN("It is moved to the end of the group")
+					{
+						CHECK(get_centers(entity_manager, entity_type) == std::vector<float>{ 0.0f, 2.0f, 3.0f, 4.0f, 5.0f });
+					}
+				}
+			}
+		}
+	}
+}
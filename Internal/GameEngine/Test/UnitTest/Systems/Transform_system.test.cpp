@@ -518,4 +518,211 @@ namespace Maia::GameEngine::Systems::Test
 			}
 		}
 	}
+
+	SCENARIO("Execute transform system using a transform hierarchy")
+	{
+		GIVEN("An entity manager with a dirty root transform and two levels of child transforms")
+		{
+			Entity_manager entity_manager{};
+
+			auto const root_transform_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_tree_dirty, Entity>(1, Space{ 0 });
+			auto const child_transform_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_root, Transform_parent, Entity>(2, Space{ 0 });
+
+			Entity const root_transform_entity = entity_manager.create_entity(
+				root_transform_entity_type,
+				Local_position{ { 1.0f, 0.0f, 0.0f } },
+				Local_rotation{ { 1.0f, 0.0f, 0.0f, 0.0f } },
+				Transform_matrix{},
+				Transform_tree_dirty{ true }
+			);
+
+			Entity const child_transform_entity_0 = entity_manager.create_entity(
+				child_transform_entity_type,
+				Local_position{ { 0.0f, 2.0f, 0.0f } },
+				Local_rotation{ { 1.0f, 0.0f, 0.0f, 0.0f } },
+				Transform_matrix{},
+				Transform_root{ root_transform_entity },
+				Transform_parent{ root_transform_entity }
+			);
+
+			Entity const child_transform_entity_1 = entity_manager.create_entity(
+				child_transform_entity_type,
+				Local_position{ { 0.0f, 0.0f, 3.0f } },
+				Local_rotation{ { 1.0f, 0.0f, 0.0f, 0.0f } },
+				Transform_matrix{},
+				Transform_root{ root_transform_entity },
+				Transform_parent{ child_transform_entity_0 }
+			);
+
+			Transform_hierarchy const transform_hierarchy = create_transform_hierarchy(entity_manager);
+
+			THEN("The hierarchy contains the parent of every child transform")
+			{
+				CHECK(transform_hierarchy.get_children(root_transform_entity) == std::vector<Entity>{ child_transform_entity_0 });
+				CHECK(transform_hierarchy.get_children(child_transform_entity_0) == std::vector<Entity>{ child_transform_entity_1 });
+				CHECK(!transform_hierarchy.get_parent(root_transform_entity).has_value());
+			}
+
+			WHEN("The transform system is executed")
+			{
+				Transform_system{}.execute(entity_manager, transform_hierarchy);
+
+				THEN("The transform_tree_dirty flag is false")
+				{
+					CHECK(entity_manager.get_component_data<Transform_tree_dirty>(root_transform_entity).value == false);
+				}
+
+				THEN("The child transform 1 is calculated correctly")
+				{
+					Transform_matrix const transform_matrix =
+						entity_manager.get_component_data<Transform_matrix>(child_transform_entity_1);
+
+					Eigen::Matrix4f expected_transform_matrix;
+					expected_transform_matrix <<
+						1.0f, 0.0f, 0.0f, 1.0f,
+						0.0f, 1.0f, 0.0f, 2.0f,
+						0.0f, 0.0f, 1.0f, 3.0f,
+						0.0f, 0.0f, 0.0f, 1.0f;
+
+					CHECK(transform_matrix.value.isApprox(expected_transform_matrix));
+				}
+			}
+
+			WHEN("The transform system is executed and asked for the changed entities")
+			{
+				std::vector<Entity> changed_entities;
+				Transform_system{}.execute(entity_manager, transform_hierarchy, changed_entities);
+
+				THEN("The root and all its descendants are reported")
+				{
+					CHECK(changed_entities == std::vector<Entity>{ root_transform_entity, child_transform_entity_0, child_transform_entity_1 });
+				}
+
+				AND_WHEN("The transform system is executed again without dirty trees")
+				{
+					changed_entities.clear();
+					Transform_system{}.execute(entity_manager, transform_hierarchy, changed_entities);
+
+					THEN("No entity is reported")
+					{
+						CHECK(changed_entities.empty());
+					}
+				}
+			}
+		}
+	}
+
+	SCENARIO("Reparent and destroy entities of a transform hierarchy")
+	{
+		GIVEN("An entity manager with two root transforms and two levels of child transforms under the first root")
+		{
+			Entity_manager entity_manager{};
+
+			auto const root_transform_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_tree_dirty, Entity>(2, Space{ 0 });
+			auto const child_transform_entity_type = entity_manager.create_entity_type<Local_position, Local_rotation, Transform_matrix, Transform_root, Transform_parent, Entity>(2, Space{ 0 });
+
+			auto const create_root = [&](float const x) -> Entity
+			{
+				return entity_manager.create_entity(
+					root_transform_entity_type,
+					Local_position{ { x, 0.0f, 0.0f } },
+					Local_rotation{ { 1.0f, 0.0f, 0.0f, 0.0f } },
+					Transform_matrix{},
+					Transform_tree_dirty{ true }
+				);
+			};
+
+			auto const create_child = [&](Entity const root, Entity const parent, float const y) -> Entity
+			{
+				return entity_manager.create_entity(
+					child_transform_entity_type,
+					Local_position{ { 0.0f, y, 0.0f } },
+					Local_rotation{ { 1.0f, 0.0f, 0.0f, 0.0f } },
+					Transform_matrix{},
+					Transform_root{ root },
+					Transform_parent{ parent }
+				);
+			};
+
+			Entity const root_transform_entity_0 = create_root(1.0f);
+			Entity const root_transform_entity_1 = create_root(10.0f);
+			Entity const child_transform_entity_0 = create_child(root_transform_entity_0, root_transform_entity_0, 2.0f);
+			Entity const child_transform_entity_1 = create_child(root_transform_entity_0, child_transform_entity_0, 3.0f);
+
+			Transform_hierarchy transform_hierarchy = create_transform_hierarchy(entity_manager);
+			Transform_system{}.execute(entity_manager, transform_hierarchy);
+
+			WHEN("The first child transform is moved to the second root")
+			{
+				set_transform_parent(entity_manager, transform_hierarchy, child_transform_entity_0, root_transform_entity_1);
+
+				THEN("The hierarchy and the components of the moved subtree refer to the new parent and root")
+				{
+					CHECK(transform_hierarchy.get_children(root_transform_entity_0).empty());
+					CHECK(transform_hierarchy.get_children(root_transform_entity_1) == std::vector<Entity>{ child_transform_entity_0 });
+					CHECK(entity_manager.get_component_data<Transform_parent>(child_transform_entity_0).entity == root_transform_entity_1);
+					CHECK(entity_manager.get_component_data<Transform_root>(child_transform_entity_0).entity == root_transform_entity_1);
+					CHECK(entity_manager.get_component_data<Transform_root>(child_transform_entity_1).entity == root_transform_entity_1);
+					CHECK(entity_manager.get_component_data<Transform_tree_dirty>(root_transform_entity_1).value);
+				}
+
+				AND_WHEN("The transform system is executed")
+				{
+					Transform_system{}.execute(entity_manager, transform_hierarchy);
+
+					THEN("The moved subtree is transformed by the new root")
+					{
+						Transform_matrix const transform_matrix =
+							entity_manager.get_component_data<Transform_matrix>(child_transform_entity_1);
+
+						CHECK(transform_matrix.value.col(3).isApprox(Eigen::Vector4f{ 10.0f, 5.0f, 0.0f, 1.0f }));
+					}
+				}
+			}
+
+			WHEN("The first child transform is destroyed and two child transforms are created in its place")
+			{
+				destroy_transform_entity(entity_manager, transform_hierarchy, child_transform_entity_0);
+
+				Entity const new_child_transform_entity_0 = create_child(root_transform_entity_0, root_transform_entity_0, 4.0f);
+				set_transform_parent(entity_manager, transform_hierarchy, new_child_transform_entity_0, root_transform_entity_0);
+
+				Entity const new_child_transform_entity_1 = create_child(root_transform_entity_0, root_transform_entity_0, 5.0f);
+				set_transform_parent(entity_manager, transform_hierarchy, new_child_transform_entity_1, root_transform_entity_0);
+
+				THEN("The whole destroyed subtree was destroyed")
+				{
+					CHECK(entity_manager.num_entities() == 4);
+					CHECK(entity_manager.get_generation(child_transform_entity_0) == 1);
+					CHECK(entity_manager.get_generation(child_transform_entity_1) == 1);
+				}
+
+				THEN("The new child transforms reuse the destroyed values without their links")
+				{
+					CHECK(new_child_transform_entity_0 == child_transform_entity_1);
+					CHECK(new_child_transform_entity_1 == child_transform_entity_0);
+
+					CHECK(transform_hierarchy.get_children(root_transform_entity_0) == std::vector<Entity>{ new_child_transform_entity_1, new_child_transform_entity_0 });
+					CHECK(!transform_hierarchy.has_children(new_child_transform_entity_0));
+					CHECK(!transform_hierarchy.has_children(new_child_transform_entity_1));
+				}
+
+				AND_WHEN("The transform system is executed and asked for the changed entities")
+				{
+					std::vector<Entity> changed_entities;
+					Transform_system{}.execute(entity_manager, transform_hierarchy, changed_entities);
+
+					THEN("Only the entities of the dirty tree are reported and transformed")
+					{
+						CHECK(changed_entities == std::vector<Entity>{ root_transform_entity_0, new_child_transform_entity_1, new_child_transform_entity_0 });
+
+						Transform_matrix const transform_matrix =
+							entity_manager.get_component_data<Transform_matrix>(new_child_transform_entity_1);
+
+						CHECK(transform_matrix.value.col(3).isApprox(Eigen::Vector4f{ 1.0f, 5.0f, 0.0f, 1.0f }));
+					}
+				}
+			}
+		}
+	}
 }
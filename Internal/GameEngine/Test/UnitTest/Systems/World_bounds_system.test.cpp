@@ -0,0 +1,100 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Systems/World_bounds_system.hpp>
+
+namespace Maia::GameEngine::Systems::Test
+{
+	SCENARIO("Transform local bounds into world bounds")
+	{
+		GIVEN("Local bounds and a transform that rotates 90 degrees around z, scales by 2 and translates")
+		{
+			Local_bounds const local_bounds{ { { -1.0f, -2.0f, -3.0f }, { 1.0f, 2.0f, 3.0f } } };
+
+			Eigen::Matrix4f matrix;
+			matrix <<
+				0.0f, -2.0f, 0.0f, 10.0f,
+				2.0f, 0.0f, 0.0f, 20.0f,
+				0.0f, 0.0f, 2.0f, 30.0f,
+				0.0f, 0.0f, 0.0f, 1.0f;
+
+			Transform_matrix const transform_matrix{ matrix };
+
+			WHEN("The bounds are transformed")
+			{
+				World_bounds world_bounds;
+				transform_bounds({ &local_bounds, 1 }, { &transform_matrix, 1 }, { &world_bounds, 1 });
+
+				THEN("The result matches the reference implementation")
+				{
+					CHECK(world_bounds.value == Spatial::transform(local_bounds.value, matrix));
+					CHECK(world_bounds.value == Spatial::Aabb{ { 6.0f, 18.0f, 24.0f }, { 14.0f, 22.0f, 36.0f } });
+				}
+			}
+		}
+	}
+
+	SCENARIO("Update the world bounds of entities")
+	{
+		GIVEN("An entity manager with three entities with local bounds in chunks of two")
+		{
+			Entity_manager entity_manager{};
+
+			auto const entity_type = entity_manager.create_entity_type<Local_bounds, Transform_matrix, World_bounds, Entity>(2, Space{ 0 });
+
+			Local_bounds const local_bounds{ { { -0.5f, -0.5f, -0.5f }, { 0.5f, 0.5f, 0.5f } } };
+
+			auto const create_translation = [](float const x) -> Transform_matrix
+			{
+				Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+				matrix(0, 3) = x;
+				return { matrix };
+			};
+
+			Entity const entity_0 = entity_manager.create_entity(entity_type, local_bounds, create_translation(1.0f), World_bounds{});
+			Entity const entity_1 = entity_manager.create_entity(entity_type, local_bounds, create_translation(2.0f), World_bounds{});
+			Entity const entity_2 = entity_manager.create_entity(entity_type, local_bounds, create_translation(3.0f), World_bounds{});
+
+			World_bounds_system world_bounds_system;
+
+			WHEN("The system is executed for every entity")
+			{
+				world_bounds_system.execute(entity_manager);
+
+				THEN("The world bounds of the entities of every chunk are updated")
+				{
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_0).value == Spatial::Aabb{ { 0.5f, -0.5f, -0.5f }, { 1.5f, 0.5f, 0.5f } });
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_1).value == Spatial::Aabb{ { 1.5f, -0.5f, -0.5f }, { 2.5f, 0.5f, 0.5f } });
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_2).value == Spatial::Aabb{ { 2.5f, -0.5f, -0.5f }, { 3.5f, 0.5f, 0.5f } });
+				}
+			}
+
+			WHEN("The system is executed only for entity 2")
+			{
+				std::vector<Entity> const changed_entities{ entity_2 };
+				world_bounds_system.execute(entity_manager, changed_entities);
+
+				THEN("Only the world bounds of entity 2 are updated")
+				{
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_0).value == Spatial::Aabb{});
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_2).value == Spatial::Aabb{ { 2.5f, -0.5f, -0.5f }, { 3.5f, 0.5f, 0.5f } });
+				}
+			}
+
+			WHEN("The system is executed for entities of different chunks and a destroyed entity")
+			{
+				entity_manager.destroy_entity(entity_1);
+
+				std::vector<Entity> const changed_entities{ entity_2, entity_1, entity_0 };
+				world_bounds_system.execute(entity_manager, changed_entities);
+
+				THEN("The world bounds of the existing entities are updated")
+				{
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_0).value == Spatial::Aabb{ { 0.5f, -0.5f, -0.5f }, { 1.5f, 0.5f, 0.5f } });
+					CHECK(entity_manager.get_component_data<World_bounds>(entity_2).value == Spatial::Aabb{ { 2.5f, -0.5f, -0.5f }, { 3.5f, 0.5f, 0.5f } });
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/GameEngine/Transform_hierarchy.hpp>
+
+namespace Maia::GameEngine::Test
+{
+	namespace
+	{
+		std::vector<std::pair<Entity, Entity>> get_descendants(Transform_hierarchy const& transform_hierarchy, Entity const root)
+		{
+			std::vector<std::pair<Entity, Entity>> descendants;
+
+			transform_hierarchy.for_each_descendant(root, [&descendants](Entity const entity, Entity const parent) -> void
+			{
+				descendants.emplace_back(entity, parent);
+			});
+
+			return descendants;
+		}
+	}
+
+	SCENARIO("Maintain a transform hierarchy", "[Transform_hierarchy]")
+	{
+		GIVEN("A hierarchy where 0 is the parent of 1 and 2, and 2 is the parent of 3")
+		{
+			Transform_hierarchy transform_hierarchy;
+			transform_hierarchy.set_parent(Entity{ 1 }, Entity{ 0 });
+			transform_hierarchy.set_parent(Entity{ 2 }, Entity{ 0 });
+			transform_hierarchy.set_parent(Entity{ 3 }, Entity{ 2 });
+
+			THEN("The children and parents are reported")
+			{
+				CHECK(transform_hierarchy.get_children(Entity{ 0 }).size() == 2);
+				CHECK(transform_hierarchy.get_children(Entity{ 2 }) == std::vector<Entity>{ Entity{ 3 } });
+				CHECK(!transform_hierarchy.has_children(Entity{ 1 }));
+				CHECK(transform_hierarchy.get_parent(Entity{ 3 }) == Entity{ 2 });
+				CHECK(!transform_hierarchy.get_parent(Entity{ 0 }).has_value());
+				CHECK(transform_hierarchy.is_ancestor(Entity{ 0 }, Entity{ 3 }));
+				CHECK(!transform_hierarchy.is_ancestor(Entity{ 1 }, Entity{ 3 }));
+			}
+
+			THEN("Entities that were never added have no parent and no children")
+			{
+				CHECK(!transform_hierarchy.get_parent(Entity{ 100 }).has_value());
+				CHECK(transform_hierarchy.get_children(Entity{ 100 }).empty());
+			}
+
+			THEN("The subtree of 0 is visited with every parent before its children")
+			{
+				std::vector<std::pair<Entity, Entity>> const descendants = get_descendants(transform_hierarchy, Entity{ 0 });
+
+				REQUIRE(descendants.size() == 3);
+
+				auto const position_of = [&descendants](Entity const entity) -> std::size_t
+				{
+					return static_cast<std::size_t>(std::distance(descendants.begin(), std::find_if(descendants.begin(), descendants.end(),
+						[entity](std::pair<Entity, Entity> const& descendant) -> bool { return descendant.first == entity; })));
+				};
+
+				CHECK(position_of(Entity{ 2 }) < position_of(Entity{ 3 }));
+				CHECK(descendants[position_of(Entity{ 3 })].second == Entity{ 2 });
+				CHECK(descendants[position_of(Entity{ 1 })].second == Entity{ 0 });
+			}
+
+			THEN("The subtree of 2 only contains 3")
+			{
+				std::vector<std::pair<Entity, Entity>> const descendants = get_descendants(transform_hierarchy, Entity{ 2 });
+
+				REQUIRE(descendants.size() == 1);
+				CHECK(descendants[0].first == Entity{ 3 });
+			}
+
+			WHEN("2 is reparented to 1")
+			{
+				transform_hierarchy.set_parent(Entity{ 2 }, Entity{ 1 });
+
+				THEN("2 is moved with its subtree")
+				{
+					CHECK(transform_hierarchy.get_children(Entity{ 0 }) == std::vector<Entity>{ Entity{ 1 } });
+					CHECK(transform_hierarchy.get_children(Entity{ 1 }) == std::vector<Entity>{ Entity{ 2 } });
+					CHECK(transform_hierarchy.get_parent(Entity{ 3 }) == Entity{ 2 });
+					CHECK(get_descendants(transform_hierarchy, Entity{ 0 }).size() == 3);
+				}
+			}
+
+			WHEN("The parent of 1 is removed")
+			{
+				transform_hierarchy.remove_parent(Entity{ 1 });
+
+				THEN("1 becomes a root")
+				{
+					CHECK(!transform_hierarchy.get_parent(Entity{ 1 }).has_value());
+					CHECK(transform_hierarchy.get_children(Entity{ 0 }) == std::vector<Entity>{ Entity{ 2 } });
+				}
+			}
+
+			WHEN("2 is removed")
+			{
+				transform_hierarchy.remove(Entity{ 2 });
+
+				THEN("2 is detached from its parent and from its children")
+				{
+					CHECK(transform_hierarchy.get_children(Entity{ 0 }) == std::vector<Entity>{ Entity{ 1 } });
+					CHECK(!transform_hierarchy.has_children(Entity{ 2 }));
+					CHECK(!transform_hierarchy.get_parent(Entity{ 3 }).has_value());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#include "Copy_region.hpp"
+
+#include <algorithm>
+
+namespace Maia::Renderer
+{
+	void coalesce_copy_regions(std::vector<Copy_region>& copy_regions)
+	{
+		if (copy_regions.empty())
+		{
+			return;
+		}
+
+		std::stable_sort(copy_regions.begin(), copy_regions.end(), [](Copy_region const& lhs, Copy_region const& rhs) -> bool
+		{
+			return lhs.destination != rhs.destination ?
+				lhs.destination < rhs.destination :
+				lhs.destination_offset < rhs.destination_offset;
+		});
+
+		auto last_merged = copy_regions.begin();
+
+		for (auto current = copy_regions.begin() + 1; current != copy_regions.end(); ++current)
+		{
+			bool const is_contiguous =
+				current->source == last_merged->source &&
+				current->destination == last_merged->destination &&
+				current->source_offset == last_merged->source_offset + last_merged->size &&
+				current->destination_offset == last_merged->destination_offset + last_merged->size;
+
+			if (is_contiguous)
+			{
+				last_merged->size += current->size;
+			}
+			else
+			{
+				++last_merged;
+				*last_merged = *current;
+			}
+		}
+
+		copy_regions.erase(last_merged + 1, copy_regions.end());
+	}
+}
@@ -0,0 +1,25 @@
+#ifndef MAIA_RENDERER_COPYREGION_H_INCLUDED
+#define MAIA_RENDERER_COPYREGION_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Maia::Renderer
+{
+	// Copy between buffers identified by the caller, like the index of the buffer in a list of the frame.
+	struct Copy_region
+	{
+		std::size_t source;
+		std::size_t destination;
+		std::uint64_t source_offset;
+		std::uint64_t destination_offset;
+		std::uint64_t size;
+	};
+
+	// Sorts the regions by destination and merges the ones between the same buffers that are contiguous both in the
+	// source and in the destination, so that data written in many pieces is copied with few commands.
+	void coalesce_copy_regions(std::vector<Copy_region>& copy_regions);
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cassert>
+
+#include "Check_hresult.hpp"
+#include "D3D12_utilities.hpp"
+
+#include <Maia/Renderer/Growable_buffer.hpp>
+#include <Maia/Renderer/D3D12/Utilities/Upload_ring_buffer.hpp>
+
+namespace Maia::Renderer::D3D12
+{
+	namespace
+	{
+		UINT64 align(UINT64 const value, UINT64 const alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	Upload_ring_buffer::Upload_ring_buffer(ID3D12Device& device, UINT64 const capacity) :
+		m_device{ device },
+		m_buffer{ create_mapped_buffer(device, capacity) },
+		m_ring_allocator{ static_cast<std::size_t>(align(capacity, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)) },
+		m_buffers_to_retire{},
+		m_retired_buffers{}
+	{
+	}
+
+	Upload_ring_buffer::~Upload_ring_buffer()
+	{
+		for (Retired_buffer const& retired_buffer : m_retired_buffers)
+		{
+			unmap(retired_buffer.buffer);
+		}
+
+		for (Buffer const& buffer : m_buffers_to_retire)
+		{
+			unmap(buffer);
+		}
+
+		unmap(m_buffer);
+	}
+
+	Upload_allocation Upload_ring_buffer::allocate(UINT64 const size, UINT64 const alignment)
+	{
+		std::optional<std::size_t> offset = m_ring_allocator.allocate(size, alignment);
+
+		if (!offset)
+		{
+			UINT64 const new_capacity = calculate_grown_capacity(
+				m_ring_allocator.capacity(),
+				size + alignment,
+				D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT
+			);
+
+			m_buffers_to_retire.push_back(std::move(m_buffer));
+			m_buffer = create_mapped_buffer(m_device, new_capacity);
+			m_ring_allocator = Maia::Renderer::Ring_allocator{ static_cast<std::size_t>(new_capacity) };
+
+			offset = m_ring_allocator.allocate(size, alignment);
+			assert(offset);
+		}
+
+		return { *m_buffer.resource, *offset, m_buffer.data + *offset };
+	}
+
+	void Upload_ring_buffer::finish_frame(UINT64 const fence_value)
+	{
+		m_ring_allocator.finish_frame(fence_value);
+
+		// Replaced buffers may still be read by this frame or by the previous ones, which complete before it
+		for (Buffer& buffer : m_buffers_to_retire)
+		{
+			m_retired_buffers.push_back({ std::move(buffer), fence_value });
+		}
+
+		m_buffers_to_retire.clear();
+	}
+
+	void Upload_ring_buffer::release_completed_frames(UINT64 const completed_fence_value)
+	{
+		m_ring_allocator.release_completed_frames(completed_fence_value);
+
+		auto const first_completed = std::stable_partition(m_retired_buffers.begin(), m_retired_buffers.end(), [completed_fence_value](Retired_buffer const& retired_buffer) -> bool
+		{
+			return retired_buffer.fence_value > completed_fence_value;
+		});
+
+		std::for_each(first_completed, m_retired_buffers.end(), [](Retired_buffer const& retired_buffer) -> void
+		{
+			unmap(retired_buffer.buffer);
+		});
+
+		m_retired_buffers.erase(first_completed, m_retired_buffers.end());
+	}
+
+	UINT64 Upload_ring_buffer::capacity() const
+	{
+		return m_ring_allocator.capacity();
+	}
+
+	Upload_ring_buffer::Buffer Upload_ring_buffer::create_mapped_buffer(ID3D12Device& device, UINT64 const capacity)
+	{
+		UINT64 const aligned_capacity = align(capacity, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+
+		winrt::com_ptr<ID3D12Heap> heap = create_upload_heap(device, aligned_capacity);
+		winrt::com_ptr<ID3D12Resource> resource = create_buffer(device, *heap, 0, aligned_capacity, D3D12_RESOURCE_STATE_GENERIC_READ);
+
+		// Upload heaps can stay mapped while the GPU reads them. The CPU never reads, so the read range is empty.
+		void* data;
+		D3D12_RANGE const read_range{ 0, 0 };
+		check_hresult(
+			resource->Map(0, &read_range, &data));
+
+		return { std::move(heap), std::move(resource), static_cast<std::byte*>(data) };
+	}
+
+	void Upload_ring_buffer::unmap(Buffer const& buffer)
+	{
+		if (buffer.resource)
+		{
+			buffer.resource->Unmap(0, nullptr);
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#ifndef MAIA_RENDERER_D3D12_UPLOADRINGBUFFER_H_INCLUDED
+#define MAIA_RENDERER_D3D12_UPLOADRINGBUFFER_H_INCLUDED
+
+#include <cstddef>
+#include <vector>
+
+#include <winrt/base.h>
+
+#include <d3d12.h>
+
+#include <Maia/Renderer/Ring_allocator.hpp>
+
+namespace Maia::Renderer::D3D12
+{
+	struct Upload_allocation
+	{
+		ID3D12Resource& buffer;
+		UINT64 offset;
+		std::byte* data;
+	};
+
+	// Upload buffer that stays mapped for its whole lifetime and is suballocated to the frames in flight.
+	// When an allocation does not fit, a buffer twice as large replaces it and the old one is destroyed once the
+	// frames that use it are completed.
+	class Upload_ring_buffer
+	{
+	public:
+
+		Upload_ring_buffer(ID3D12Device& device, UINT64 capacity);
+		Upload_ring_buffer(Upload_ring_buffer const&) = delete;
+		Upload_ring_buffer(Upload_ring_buffer&&) = delete;
+		~Upload_ring_buffer();
+
+		Upload_ring_buffer& operator=(Upload_ring_buffer const&) = delete;
+		Upload_ring_buffer& operator=(Upload_ring_buffer&&) = delete;
+
+
+		Upload_allocation allocate(UINT64 size, UINT64 alignment);
+
+		void finish_frame(UINT64 fence_value);
+
+		void release_completed_frames(UINT64 completed_fence_value);
+
+
+		UINT64 capacity() const;
+
+
+	private:
+
+		struct Buffer
+		{
+			winrt::com_ptr<ID3D12Heap> heap;
+			winrt::com_ptr<ID3D12Resource> resource;
+			std::byte* data;
+		};
+
+		struct Retired_buffer
+		{
+			Buffer buffer;
+			UINT64 fence_value;
+		};
+
+
+		static Buffer create_mapped_buffer(ID3D12Device& device, UINT64 capacity);
+
+		static void unmap(Buffer const& buffer);
+
+
+		ID3D12Device& m_device;
+		Buffer m_buffer;
+		Maia::Renderer::Ring_allocator m_ring_allocator;
+		std::vector<Buffer> m_buffers_to_retire;
+		std::vector<Retired_buffer> m_retired_buffers;
+
+	};
+}
+
+#endif
@@ -0,0 +1,24 @@
+#include "Frame_packet.hpp"
+
+namespace Maia::Renderer
+{
+	void write_draws(
+		Render_queue const& render_queue,
+		gsl::span<std::uint32_t const> const instance_slots,
+		Frame_packet& frame_packet
+	)
+	{
+		frame_packet.instance_slots.clear();
+		frame_packet.draws.clear();
+
+		for (Draw_item const& item : render_queue.get_items())
+		{
+			frame_packet.instance_slots.push_back(instance_slots[item.instance_index]);
+		}
+
+		for (Draw_batch const& batch : render_queue.get_batches())
+		{
+			frame_packet.draws.push_back({ get_draw_key(batch.sort_key).mesh, batch.first_item, batch.item_count });
+		}
+	}
+}
@@ -0,0 +1,133 @@
+#ifndef MAIA_RENDERER_FRAMEPACKET_H_INCLUDED
+#define MAIA_RENDERER_FRAMEPACKET_H_INCLUDED
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/Renderer/Instance_slots.hpp>
+#include <Maia/Renderer/Render_queue.hpp>
+
+namespace Maia::Renderer
+{
+	struct Instanced_draw
+	{
+		std::uint16_t mesh;
+		std::uint32_t first_instance;
+		std::uint32_t instance_count;
+	};
+
+	// Render data of a frame, copied out of the simulation so that the frame can be rendered while the next one
+	// is simulated.
+	// Instance transforms live in a resident buffer of instance_slot_capacity slots. Only the slots of
+	// updated_slot_ranges are uploaded, with the data of updated_transforms, and draws read their transforms through
+	// instance_slots. Updates are not repeated, so packets must not be dropped.
+	struct Frame_packet
+	{
+		std::uint64_t frame_number;
+		Eigen::Matrix4f view_matrix;
+		Eigen::Matrix4f projection_matrix;
+		std::uint32_t instance_slot_capacity;
+		std::vector<Slot_range> updated_slot_ranges;
+		std::vector<Eigen::Matrix4f> updated_transforms;
+		std::vector<std::uint32_t> instance_slots;
+		std::vector<Instanced_draw> draws;
+	};
+
+	// Replaces the instances and draws of frame_packet with the sorted items of render_queue, where the instance_index
+	// of an item indexes instance_slots. The instances of each draw are contiguous.
+	void write_draws(
+		Render_queue const& render_queue,
+		gsl::span<std::uint32_t const> instance_slots,
+		Frame_packet& frame_packet
+	);
+
+
+	// Triple buffer that hands packets from a producer thread to a consumer thread.
+	// The producer writes the next packet while the consumer reads the last acquired one. If the producer publishes
+	// twice before the consumer acquires, the older unread packet is replaced.
+	template <typename Packet>
+	class Frame_packet_buffer
+	{
+	public:
+
+		// Packet that the producer writes next. It holds an old frame, so that its storage is reused.
+		Packet& get_write_packet()
+		{
+			return m_packets[m_write_index];
+		}
+
+		void publish()
+		{
+			{
+				std::lock_guard<std::mutex> lock{ m_mutex };
+				std::swap(m_write_index, m_ready_index);
+				m_has_ready_packet = true;
+			}
+
+			m_condition_variable.notify_all();
+		}
+
+		// Blocks the producer until the consumer has acquired the last published packet or the buffer is closed,
+		// so that the producer is at most one frame ahead of the consumer.
+		void wait_until_acquired()
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_condition_variable.wait(lock, [this]() -> bool { return !m_has_ready_packet || m_closed; });
+		}
+
+		// Blocks the consumer until a new packet is published and returns it. The previously acquired packet is
+		// given back to the producer.
+		// Returns nullptr once the buffer is closed and all packets were acquired.
+		Packet const* acquire()
+		{
+			Packet const* packet = nullptr;
+
+			{
+				std::unique_lock<std::mutex> lock{ m_mutex };
+				m_condition_variable.wait(lock, [this]() -> bool { return m_has_ready_packet || m_closed; });
+
+				if (m_has_ready_packet)
+				{
+					std::swap(m_read_index, m_ready_index);
+					m_has_ready_packet = false;
+					packet = &m_packets[m_read_index];
+				}
+			}
+
+			m_condition_variable.notify_all();
+
+			return packet;
+		}
+
+		void close()
+		{
+			{
+				std::lock_guard<std::mutex> lock{ m_mutex };
+				m_closed = true;
+			}
+
+			m_condition_variable.notify_all();
+		}
+
+	private:
+
+		std::array<Packet, 3> m_packets{};
+		std::size_t m_write_index{ 0 };
+		std::size_t m_ready_index{ 1 };
+		std::size_t m_read_index{ 2 };
+		bool m_has_ready_packet{ false };
+		bool m_closed{ false };
+		std::mutex m_mutex;
+		std::condition_variable m_condition_variable;
+
+	};
+}
+
+#endif
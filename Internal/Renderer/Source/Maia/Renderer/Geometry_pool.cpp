@@ -0,0 +1,105 @@
+#include "Geometry_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <gsl/gsl>
+
+namespace Maia::Renderer
+{
+	using Maia::Utilities::Allocator_statistics;
+	using Maia::Utilities::Buddy_allocation;
+	using Maia::Utilities::Buddy_allocator;
+
+	Geometry_pool::Geometry_pool(std::uint64_t const buffer_size, std::uint64_t const minimum_block_size) :
+		m_buffer_size{ buffer_size },
+		m_minimum_block_size{ minimum_block_size },
+		m_allocators{},
+		m_pending_deallocations{}
+	{
+	}
+
+
+	std::optional<Geometry_allocation> Geometry_pool::allocate(std::uint64_t const size, std::uint64_t const alignment)
+	{
+		if (std::max(size, alignment) > m_buffer_size)
+		{
+			return std::nullopt;
+		}
+
+		for (std::size_t buffer_index = 0; buffer_index < m_allocators.size(); ++buffer_index)
+		{
+			std::optional<Buddy_allocation> const allocation = m_allocators[buffer_index].allocate(size, alignment);
+
+			if (allocation)
+			{
+				return Geometry_allocation{ gsl::narrow_cast<std::uint32_t>(buffer_index), allocation->offset, allocation->size };
+			}
+		}
+
+		m_allocators.emplace_back(m_buffer_size, m_minimum_block_size);
+
+		std::optional<Buddy_allocation> const allocation = m_allocators.back().allocate(size, alignment);
+		assert(allocation);
+
+		return Geometry_allocation{ gsl::narrow_cast<std::uint32_t>(m_allocators.size() - 1), allocation->offset, allocation->size };
+	}
+
+	void Geometry_pool::deallocate(Geometry_allocation const& allocation, std::uint64_t const last_used_fence_value)
+	{
+		assert(allocation.buffer_index < m_allocators.size());
+
+		m_pending_deallocations.push_back({ allocation, last_used_fence_value });
+	}
+
+	void Geometry_pool::release_completed(std::uint64_t const completed_fence_value)
+	{
+		auto const first_completed =
+			std::stable_partition(m_pending_deallocations.begin(), m_pending_deallocations.end(), [completed_fence_value](Pending_deallocation const& pending_deallocation) -> bool
+			{
+				return pending_deallocation.fence_value > completed_fence_value;
+			});
+
+		for (auto iterator = first_completed; iterator != m_pending_deallocations.end(); ++iterator)
+		{
+			m_allocators[iterator->allocation.buffer_index].deallocate(iterator->allocation.offset);
+		}
+
+		m_pending_deallocations.erase(first_completed, m_pending_deallocations.end());
+	}
+
+
+	std::uint64_t Geometry_pool::buffer_size() const
+	{
+		return m_buffer_size;
+	}
+
+	std::size_t Geometry_pool::num_buffers() const
+	{
+		return m_allocators.size();
+	}
+
+	std::size_t Geometry_pool::num_pending_deallocations() const
+	{
+		return m_pending_deallocations.size();
+	}
+
+	Allocator_statistics Geometry_pool::statistics() const
+	{
+		Allocator_statistics total{};
+
+		for (Buddy_allocator const& allocator : m_allocators)
+		{
+			Allocator_statistics const statistics = allocator.statistics();
+
+			total.capacity += statistics.capacity;
+			total.allocated_size += statistics.allocated_size;
+			total.free_size += statistics.free_size;
+			total.largest_free_block_size = std::max(total.largest_free_block_size, statistics.largest_free_block_size);
+			total.num_allocations += statistics.num_allocations;
+			total.num_free_blocks += statistics.num_free_blocks;
+		}
+
+		return total;
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef MAIA_RENDERER_GEOMETRYPOOL_H_INCLUDED
+#define MAIA_RENDERER_GEOMETRYPOOL_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
+
+namespace Maia::Renderer
+{
+	struct Geometry_allocation
+	{
+		std::uint32_t buffer_index;
+		std::uint64_t offset;
+		std::uint64_t size;
+	};
+
+
+	// Suballocates vertex and index data from a list of buffers of the same size. Buffers are never removed, so the
+	// backend creates a GPU buffer whenever num_buffers grows and buffer_index stays valid for all of them.
+	class Geometry_pool
+	{
+	public:
+
+		// buffer_size and minimum_block_size must be powers of two.
+		Geometry_pool(std::uint64_t buffer_size, std::uint64_t minimum_block_size);
+
+
+		// Allocates from the first buffer with enough space, adding a buffer if none has.
+		// Returns std::nullopt if size is larger than the buffer size.
+		std::optional<Geometry_allocation> allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+		// The allocation is returned to the pool by release_completed once last_used_fence_value is completed,
+		// so that frames in flight can keep reading it.
+		void deallocate(Geometry_allocation const& allocation, std::uint64_t last_used_fence_value);
+
+		void release_completed(std::uint64_t completed_fence_value);
+
+
+		std::uint64_t buffer_size() const;
+
+		std::size_t num_buffers() const;
+
+		std::size_t num_pending_deallocations() const;
+
+		// Sum of the statistics of all buffers, except for the largest free block which is the largest of any buffer.
+		Maia::Utilities::Allocator_statistics statistics() const;
+
+
+	private:
+
+		struct Pending_deallocation
+		{
+			Geometry_allocation allocation;
+			std::uint64_t fence_value;
+		};
+
+
+		std::uint64_t m_buffer_size;
+		std::uint64_t m_minimum_block_size;
+		std::vector<Maia::Utilities::Buddy_allocator> m_allocators;
+		std::vector<Pending_deallocation> m_pending_deallocations;
+
+	};
+}
+
+#endif
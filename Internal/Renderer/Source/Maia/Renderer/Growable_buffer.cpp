@@ -0,0 +1,13 @@
+#include "Growable_buffer.hpp"
+
+namespace Maia::Renderer
+{
+	std::uint64_t calculate_grown_capacity(std::uint64_t const current_capacity, std::uint64_t const required_size, std::uint64_t const granularity)
+	{
+		assert(granularity > 0 && (granularity & (granularity - 1)) == 0);
+
+		std::uint64_t const capacity = std::max({ required_size, 2 * current_capacity, std::uint64_t{ 1 } });
+
+		return (capacity + granularity - 1) & ~(granularity - 1);
+	}
+}
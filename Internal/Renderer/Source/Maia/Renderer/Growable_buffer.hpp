@@ -0,0 +1,111 @@
+#ifndef MAIA_RENDERER_GROWABLEBUFFER_H_INCLUDED
+#define MAIA_RENDERER_GROWABLEBUFFER_H_INCLUDED
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Maia::Renderer
+{
+	// Returns the smallest multiple of granularity, which must be a power of two, that holds required_size and is at
+	// least twice current_capacity, so that a buffer that keeps growing is recreated a logarithmic number of times.
+	std::uint64_t calculate_grown_capacity(std::uint64_t current_capacity, std::uint64_t required_size, std::uint64_t granularity);
+
+
+	// GPU buffer that is recreated with a larger capacity when a frame needs more than it holds.
+	// The replaced buffers are kept until the fence value of the last frame that used them is completed.
+	template <typename Buffer>
+	class Growable_buffer
+	{
+	public:
+
+		explicit Growable_buffer(std::uint64_t granularity) :
+			m_granularity{ granularity },
+			m_capacity{ 0 },
+			m_buffer{},
+			m_retired_buffers{}
+		{
+			assert(granularity > 0 && (granularity & (granularity - 1)) == 0);
+		}
+
+
+		// Creates the buffer if it does not exist or if it is smaller than required_size, calling
+		// create_buffer(capacity). last_used_fence_value is the fence value of the last frame that can use the
+		// current buffer. Returns true if the buffer was created, in which case its contents are undefined.
+		template <typename Create_buffer>
+		bool reserve(std::uint64_t const required_size, std::uint64_t const last_used_fence_value, Create_buffer&& create_buffer)
+		{
+			if (m_buffer && required_size <= m_capacity)
+			{
+				return false;
+			}
+
+			std::uint64_t const capacity = calculate_grown_capacity(m_capacity, required_size, m_granularity);
+
+			if (m_buffer)
+			{
+				m_retired_buffers.push_back({ std::move(*m_buffer), last_used_fence_value });
+			}
+
+			m_buffer.emplace(create_buffer(capacity));
+			m_capacity = capacity;
+
+			return true;
+		}
+
+		void release_retired_buffers(std::uint64_t const completed_fence_value)
+		{
+			m_retired_buffers.erase(
+				std::remove_if(m_retired_buffers.begin(), m_retired_buffers.end(), [completed_fence_value](Retired_buffer const& retired_buffer) -> bool
+				{
+					return retired_buffer.fence_value <= completed_fence_value;
+				}),
+				m_retired_buffers.end()
+			);
+		}
+
+
+		Buffer& get()
+		{
+			assert(m_buffer);
+			return *m_buffer;
+		}
+
+		Buffer const& get() const
+		{
+			assert(m_buffer);
+			return *m_buffer;
+		}
+
+		std::uint64_t capacity() const
+		{
+			return m_capacity;
+		}
+
+		std::size_t num_retired_buffers() const
+		{
+			return m_retired_buffers.size();
+		}
+
+
+	private:
+
+		struct Retired_buffer
+		{
+			Buffer buffer;
+			std::uint64_t fence_value;
+		};
+
+
+		std::uint64_t m_granularity;
+		std::uint64_t m_capacity;
+		std::optional<Buffer> m_buffer;
+		std::vector<Retired_buffer> m_retired_buffers;
+
+	};
+}
+
+#endif
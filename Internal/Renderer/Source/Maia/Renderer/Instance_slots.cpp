@@ -0,0 +1,152 @@
+#include "Instance_slots.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
+namespace Maia::Renderer
+{
+	Instance_slots::Instance_slots(std::uint32_t const initial_capacity) :
+		m_slots_by_key{},
+		m_generations_by_key{},
+		m_free_slots{},
+		m_num_slots{ 0 },
+		m_capacity{ std::max(initial_capacity, std::uint32_t{ 1 }) }
+	{
+	}
+
+	std::pair<std::uint32_t, bool> Instance_slots::assign(std::uint32_t const key, std::uint32_t const generation)
+	{
+		if (key >= m_slots_by_key.size())
+		{
+			m_slots_by_key.resize(static_cast<std::size_t>(key) + 1, no_slot);
+			m_generations_by_key.resize(static_cast<std::size_t>(key) + 1, 0);
+		}
+
+		std::uint32_t& slot = m_slots_by_key[key];
+		std::uint32_t& slot_generation = m_generations_by_key[key];
+
+		if (slot != no_slot)
+		{
+			bool const owner_changed = slot_generation != generation;
+			slot_generation = generation;
+
+			return { slot, owner_changed };
+		}
+
+		slot_generation = generation;
+
+		if (!m_free_slots.empty())
+		{
+			slot = m_free_slots.back();
+			m_free_slots.pop_back();
+		}
+		else
+		{
+			slot = m_num_slots++;
+
+			if (m_num_slots > m_capacity)
+			{
+				m_capacity *= 2;
+			}
+		}
+
+		return { slot, true };
+	}
+
+	std::optional<std::uint32_t> Instance_slots::find(std::uint32_t const key) const
+	{
+		if (key < m_slots_by_key.size() && m_slots_by_key[key] != no_slot)
+		{
+			return m_slots_by_key[key];
+		}
+
+		return {};
+	}
+
+	void Instance_slots::release(std::uint32_t const key)
+	{
+		assert(find(key));
+
+		m_free_slots.push_back(m_slots_by_key[key]);
+		m_slots_by_key[key] = no_slot;
+	}
+
+	void Instance_slots::clear()
+	{
+		m_slots_by_key.clear();
+		m_generations_by_key.clear();
+		m_free_slots.clear();
+		m_num_slots = 0;
+	}
+
+	std::uint32_t Instance_slots::capacity() const
+	{
+		return m_capacity;
+	}
+
+	std::uint32_t Instance_slots::num_slots() const
+	{
+		return m_num_slots;
+	}
+
+	std::uint32_t Instance_slots::num_keys() const
+	{
+		return static_cast<std::uint32_t>(m_slots_by_key.size());
+	}
+
+
+	void coalesce_slot_updates(
+		std::vector<Slot_update> const& updates,
+		std::vector<Slot_range>& ranges,
+		std::vector<Eigen::Matrix4f>& transforms
+	)
+	{
+		ranges.clear();
+		transforms.clear();
+
+		// The index of an update breaks the ties between the updates of a slot, so that an unstable sort, which does
+		// not allocate a temporary buffer, keeps them in order
+		struct Update_order
+		{
+			std::uint32_t slot;
+			std::uint32_t index;
+		};
+
+		Maia::Utilities::Scratch_scope const scratch_scope;
+		Maia::Utilities::Arena_vector<Update_order> update_orders{ scratch_scope.allocator<Update_order>() };
+		update_orders.reserve(updates.size());
+
+		for (std::size_t index = 0; index < updates.size(); ++index)
+		{
+			update_orders.push_back({ updates[index].slot, static_cast<std::uint32_t>(index) });
+		}
+
+		std::sort(update_orders.begin(), update_orders.end(), [](Update_order const& lhs, Update_order const& rhs) -> bool
+		{
+			return lhs.slot != rhs.slot ? lhs.slot < rhs.slot : lhs.index < rhs.index;
+		});
+
+		for (std::size_t order_index = 0; order_index < update_orders.size(); ++order_index)
+		{
+			Slot_update const& update = updates[update_orders[order_index].index];
+
+			if (order_index + 1 < update_orders.size() && update_orders[order_index + 1].slot == update.slot)
+			{
+				continue;
+			}
+
+			if (!ranges.empty() && ranges.back().first + ranges.back().count == update.slot)
+			{
+				++ranges.back().count;
+			}
+			else
+			{
+				ranges.push_back({ update.slot, 1 });
+			}
+
+			transforms.push_back(update.transform);
+		}
+	}
+}
@@ -0,0 +1,110 @@
+#ifndef MAIA_RENDERER_INSTANCESLOTS_H_INCLUDED
+#define MAIA_RENDERER_INSTANCESLOTS_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace Maia::Renderer
+{
+	// Consecutive slots of an instance buffer.
+	struct Slot_range
+	{
+		std::uint32_t first;
+		std::uint32_t count;
+	};
+
+	struct Slot_update
+	{
+		std::uint32_t slot;
+		Eigen::Matrix4f transform;
+	};
+
+
+	// Assigns persistent slots of a resident instance buffer to keys, like the values of entities, so that the data
+	// of an instance is only uploaded when it changes. Released slots are reused by the next assigned keys.
+	// A key that is assigned with a different generation, like an entity that reused the value of a destroyed one,
+	// keeps its slot but is reported as newly assigned, so that the data of its new owner is uploaded.
+	// The capacity doubles when it is exceeded. The instance buffer is then recreated and all its slots uploaded again.
+	class Instance_slots
+	{
+	public:
+
+		explicit Instance_slots(std::uint32_t initial_capacity = 1024);
+
+
+		// Returns the slot of key and true if it was assigned by this call or if its generation changed.
+		std::pair<std::uint32_t, bool> assign(std::uint32_t key, std::uint32_t generation = 0);
+
+		std::optional<std::uint32_t> find(std::uint32_t key) const;
+
+		void release(std::uint32_t key);
+
+		// Releases all slots. The capacity is kept.
+		void clear();
+
+		// Calls function(key, slot) for every assigned slot.
+		template <typename Function>
+		void for_each(Function&& function) const
+		{
+			for_each(0, num_keys(), function);
+		}
+
+		// Calls function(key, slot) for the assigned slots of the keys in [first_key, last_key), so that the slots
+		// can be visited a range of keys at a time.
+		template <typename Function>
+		void for_each(std::uint32_t const first_key, std::uint32_t const last_key, Function&& function) const
+		{
+			assert(last_key <= num_keys());
+
+			for (std::uint32_t key = first_key; key < last_key; ++key)
+			{
+				if (m_slots_by_key[key] != no_slot)
+				{
+					function(key, m_slots_by_key[key]);
+				}
+			}
+		}
+
+
+		// Number of slots that the instance buffer holds.
+		std::uint32_t capacity() const;
+
+		// Number of slots in use, including the released ones that were not reused yet.
+		std::uint32_t num_slots() const;
+
+		// One past the largest key that was assigned since the last clear.
+		std::uint32_t num_keys() const;
+
+
+	private:
+
+		static constexpr std::uint32_t no_slot = std::numeric_limits<std::uint32_t>::max();
+
+
+		std::vector<std::uint32_t> m_slots_by_key;
+		std::vector<std::uint32_t> m_generations_by_key;
+		std::vector<std::uint32_t> m_free_slots;
+		std::uint32_t m_num_slots;
+		std::uint32_t m_capacity;
+
+	};
+
+
+	// Keeps the last update of each slot and replaces ranges with the runs of consecutive slots and transforms with
+	// their data in the order of the slots, so that every range is uploaded with a single copy.
+	// The updates are ordered in the scratch arena of the calling thread, so that the general heap is not used.
+	void coalesce_slot_updates(
+		std::vector<Slot_update> const& updates,
+		std::vector<Slot_range>& ranges,
+		std::vector<Eigen::Matrix4f>& transforms
+	);
+}
+
+#endif
@@ -0,0 +1,216 @@
+#include "Render_queue.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
+namespace Maia::Renderer
+{
+	namespace
+	{
+		constexpr std::uint64_t depth_mask = 0xFFFF;
+
+		constexpr std::size_t digit_bits = 8;
+		constexpr std::size_t num_buckets = std::size_t{ 1 } << digit_bits;
+		constexpr std::size_t num_digits = 64 / digit_bits;
+
+		// Smaller ranges are not worth the cost of starting a task
+		constexpr std::size_t minimum_items_per_task = 16 * 1024;
+
+		using Histogram = std::array<std::size_t, num_buckets>;
+	}
+
+	std::uint64_t create_sort_key(Draw_key const& draw_key)
+	{
+		assert(draw_key.pass < (1 << 4));
+		assert(draw_key.pipeline < (1 << 12));
+
+		return
+			(std::uint64_t{ draw_key.pass } << 60) |
+			(std::uint64_t{ draw_key.pipeline } << 48) |
+			(std::uint64_t{ draw_key.material } << 32) |
+			(std::uint64_t{ draw_key.mesh } << 16) |
+			std::uint64_t{ draw_key.depth };
+	}
+
+	Draw_key get_draw_key(std::uint64_t const sort_key)
+	{
+		return
+		{
+			static_cast<std::uint8_t>(sort_key >> 60),
+			static_cast<std::uint16_t>((sort_key >> 48) & 0xFFF),
+			static_cast<std::uint16_t>(sort_key >> 32),
+			static_cast<std::uint16_t>(sort_key >> 16),
+			static_cast<std::uint16_t>(sort_key)
+		};
+	}
+
+	std::uint16_t quantize_depth(float const view_depth)
+	{
+		// Also maps NaN to 0
+		float const clamped_depth = view_depth > 0.0f ? view_depth : 0.0f;
+
+		std::uint32_t bits;
+		std::memcpy(&bits, &clamped_depth, sizeof(bits));
+
+		return static_cast<std::uint16_t>(bits >> 16);
+	}
+
+	std::uint16_t quantize_depth_back_to_front(float const view_depth)
+	{
+		return static_cast<std::uint16_t>(0xFFFF - quantize_depth(view_depth));
+	}
+
+
+	void radix_sort(gsl::span<Draw_item> const items, gsl::span<Draw_item> const scratch, Maia::Utilities::Worker_threads& worker_threads)
+	{
+		assert(items.size() == scratch.size());
+
+		std::size_t const count = static_cast<std::size_t>(items.size());
+
+		if (count == 0)
+		{
+			return;
+		}
+
+		std::size_t const num_tasks = std::clamp(count / minimum_items_per_task, std::size_t{ 1 }, worker_threads.num_threads());
+
+		Maia::Utilities::Scratch_scope const scratch_scope;
+		Maia::Utilities::Arena_vector<Histogram> histograms{ num_tasks, scratch_scope.allocator<Histogram>() };
+
+		Draw_item* source = items.data();
+		Draw_item* destination = scratch.data();
+
+		for (std::size_t digit_index = 0; digit_index < num_digits; ++digit_index)
+		{
+			std::size_t const shift = digit_index * digit_bits;
+
+			auto const get_bucket = [shift](Draw_item const& item) -> std::size_t
+			{
+				return static_cast<std::size_t>((item.sort_key >> shift) & (num_buckets - 1));
+			};
+
+			worker_threads.run(num_tasks, [&](std::size_t const task_index) -> void
+			{
+				Histogram& histogram = histograms[task_index];
+				histogram.fill(0);
+
+				for (std::size_t index = count * task_index / num_tasks; index < count * (task_index + 1) / num_tasks; ++index)
+				{
+					++histogram[get_bucket(source[index])];
+				}
+			});
+
+			{
+				std::size_t const first_bucket = get_bucket(source[0]);
+
+				std::size_t first_bucket_count = 0;
+				for (Histogram const& histogram : histograms)
+				{
+					first_bucket_count += histogram[first_bucket];
+				}
+
+				if (first_bucket_count == count)
+				{
+					continue;
+				}
+			}
+
+			// Each task writes its items of a bucket after the ones of the previous tasks, which keeps the sort stable
+			{
+				std::size_t offset = 0;
+
+				for (std::size_t bucket = 0; bucket < num_buckets; ++bucket)
+				{
+					for (Histogram& histogram : histograms)
+					{
+						std::size_t const bucket_count = histogram[bucket];
+						histogram[bucket] = offset;
+						offset += bucket_count;
+					}
+				}
+			}
+
+			worker_threads.run(num_tasks, [&](std::size_t const task_index) -> void
+			{
+				Histogram& offsets = histograms[task_index];
+
+				for (std::size_t index = count * task_index / num_tasks; index < count * (task_index + 1) / num_tasks; ++index)
+				{
+					destination[offsets[get_bucket(source[index])]++] = source[index];
+				}
+			});
+
+			std::swap(source, destination);
+		}
+
+		if (source != items.data())
+		{
+			std::copy(source, source + count, items.data());
+		}
+	}
+
+
+	Render_queue::Render_queue(Maia::Utilities::Worker_threads& worker_threads) :
+		m_worker_threads{ worker_threads },
+		m_items{},
+		m_scratch{},
+		m_batches{}
+	{
+	}
+
+
+	void Render_queue::clear()
+	{
+		m_items.clear();
+		m_batches.clear();
+	}
+
+	void Render_queue::reserve(std::size_t const count)
+	{
+		m_items.reserve(count);
+	}
+
+	void Render_queue::push(std::uint64_t const sort_key, std::uint32_t const instance_index)
+	{
+		m_items.push_back({ sort_key, instance_index });
+	}
+
+	void Render_queue::push(gsl::span<Draw_item const> const items)
+	{
+		m_items.insert(m_items.end(), items.begin(), items.end());
+	}
+
+	void Render_queue::sort()
+	{
+		m_scratch.resize(m_items.size());
+		radix_sort(m_items, m_scratch, m_worker_threads);
+
+		m_batches.clear();
+
+		for (std::size_t index = 0; index < m_items.size(); ++index)
+		{
+			std::uint64_t const batch_key = m_items[index].sort_key & ~depth_mask;
+
+			if (m_batches.empty() || m_batches.back().sort_key != batch_key)
+			{
+				m_batches.push_back({ batch_key, static_cast<std::uint32_t>(index), 0 });
+			}
+
+			++m_batches.back().item_count;
+		}
+	}
+
+
+	gsl::span<Draw_item const> Render_queue::get_items() const
+	{
+		return m_items;
+	}
+
+	gsl::span<Draw_batch const> Render_queue::get_batches() const
+	{
+		return m_batches;
+	}
+}
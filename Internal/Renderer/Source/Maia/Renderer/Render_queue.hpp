@@ -0,0 +1,95 @@
+#ifndef MAIA_RENDERER_RENDERQUEUE_H_INCLUDED
+#define MAIA_RENDERER_RENDERQUEUE_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gsl/span>
+
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+namespace Maia::Renderer
+{
+	// Fields of a sort key, from the most significant:
+	// | pass: 4 bits | pipeline: 12 bits | material: 16 bits | mesh: 16 bits | depth: 16 bits |
+	struct Draw_key
+	{
+		std::uint8_t pass;
+		std::uint16_t pipeline;
+		std::uint16_t material;
+		std::uint16_t mesh;
+		std::uint16_t depth;
+	};
+
+	std::uint64_t create_sort_key(Draw_key const& draw_key);
+
+	Draw_key get_draw_key(std::uint64_t sort_key);
+
+	// Depths sort front to back. The upper bits of a non-negative float increase with its value, so no depth range is needed.
+	std::uint16_t quantize_depth(float view_depth);
+
+	// For transparent passes.
+	std::uint16_t quantize_depth_back_to_front(float view_depth);
+
+
+	struct Draw_item
+	{
+		std::uint64_t sort_key;
+		std::uint32_t instance_index;
+	};
+
+	// Consecutive sorted items that only differ in depth, which can be drawn with a single instanced draw.
+	// The depth bits of sort_key are zero.
+	struct Draw_batch
+	{
+		std::uint64_t sort_key;
+		std::uint32_t first_item;
+		std::uint32_t item_count;
+	};
+
+
+	// Stable LSD radix sort of items by sort_key with 8-bit digits. Digits that are equal in all keys are skipped.
+	// scratch must have the size of items. Each pass is split between worker_threads, one range of it sorted by the calling
+	// thread, without starting threads or allocating from the general heap.
+	void radix_sort(gsl::span<Draw_item> items, gsl::span<Draw_item> scratch, Maia::Utilities::Worker_threads& worker_threads);
+
+
+	// Draw items emitted by the extraction of a frame, independent of the graphics API.
+	class Render_queue
+	{
+	public:
+
+		// Items are sorted with worker_threads.
+		explicit Render_queue(Maia::Utilities::Worker_threads& worker_threads);
+
+
+		void clear();
+
+		void reserve(std::size_t count);
+
+		void push(std::uint64_t sort_key, std::uint32_t instance_index);
+
+		void push(gsl::span<Draw_item const> items);
+
+		// Sorts the items and merges them into batches.
+		void sort();
+
+
+		gsl::span<Draw_item const> get_items() const;
+
+		gsl::span<Draw_batch const> get_batches() const;
+
+
+	private:
+
+		Maia::Utilities::Worker_threads& m_worker_threads;
+		std::vector<Draw_item> m_items;
+		std::vector<Draw_item> m_scratch;
+		std::vector<Draw_batch> m_batches;
+
+	};
+}
+
+#endif
@@ -0,0 +1,108 @@
+#include "Ring_allocator.hpp"
+
+#include <cassert>
+
+namespace Maia::Renderer
+{
+	namespace
+	{
+		std::size_t align(std::size_t const value, std::size_t const alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	Ring_allocator::Ring_allocator(std::size_t const capacity) :
+		m_capacity{ capacity },
+		m_head{ 0 },
+		m_tail{ 0 },
+		m_used_size{ 0 },
+		m_current_frame_size{ 0 },
+		m_frames{}
+	{
+	}
+
+	std::optional<std::size_t> Ring_allocator::allocate(std::size_t const size, std::size_t const alignment)
+	{
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+		if (m_used_size == 0)
+		{
+			m_head = 0;
+			m_tail = 0;
+		}
+
+		std::size_t const aligned_head = align(m_head, alignment);
+
+		std::size_t offset;
+		std::size_t padding;
+
+		if (m_head >= m_tail && m_used_size < m_capacity)
+		{
+			if (aligned_head + size <= m_capacity)
+			{
+				offset = aligned_head;
+				padding = aligned_head - m_head;
+			}
+			else if (size <= m_tail)
+			{
+				// The end of the buffer is wasted until the frame is released
+				offset = 0;
+				padding = m_capacity - m_head;
+			}
+			else
+			{
+				return {};
+			}
+		}
+		else if (m_head < m_tail && aligned_head + size <= m_tail)
+		{
+			offset = aligned_head;
+			padding = aligned_head - m_head;
+		}
+		else
+		{
+			return {};
+		}
+
+		m_head = offset + size;
+		m_used_size += padding + size;
+		m_current_frame_size += padding + size;
+
+		return offset;
+	}
+
+	void Ring_allocator::finish_frame(std::uint64_t const fence_value)
+	{
+		assert(m_frames.empty() || m_frames.back().fence_value <= fence_value);
+
+		if (m_current_frame_size > 0)
+		{
+			m_frames.push_back({ fence_value, m_head, m_current_frame_size });
+			m_current_frame_size = 0;
+		}
+	}
+
+	void Ring_allocator::release_completed_frames(std::uint64_t const completed_fence_value)
+	{
+		while (!m_frames.empty() && m_frames.front().fence_value <= completed_fence_value)
+		{
+			Frame const& frame = m_frames.front();
+
+			m_tail = frame.end;
+			m_used_size -= frame.size;
+
+			m_frames.pop_front();
+		}
+	}
+
+	std::size_t Ring_allocator::capacity() const
+	{
+		return m_capacity;
+	}
+
+	std::size_t Ring_allocator::used_size() const
+	{
+		return m_used_size;
+	}
+}
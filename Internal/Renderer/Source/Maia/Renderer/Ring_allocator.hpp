@@ -0,0 +1,56 @@
+#ifndef MAIA_RENDERER_RINGALLOCATOR_H_INCLUDED
+#define MAIA_RENDERER_RINGALLOCATOR_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace Maia::Renderer
+{
+	// Suballocates a circular buffer to the frames in flight. The allocations of a frame are released together,
+	// once the GPU has signaled the fence value of the frame.
+	class Ring_allocator
+	{
+	public:
+
+		explicit Ring_allocator(std::size_t capacity);
+
+
+		// Returns the offset of size bytes aligned to alignment, which must be a power of two, or std::nullopt
+		// if they do not fit in the space not used by the frames in flight.
+		std::optional<std::size_t> allocate(std::size_t size, std::size_t alignment);
+
+		// Ends the current frame. Its allocations are released once fence_value is completed.
+		void finish_frame(std::uint64_t fence_value);
+
+		void release_completed_frames(std::uint64_t completed_fence_value);
+
+
+		std::size_t capacity() const;
+
+		// Includes the padding wasted to align allocations and to wrap around the end of the buffer.
+		std::size_t used_size() const;
+
+
+	private:
+
+		struct Frame
+		{
+			std::uint64_t fence_value;
+			std::size_t end;
+			std::size_t size;
+		};
+
+
+		std::size_t m_capacity;
+		std::size_t m_head;
+		std::size_t m_tail;
+		std::size_t m_used_size;
+		std::size_t m_current_frame_size;
+		std::deque<Frame> m_frames;
+
+	};
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/Renderer/Render_queue.hpp>
+
+namespace Maia::Renderer::Benchmark
+{
+	namespace
+	{
+		// Keys of a scene with few passes and pipelines, hundreds of materials and thousands of meshes
+		std::vector<Draw_item> create_scene_items(std::size_t const count)
+		{
+			std::mt19937 random_engine{ 0 };
+			std::uniform_int_distribution<int> pass_distribution{ 0, 1 };
+			std::uniform_int_distribution<int> pipeline_distribution{ 0, 15 };
+			std::uniform_int_distribution<int> material_distribution{ 0, 255 };
+			std::uniform_int_distribution<int> mesh_distribution{ 0, 4095 };
+			std::uniform_real_distribution<float> depth_distribution{ 0.1f, 1000.0f };
+
+			std::vector<Draw_item> items;
+			items.reserve(count);
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				Draw_key const draw_key
+				{
+					static_cast<std::uint8_t>(pass_distribution(random_engine)),
+					static_cast<std::uint16_t>(pipeline_distribution(random_engine)),
+					static_cast<std::uint16_t>(material_distribution(random_engine)),
+					static_cast<std::uint16_t>(mesh_distribution(random_engine)),
+					quantize_depth(depth_distribution(random_engine))
+				};
+
+				items.push_back({ create_sort_key(draw_key), static_cast<std::uint32_t>(index) });
+			}
+
+			return items;
+		}
+	}
+
+	void std_sort_draw_items(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<Draw_item> const items = create_scene_items(count);
+		std::vector<Draw_item> sorted_items(count);
+
+		for (auto _ : state)
+		{
+			std::copy(items.begin(), items.end(), sorted_items.begin());
+
+			std::sort(sorted_items.begin(), sorted_items.end(), [](Draw_item const& lhs, Draw_item const& rhs) -> bool
+			{
+				return lhs.sort_key < rhs.sort_key;
+			});
+
+			benchmark::DoNotOptimize(sorted_items.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(std_sort_draw_items)->Arg(1024 * 1024)->UseRealTime();
+
+	void radix_sort_draw_items(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+		std::size_t const num_threads = static_cast<std::size_t>(state.range(1));
+
+		std::vector<Draw_item> const items = create_scene_items(count);
+		std::vector<Draw_item> sorted_items(count);
+		std::vector<Draw_item> scratch(count);
+		Maia::Utilities::Worker_threads worker_threads{ num_threads };
+
+		for (auto _ : state)
+		{
+			std::copy(items.begin(), items.end(), sorted_items.begin());
+
+			radix_sort(sorted_items, scratch, worker_threads);
+
+			benchmark::DoNotOptimize(sorted_items.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+	BENCHMARK(radix_sort_draw_items)
+		->Args({ 1024 * 1024, 1 })
+		->Args({ 1024 * 1024, 4 })
+		->UseRealTime();
+
+	void render_queue(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+		std::size_t const num_threads = static_cast<std::size_t>(state.range(1));
+
+		std::vector<Draw_item> const items = create_scene_items(count);
+
+		Maia::Utilities::Worker_threads worker_threads{ num_threads };
+		Render_queue queue{ worker_threads };
+		queue.reserve(count);
+
+		for (auto _ : state)
+		{
+			queue.clear();
+			queue.push(items);
+			queue.sort();
+
+			benchmark::DoNotOptimize(queue.get_batches().data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+		state.counters["batches"] = static_cast<double>(queue.get_batches().size());
+	}
+	BENCHMARK(render_queue)
+		->Args({ 1024 * 1024, 1 })
+		->Args({ 1024 * 1024, 4 })
+		->UseRealTime();
+}
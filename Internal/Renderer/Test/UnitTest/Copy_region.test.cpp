@@ -0,0 +1,78 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Copy_region.hpp>
+
+namespace Maia::Renderer
+{
+	bool operator==(Copy_region const& lhs, Copy_region const& rhs)
+	{
+		return lhs.source == rhs.source
+			&& lhs.destination == rhs.destination
+			&& lhs.source_offset == rhs.source_offset
+			&& lhs.destination_offset == rhs.destination_offset
+			&& lhs.size == rhs.size;
+	}
+}
+
+namespace Maia::Renderer::Test
+{
+	SCENARIO("Coalesce copy regions", "[Copy_region]")
+	{
+		GIVEN("Copy regions written piece by piece to two destinations")
+		{
+			std::vector<Copy_region> copy_regions
+			{
+				{ 0, 1, 192, 128, 64 },
+				{ 0, 0, 64, 0, 64 },
+				{ 0, 1, 0, 0, 64 },
+				{ 0, 0, 192, 64, 64 },
+				{ 0, 1, 128, 64, 64 },
+				{ 0, 0, 320, 192, 64 },
+				{ 1, 0, 384, 256, 64 }
+			};
+
+			WHEN("They are coalesced")
+			{
+				coalesce_copy_regions(copy_regions);
+
+				THEN("Regions contiguous in the same source and destination are merged")
+				{
+					std::vector<Copy_region> const expected_copy_regions
+					{
+						{ 0, 0, 64, 0, 64 },
+						{ 0, 0, 192, 64, 64 },
+						{ 0, 0, 320, 192, 64 },
+						{ 1, 0, 384, 256, 64 },
+						{ 0, 1, 0, 0, 64 },
+						{ 0, 1, 128, 64, 128 }
+					};
+
+					CHECK(copy_regions == expected_copy_regions);
+				}
+			}
+		}
+
+		GIVEN("The copy regions of the instances of a frame, written draw by draw")
+		{
+			std::vector<Copy_region> copy_regions;
+
+			for (std::uint64_t index = 0; index < 1000; ++index)
+			{
+				copy_regions.push_back({ 0, 0, 256 + index * 64, index * 64, 64 });
+			}
+
+			WHEN("They are coalesced")
+			{
+				coalesce_copy_regions(copy_regions);
+
+				THEN("A single copy remains")
+				{
+					REQUIRE(copy_regions.size() == 1);
+					CHECK(copy_regions[0] == Copy_region{ 0, 0, 256, 0, 64000 });
+				}
+			}
+		}
+	}
+}
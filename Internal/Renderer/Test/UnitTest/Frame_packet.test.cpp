@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Frame_packet.hpp>
+
+namespace Maia::Renderer::Test
+{
+	SCENARIO("Write the sorted draws of a render queue into a frame packet", "[Frame_packet]")
+	{
+		GIVEN("A render queue with instances of two meshes")
+		{
+			std::vector<std::uint32_t> const instance_slots{ 4, 9, 2 };
+
+			Maia::Utilities::Worker_threads worker_threads{ 1 };
+			Render_queue render_queue{ worker_threads };
+			render_queue.push(create_sort_key({ 0, 0, 0, 7, quantize_depth(2.0f) }), 0);
+			render_queue.push(create_sort_key({ 0, 0, 0, 3, quantize_depth(5.0f) }), 1);
+			render_queue.push(create_sort_key({ 0, 0, 0, 7, quantize_depth(1.0f) }), 2);
+			render_queue.sort();
+
+			WHEN("The draws are written into a frame packet")
+			{
+				Frame_packet frame_packet{};
+				frame_packet.draws.push_back({ 1, 0, 1 });
+				write_draws(render_queue, instance_slots, frame_packet);
+
+				THEN("There is an instanced draw per mesh whose instances are the slots in sorted order")
+				{
+					REQUIRE(frame_packet.draws.size() == 2);
+					CHECK(frame_packet.draws[0].mesh == 3);
+					CHECK(frame_packet.draws[0].first_instance == 0);
+					CHECK(frame_packet.draws[0].instance_count == 1);
+					CHECK(frame_packet.draws[1].mesh == 7);
+					CHECK(frame_packet.draws[1].first_instance == 1);
+					CHECK(frame_packet.draws[1].instance_count == 2);
+
+					std::vector<std::uint32_t> const expected_instance_slots{ 9, 2, 4 };
+					CHECK(frame_packet.instance_slots == expected_instance_slots);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Hand frame packets from a producer to a consumer", "[Frame_packet]")
+	{
+		GIVEN("An empty frame packet buffer")
+		{
+			Frame_packet_buffer<Frame_packet> frame_packet_buffer;
+
+			WHEN("Two packets are published before the consumer acquires")
+			{
+				frame_packet_buffer.get_write_packet().frame_number = 1;
+				frame_packet_buffer.publish();
+				frame_packet_buffer.get_write_packet().frame_number = 2;
+				frame_packet_buffer.publish();
+
+				THEN("The consumer acquires the latest packet")
+				{
+					Frame_packet const* const packet = frame_packet_buffer.acquire();
+
+					REQUIRE(packet != nullptr);
+					CHECK(packet->frame_number == 2);
+				}
+
+				THEN("The producer does not write into the packet that the consumer acquired")
+				{
+					Frame_packet const* const packet = frame_packet_buffer.acquire();
+
+					CHECK(&frame_packet_buffer.get_write_packet() != packet);
+				}
+			}
+
+			WHEN("The buffer is closed with a pending packet")
+			{
+				frame_packet_buffer.get_write_packet().frame_number = 1;
+				frame_packet_buffer.publish();
+				frame_packet_buffer.close();
+
+				THEN("The pending packet is acquired before the consumer is told to stop")
+				{
+					Frame_packet const* const packet = frame_packet_buffer.acquire();
+
+					REQUIRE(packet != nullptr);
+					CHECK(packet->frame_number == 1);
+					CHECK(frame_packet_buffer.acquire() == nullptr);
+				}
+			}
+
+			WHEN("A producer thread publishes frames while a consumer thread acquires them")
+			{
+				std::uint64_t const num_frames = 1000;
+
+				std::vector<std::uint64_t> acquired_frame_numbers;
+
+				std::thread consumer{ [&frame_packet_buffer, &acquired_frame_numbers]() -> void
+				{
+					while (Frame_packet const* const packet = frame_packet_buffer.acquire())
+					{
+						acquired_frame_numbers.push_back(packet->frame_number);
+					}
+				} };
+
+				for (std::uint64_t frame_number = 1; frame_number <= num_frames; ++frame_number)
+				{
+					frame_packet_buffer.wait_until_acquired();
+					frame_packet_buffer.get_write_packet().frame_number = frame_number;
+					frame_packet_buffer.publish();
+				}
+
+				frame_packet_buffer.close();
+				consumer.join();
+
+				THEN("Every frame is acquired in order because the producer waits for the consumer")
+				{
+					REQUIRE(acquired_frame_numbers.size() == num_frames);
+					CHECK(acquired_frame_numbers.front() == 1);
+					CHECK(acquired_frame_numbers.back() == num_frames);
+					CHECK(std::is_sorted(acquired_frame_numbers.begin(), acquired_frame_numbers.end()));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Geometry_pool.hpp>
+
+namespace Maia::Renderer::Test
+{
+	SCENARIO("Suballocate mesh data from a geometry pool", "[Geometry_pool]")
+	{
+		GIVEN("A geometry pool of 1024 byte buffers")
+		{
+			Geometry_pool pool{ 1024, 64 };
+
+			THEN("It starts without buffers")
+			{
+				CHECK(pool.num_buffers() == 0);
+				CHECK(pool.statistics().capacity == 0);
+			}
+
+			THEN("Allocations larger than a buffer fail")
+			{
+				CHECK(!pool.allocate(2048));
+				CHECK(pool.num_buffers() == 0);
+			}
+
+			WHEN("Allocations of 600, 300 and 600 bytes are made")
+			{
+				std::optional<Geometry_allocation> const first = pool.allocate(600);
+				std::optional<Geometry_allocation> const second = pool.allocate(300);
+				std::optional<Geometry_allocation> const third = pool.allocate(600);
+
+				THEN("A buffer is added when no buffer has space for an allocation")
+				{
+					REQUIRE(first);
+					CHECK(first->buffer_index == 0);
+					CHECK(first->offset == 0);
+					CHECK(first->size == 1024);
+
+					REQUIRE(second);
+					CHECK(second->buffer_index == 1);
+					CHECK(second->offset == 0);
+
+					REQUIRE(third);
+					CHECK(third->buffer_index == 2);
+
+					CHECK(pool.num_buffers() == 3);
+					CHECK(pool.statistics().allocated_size == 2048 + 512);
+				}
+
+				WHEN("The first allocation is deallocated while a frame can still use it")
+				{
+					pool.deallocate(*first, 5);
+					pool.release_completed(4);
+
+					THEN("Its memory is not reused until the fence value is completed")
+					{
+						CHECK(pool.num_pending_deallocations() == 1);
+
+						std::optional<Geometry_allocation> const fourth = pool.allocate(600);
+						REQUIRE(fourth);
+						CHECK(fourth->buffer_index == 3);
+					}
+
+					WHEN("The fence value is completed")
+					{
+						pool.release_completed(5);
+
+						THEN("The first buffer is reused")
+						{
+							CHECK(pool.num_pending_deallocations() == 0);
+
+							std::optional<Geometry_allocation> const fourth = pool.allocate(600);
+							REQUIRE(fourth);
+							CHECK(fourth->buffer_index == 0);
+							CHECK(pool.num_buffers() == 3);
+						}
+					}
+				}
+			}
+		}
+	}
+}
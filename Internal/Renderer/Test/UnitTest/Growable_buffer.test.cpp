@@ -0,0 +1,93 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Growable_buffer.hpp>
+
+namespace Maia::Renderer::Test
+{
+	namespace
+	{
+		// Stands for a GPU buffer. The counter tells how many buffers are alive.
+		struct Test_buffer
+		{
+			std::uint64_t capacity;
+			std::shared_ptr<int> counter;
+		};
+	}
+
+	SCENARIO("Calculate the capacity of a growing buffer", "[Growable_buffer]")
+	{
+		THEN("The capacity at least doubles and is a multiple of the granularity")
+		{
+			CHECK(calculate_grown_capacity(0, 0, 256) == 256);
+			CHECK(calculate_grown_capacity(0, 300, 256) == 512);
+			CHECK(calculate_grown_capacity(512, 600, 256) == 1024);
+			CHECK(calculate_grown_capacity(512, 3000, 256) == 3072);
+		}
+	}
+
+	SCENARIO("Grow a buffer used by frames in flight", "[Growable_buffer]")
+	{
+		GIVEN("A growable buffer with a granularity of 1024 bytes")
+		{
+			std::shared_ptr<int> const counter = std::make_shared<int>(0);
+
+			auto const create_buffer = [&counter](std::uint64_t const capacity) -> Test_buffer
+			{
+				return { capacity, counter };
+			};
+
+			Growable_buffer<Test_buffer> buffer{ 1024 };
+
+			WHEN("The first frame reserves 100 bytes")
+			{
+				bool const created = buffer.reserve(100, 0, create_buffer);
+
+				THEN("A buffer with the granularity as capacity is created")
+				{
+					CHECK(created);
+					CHECK(buffer.capacity() == 1024);
+					CHECK(buffer.get().capacity == 1024);
+				}
+
+				AND_WHEN("The next frames fit in the buffer")
+				{
+					bool const created_again = buffer.reserve(1024, 1, create_buffer);
+
+					THEN("The buffer is kept")
+					{
+						CHECK(!created_again);
+						CHECK(buffer.num_retired_buffers() == 0);
+					}
+				}
+
+				AND_WHEN("Frame 3 needs more than the capacity while frame 2 is in flight")
+				{
+					bool const grown = buffer.reserve(1500, 2, create_buffer);
+
+					THEN("A buffer with twice the capacity replaces it")
+					{
+						CHECK(grown);
+						CHECK(buffer.capacity() == 2048);
+						CHECK(buffer.get().capacity == 2048);
+					}
+
+					THEN("The old buffer is kept until frame 2 is completed")
+					{
+						CHECK(buffer.num_retired_buffers() == 1);
+						CHECK(counter.use_count() == 3);
+
+						buffer.release_retired_buffers(1);
+						CHECK(buffer.num_retired_buffers() == 1);
+
+						buffer.release_retired_buffers(2);
+						CHECK(buffer.num_retired_buffers() == 0);
+						CHECK(counter.use_count() == 2);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,135 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Instance_slots.hpp>
+
+namespace Maia::Renderer::Test
+{
+	namespace
+	{
+		Eigen::Matrix4f create_translation(float const x)
+		{
+			Eigen::Matrix4f matrix = Eigen::Matrix4f::Identity();
+			matrix(0, 3) = x;
+			return matrix;
+		}
+	}
+
+	SCENARIO("Assign persistent instance slots to keys", "[Instance_slots]")
+	{
+		GIVEN("Slots assigned to three keys with a capacity of two slots")
+		{
+			Instance_slots instance_slots{ 2 };
+
+			std::pair<std::uint32_t, bool> const first = instance_slots.assign(10);
+			std::pair<std::uint32_t, bool> const second = instance_slots.assign(3);
+			std::pair<std::uint32_t, bool> const third = instance_slots.assign(7);
+
+			THEN("Every key gets a new consecutive slot")
+			{
+				CHECK(first == std::make_pair(std::uint32_t{ 0 }, true));
+				CHECK(second == std::make_pair(std::uint32_t{ 1 }, true));
+				CHECK(third == std::make_pair(std::uint32_t{ 2 }, true));
+				CHECK(instance_slots.num_slots() == 3);
+			}
+
+			THEN("The capacity is doubled")
+			{
+				CHECK(instance_slots.capacity() == 4);
+			}
+
+			WHEN("A key is assigned again")
+			{
+				std::pair<std::uint32_t, bool> const again = instance_slots.assign(3);
+
+				THEN("It keeps its slot")
+				{
+					CHECK(again == std::make_pair(std::uint32_t{ 1 }, false));
+				}
+			}
+
+			WHEN("A key is assigned again with a different generation")
+			{
+				std::pair<std::uint32_t, bool> const new_owner = instance_slots.assign(3, 1);
+				std::pair<std::uint32_t, bool> const again = instance_slots.assign(3, 1);
+
+				THEN("It keeps its slot, which is reported as assigned once")
+				{
+					CHECK(new_owner == std::make_pair(std::uint32_t{ 1 }, true));
+					CHECK(again == std::make_pair(std::uint32_t{ 1 }, false));
+					CHECK(instance_slots.num_slots() == 3);
+				}
+			}
+
+			WHEN("A key is released and another one is assigned")
+			{
+				instance_slots.release(3);
+				std::pair<std::uint32_t, bool> const fourth = instance_slots.assign(20);
+
+				THEN("The released slot is reused")
+				{
+					CHECK(!instance_slots.find(3));
+					CHECK(fourth == std::make_pair(std::uint32_t{ 1 }, true));
+					CHECK(instance_slots.num_slots() == 3);
+				}
+			}
+
+			WHEN("The slots of a range of keys are visited")
+			{
+				std::vector<std::pair<std::uint32_t, std::uint32_t>> visited;
+				instance_slots.for_each(3, 10, [&](std::uint32_t const key, std::uint32_t const slot) -> void
+				{
+					visited.push_back({ key, slot });
+				});
+
+				THEN("Only the assigned keys of the range are visited, in order")
+				{
+					CHECK(instance_slots.num_keys() == 11);
+					CHECK(visited == std::vector<std::pair<std::uint32_t, std::uint32_t>>{ { 3, 1 }, { 7, 2 } });
+				}
+			}
+		}
+	}
+
+	SCENARIO("Coalesce the updates of instance slots", "[Instance_slots]")
+	{
+		GIVEN("Updates of scattered slots, one of them updated twice")
+		{
+			std::vector<Slot_update> updates
+			{
+				{ 5, create_translation(5.0f) },
+				{ 1, create_translation(1.0f) },
+				{ 2, create_translation(-2.0f) },
+				{ 6, create_translation(6.0f) },
+				{ 2, create_translation(2.0f) },
+				{ 9, create_translation(9.0f) }
+			};
+
+			WHEN("They are coalesced")
+			{
+				std::vector<Slot_range> ranges;
+				std::vector<Eigen::Matrix4f> transforms;
+				coalesce_slot_updates(updates, ranges, transforms);
+
+				THEN("Consecutive slots form a single range and the last update of each slot is kept")
+				{
+					REQUIRE(ranges.size() == 3);
+					CHECK(ranges[0].first == 1);
+					CHECK(ranges[0].count == 2);
+					CHECK(ranges[1].first == 5);
+					CHECK(ranges[1].count == 2);
+					CHECK(ranges[2].first == 9);
+					CHECK(ranges[2].count == 1);
+
+					REQUIRE(transforms.size() == 5);
+					CHECK(transforms[0] == create_translation(1.0f));
+					CHECK(transforms[1] == create_translation(2.0f));
+					CHECK(transforms[2] == create_translation(5.0f));
+					CHECK(transforms[3] == create_translation(6.0f));
+					CHECK(transforms[4] == create_translation(9.0f));
+				}
+			}
+		}
+	}
+}
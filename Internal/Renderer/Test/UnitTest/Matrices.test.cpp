@@ -38,7 +38,7 @@ namespace Maia::Renderer::Test
 
 			WHEN("The orthographic projection matrix is calculated")
 			{
-				Eigen::Matrix4f const projection_matrix = create_orthographic_projection_matrix(dimensions);
+				Eigen::Matrix4f const projection_matrix = create_orthographic_projection_matrix(0.5f * dimensions(0), 0.5f * dimensions(1), 0.0f, dimensions(2));
 
 				THEN("Point { 2.0f, 2.0f, 10.0f } should be transformed to { 1.0f, 1.0f, 1.0f }")
 				{
@@ -68,14 +68,16 @@ namespace Maia::Renderer::Test
 
 			WHEN("The perspective projection matrix is calculated")
 			{
-				Eigen::Matrix4f const projection_matrix = create_perspective_projection_matrix(dimensions, zRange);
+				Eigen::Matrix4f const projection_matrix = create_finite_perspective_projection_matrix(
+					dimensions(0) / dimensions(1), 2.0f * std::atan(dimensions(1)), zRange(0), zRange(1)
+				);
 
 				THEN("Point { 168.0f, 94.5f, 21.0f, 1.0f } should be transformed to { 21.0f, 21.0f, 21.0f, 21.0f }")
 				{
 					Eigen::Vector4f const point{ 168.0f, 94.5f, 21.0f, 1.0f };
 
 					Eigen::Vector4f const transformed_point = projection_matrix * point;
-					CHECK(Eigen::Vector4f{ 21.0f, 21.0f, 21.0f, 21.0f } == transformed_point);
+					CHECK(Eigen::Vector4f{ 21.0f, 21.0f, 21.0f, 21.0f }.isApprox(transformed_point));
 				}
 
 				THEN("Point { -8.0f, -4.5f, 1.0f, 1.0f } should be transformed to { -1.0f, -1.0f, 0.0f, 1.0f }")
@@ -83,7 +85,7 @@ namespace Maia::Renderer::Test
 					Eigen::Vector4f const point{ -8.0f, -4.5f, 1.0f, 1.0f };
 
 					Eigen::Vector4f const transformed_point = projection_matrix * point;
-					CHECK(Eigen::Vector4f{ -1.0f, -1.0f, 0.0f, 1.0f } == transformed_point);
+					CHECK(Eigen::Vector4f{ -1.0f, -1.0f, 0.0f, 1.0f }.isApprox(transformed_point));
 				}
 			}
 		}
@@ -97,14 +99,18 @@ namespace Maia::Renderer::Test
 			WHEN("The perspective projection matrix is calculated using these parameters")
 			{
 				Eigen::Matrix4f const projection_matrix = 
-					create_perspective_projection_matrix(vertical_half_angle_of_view, width_by_height_ratio, zRange);
+					create_finite_perspective_projection_matrix(width_by_height_ratio, 2.0f * vertical_half_angle_of_view, zRange(0), zRange(1));
 
 				THEN("The matrix should be the same as if created with Dimensions = { 2.0, 1.0f } and Z-Range = { 1.0f, 21.0f }")
 				{
-					Eigen::Matrix4f const expected_projection_matrix =
-						create_perspective_projection_matrix({ 2.0f, 1.0f }, { 1.0f, 21.0f });
-
-					CHECK(expected_projection_matrix == projection_matrix);
+					Eigen::Matrix4f expected_projection_matrix;
+					expected_projection_matrix <<
+						0.5f, 0.0f, 0.0f, 0.0f,
+						0.0f, 1.0f, 0.0f, 0.0f,
+						0.0f, 0.0f, 21.0f / 20.0f, -21.0f / 20.0f,
+						0.0f, 0.0f, 1.0f, 0.0f;
+
+					CHECK(expected_projection_matrix.isApprox(projection_matrix));
 				}
 			}
 		}
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Render_queue.hpp>
+
+namespace Maia::Renderer
+{
+	bool operator==(Draw_item const& lhs, Draw_item const& rhs)
+	{
+		return lhs.sort_key == rhs.sort_key && lhs.instance_index == rhs.instance_index;
+	}
+}
+
+namespace Maia::Renderer::Test
+{
+	namespace
+	{
+		std::vector<Draw_item> create_random_items(std::size_t const count, std::uint64_t const key_mask)
+		{
+			std::mt19937_64 random_engine{ 3 };
+
+			std::vector<Draw_item> items;
+			items.reserve(count);
+
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				items.push_back({ random_engine() & key_mask, static_cast<std::uint32_t>(index) });
+			}
+
+			return items;
+		}
+
+		std::vector<Draw_item> stable_sort_reference(std::vector<Draw_item> items)
+		{
+			std::stable_sort(items.begin(), items.end(), [](Draw_item const& lhs, Draw_item const& rhs) -> bool
+			{
+				return lhs.sort_key < rhs.sort_key;
+			});
+
+			return items;
+		}
+	}
+
+	SCENARIO("Pack draw keys into sort keys")
+	{
+		GIVEN("A draw key")
+		{
+			Draw_key const draw_key{ 3, 0x0ABC, 0x1234, 0x5678, 0x9ABC };
+
+			WHEN("It is packed into a sort key")
+			{
+				std::uint64_t const sort_key = create_sort_key(draw_key);
+
+				THEN("The fields are ordered from the pass to the depth and can be unpacked")
+				{
+					CHECK(sort_key == 0x3ABC123456789ABC);
+
+					Draw_key const unpacked_key = get_draw_key(sort_key);
+					CHECK(unpacked_key.pass == draw_key.pass);
+					CHECK(unpacked_key.pipeline == draw_key.pipeline);
+					CHECK(unpacked_key.material == draw_key.material);
+					CHECK(unpacked_key.mesh == draw_key.mesh);
+					CHECK(unpacked_key.depth == draw_key.depth);
+				}
+			}
+		}
+
+		GIVEN("Increasing depths")
+		{
+			std::vector<float> const depths{ -1.0f, 0.0f, 0.001f, 0.5f, 1.0f, 10.0f, 1000.0f };
+
+			THEN("The quantized depths do not decrease front to back and do not increase back to front")
+			{
+				for (std::size_t index = 1; index < depths.size(); ++index)
+				{
+					CHECK(quantize_depth(depths[index - 1]) <= quantize_depth(depths[index]));
+					CHECK(quantize_depth_back_to_front(depths[index - 1]) >= quantize_depth_back_to_front(depths[index]));
+				}
+
+				CHECK(quantize_depth(1.0f) < quantize_depth(10.0f));
+			}
+		}
+	}
+
+	SCENARIO("Sort draw items with a radix sort")
+	{
+		GIVEN("Random items with many equal keys")
+		{
+			// Spans several tasks and has digits that are equal in all keys
+			std::vector<Draw_item> const items = create_random_items(100000, 0x0F00'00FF'0000'0F0F);
+
+			WHEN("They are sorted with one and with four threads")
+			{
+				std::vector<Draw_item> sorted_items = items;
+				std::vector<Draw_item> scratch(items.size());
+				Maia::Utilities::Worker_threads single_thread{ 1 };
+				radix_sort(sorted_items, scratch, single_thread);
+
+				std::vector<Draw_item> parallel_sorted_items = items;
+				Maia::Utilities::Worker_threads worker_threads{ 4 };
+				radix_sort(parallel_sorted_items, scratch, worker_threads);
+
+				THEN("Both match a stable sort")
+				{
+					std::vector<Draw_item> const expected_items = stable_sort_reference(items);
+
+					CHECK(sorted_items == expected_items);
+					CHECK(parallel_sorted_items == expected_items);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Merge sorted draw items into batches")
+	{
+		GIVEN("A render queue with two meshes at several depths in two passes")
+		{
+			Maia::Utilities::Worker_threads worker_threads{ 2 };
+			Render_queue render_queue{ worker_threads };
+
+			render_queue.push(create_sort_key({ 1, 0, 0, 7, quantize_depth(5.0f) }), 0);
+			render_queue.push(create_sort_key({ 0, 0, 0, 8, quantize_depth(2.0f) }), 1);
+			render_queue.push(create_sort_key({ 0, 0, 0, 7, quantize_depth(9.0f) }), 2);
+			render_queue.push(create_sort_key({ 0, 0, 0, 8, quantize_depth(1.0f) }), 3);
+			render_queue.push(create_sort_key({ 0, 0, 0, 7, quantize_depth(3.0f) }), 4);
+
+			WHEN("The queue is sorted")
+			{
+				render_queue.sort();
+
+				THEN("Items are ordered by pass, mesh and depth")
+				{
+					std::vector<std::uint32_t> instance_indices;
+
+					for (Draw_item const& item : render_queue.get_items())
+					{
+						instance_indices.push_back(item.instance_index);
+					}
+
+					CHECK(instance_indices == std::vector<std::uint32_t>{ 4, 2, 3, 1, 0 });
+				}
+
+				THEN("Items that only differ in depth are merged")
+				{
+					gsl::span<Draw_batch const> const batches = render_queue.get_batches();
+
+					REQUIRE(batches.size() == 3);
+
+					CHECK(get_draw_key(batches[0].sort_key).mesh == 7);
+					CHECK(batches[0].first_item == 0);
+					CHECK(batches[0].item_count == 2);
+
+					CHECK(get_draw_key(batches[1].sort_key).mesh == 8);
+					CHECK(batches[1].first_item == 2);
+					CHECK(batches[1].item_count == 2);
+
+					CHECK(get_draw_key(batches[2].sort_key).pass == 1);
+					CHECK(get_draw_key(batches[2].sort_key).depth == 0);
+					CHECK(batches[2].first_item == 4);
+					CHECK(batches[2].item_count == 1);
+				}
+			}
+
+			WHEN("The queue is cleared")
+			{
+				render_queue.sort();
+				render_queue.clear();
+
+				THEN("It has no items nor batches")
+				{
+					CHECK(render_queue.get_items().empty());
+					CHECK(render_queue.get_batches().empty());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch.hpp>
+
+#include <Maia/Renderer/Ring_allocator.hpp>
+
+namespace Maia::Renderer::Test
+{
+	SCENARIO("Suballocate a ring buffer to frames in flight", "[Ring_allocator]")
+	{
+		GIVEN("An empty ring allocator of 1024 bytes")
+		{
+			Ring_allocator ring_allocator{ 1024 };
+
+			WHEN("Allocations are made")
+			{
+				std::optional<std::size_t> const first = ring_allocator.allocate(100, 16);
+				std::optional<std::size_t> const second = ring_allocator.allocate(100, 16);
+
+				THEN("They are consecutive and aligned")
+				{
+					REQUIRE(first);
+					REQUIRE(second);
+					CHECK(*first == 0);
+					CHECK(*second == 112);
+					CHECK(ring_allocator.used_size() == 212);
+				}
+			}
+
+			WHEN("An allocation is larger than the buffer")
+			{
+				THEN("It fails")
+				{
+					CHECK(!ring_allocator.allocate(2048, 16));
+				}
+			}
+
+			WHEN("The frames in flight use all the buffer")
+			{
+				REQUIRE(ring_allocator.allocate(512, 16));
+				ring_allocator.finish_frame(1);
+				REQUIRE(ring_allocator.allocate(512, 16));
+				ring_allocator.finish_frame(2);
+
+				THEN("Allocations fail until a frame is completed")
+				{
+					CHECK(!ring_allocator.allocate(16, 16));
+
+					ring_allocator.release_completed_frames(1);
+
+					std::optional<std::size_t> const offset = ring_allocator.allocate(16, 16);
+					REQUIRE(offset);
+					CHECK(*offset == 0);
+				}
+			}
+
+			WHEN("An allocation does not fit at the end of the buffer")
+			{
+				REQUIRE(ring_allocator.allocate(400, 16));
+				ring_allocator.finish_frame(1);
+				REQUIRE(ring_allocator.allocate(400, 16));
+				ring_allocator.finish_frame(2);
+				ring_allocator.release_completed_frames(1);
+
+				std::optional<std::size_t> const offset = ring_allocator.allocate(300, 16);
+
+				THEN("It wraps to the start of the buffer and the end is counted as used")
+				{
+					REQUIRE(offset);
+					CHECK(*offset == 0);
+					CHECK(ring_allocator.used_size() == 400 + 224 + 300);
+				}
+
+				THEN("It cannot overlap the frames in flight")
+				{
+					CHECK(!ring_allocator.allocate(200, 16));
+				}
+
+				AND_WHEN("All frames are completed")
+				{
+					ring_allocator.finish_frame(3);
+					ring_allocator.release_completed_frames(3);
+
+					THEN("The whole buffer is free")
+					{
+						CHECK(ring_allocator.used_size() == 0);
+
+						std::optional<std::size_t> const whole_buffer = ring_allocator.allocate(1024, 16);
+						REQUIRE(whole_buffer);
+						CHECK(*whole_buffer == 0);
+					}
+				}
+			}
+		}
+	}
+}
@@ -10,7 +10,7 @@ struct Color
 
 struct Instance_data
 {
-	float4x4 world_matrix : WORLD;
+	uint slot : INSTANCE_SLOT;
 	uint instance_ID : SV_INSTANCEID;
 };
 
@@ -27,12 +27,15 @@ struct Vertex_shader_output
 };
 
 ConstantBuffer<Pass_data> g_pass_data : register(b0, space0);
+StructuredBuffer<row_major float4x4> g_instance_transforms : register(t0, space0);
 
 Vertex_shader_output main(World_position world_position, Color color, Instance_data instance_data)
 {
 	Vertex_shader_output output;
 
-	const float4 positionW = mul(instance_data.world_matrix, float4(world_position.value, 1.0f));
+	const float4x4 world_matrix = g_instance_transforms[instance_data.slot];
+
+	const float4 positionW = mul(world_matrix, float4(world_position.value, 1.0f));
 	const float4 positionV = mul(g_pass_data.view_matrix, positionW);
 	output.positionH = mul(g_pass_data.projection_matrix, positionV);
 
@@ -0,0 +1,33 @@
+#ifndef MAIA_UTILITIES_ALLOCATORSTATISTICS_H_INCLUDED
+#define MAIA_UTILITIES_ALLOCATORSTATISTICS_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Maia::Utilities
+{
+	// Statistics of the allocators that manage offsets in a range.
+	struct Allocator_statistics
+	{
+		std::uint64_t capacity;
+		std::uint64_t allocated_size;
+		std::uint64_t free_size;
+		std::uint64_t largest_free_block_size;
+		std::size_t num_allocations;
+		std::size_t num_free_blocks;
+	};
+
+	// Ratio of free memory that cannot be used by an allocation of the largest free block size.
+	// 0 when all free memory is in a single block.
+	inline float calculate_external_fragmentation(Allocator_statistics const& statistics)
+	{
+		if (statistics.free_size == 0)
+		{
+			return 0.0f;
+		}
+
+		return 1.0f - static_cast<float>(statistics.largest_free_block_size) / static_cast<float>(statistics.free_size);
+	}
+}
+
+#endif
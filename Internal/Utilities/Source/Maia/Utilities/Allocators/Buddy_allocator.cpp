@@ -0,0 +1,303 @@
+#include "Buddy_allocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Maia::Utilities
+{
+	namespace
+	{
+		constexpr bool is_power_of_two(std::uint64_t const value) noexcept
+		{
+			return value != 0 && (value & (value - 1)) == 0;
+		}
+
+		constexpr std::uint64_t round_up_to_power_of_two(std::uint64_t const value) noexcept
+		{
+			std::uint64_t power = 1;
+
+			while (power < value)
+			{
+				power <<= 1;
+			}
+
+			return power;
+		}
+
+		constexpr std::size_t log2_of_power_of_two(std::uint64_t value) noexcept
+		{
+			std::size_t exponent = 0;
+
+			while (value > 1)
+			{
+				value >>= 1;
+				++exponent;
+			}
+
+			return exponent;
+		}
+
+		constexpr std::size_t bits_per_word = 64;
+	}
+
+	Buddy_allocator::Buddy_allocator(std::uint64_t const capacity, std::uint64_t const minimum_block_size) :
+		m_capacity{ capacity },
+		m_minimum_block_size{ minimum_block_size },
+		m_num_levels{ log2_of_power_of_two(capacity / minimum_block_size) + 1 },
+		m_free_bits{},
+		m_split_bits{},
+		m_free_blocks(m_num_levels),
+		m_num_free_blocks(m_num_levels, 0),
+		m_allocated_size{ 0 },
+		m_num_allocations{ 0 }
+	{
+		assert(is_power_of_two(capacity));
+		assert(is_power_of_two(minimum_block_size));
+		assert(capacity >= minimum_block_size);
+
+		std::size_t const num_nodes = (std::size_t{ 1 } << m_num_levels) - 1;
+		std::size_t const num_words = (num_nodes + bits_per_word - 1) / bits_per_word;
+
+		m_free_bits.resize(num_words, 0);
+		m_split_bits.resize(num_words, 0);
+
+		push_free_block(0, 0);
+	}
+
+
+	std::optional<Buddy_allocation> Buddy_allocator::allocate(std::uint64_t const size, std::uint64_t const alignment)
+	{
+		std::uint64_t const required_size = std::max({ size, alignment, m_minimum_block_size });
+
+		if (required_size > m_capacity)
+		{
+			return std::nullopt;
+		}
+
+		std::uint64_t const block_size = round_up_to_power_of_two(required_size);
+		std::size_t const level = log2_of_power_of_two(m_capacity / block_size);
+
+		// Find the smallest free block that is large enough
+		std::size_t found_level = level + 1;
+		std::uint64_t block_index = 0;
+
+		for (std::size_t current_level = level + 1; current_level > 0; --current_level)
+		{
+			std::optional<std::uint64_t> const free_block_index = pop_free_block(current_level - 1);
+
+			if (free_block_index)
+			{
+				found_level = current_level - 1;
+				block_index = *free_block_index;
+				break;
+			}
+		}
+
+		if (found_level > level)
+		{
+			return std::nullopt;
+		}
+
+		// Split it until it has the requested size, keeping the left half and freeing the right half
+		for (std::size_t current_level = found_level; current_level < level; ++current_level)
+		{
+			set_split(get_node_index(current_level, block_index), true);
+
+			block_index *= 2;
+			push_free_block(current_level + 1, block_index + 1);
+		}
+
+		m_allocated_size += block_size;
+		++m_num_allocations;
+
+		return Buddy_allocation{ block_index * block_size, block_size };
+	}
+
+	void Buddy_allocator::deallocate(std::uint64_t const offset)
+	{
+		assert(offset < m_capacity);
+
+		// The allocated block is the first block that contains offset and that is not split
+		std::size_t level = 0;
+		std::uint64_t block_index = 0;
+
+		while (is_split(get_node_index(level, block_index)))
+		{
+			++level;
+			block_index = offset / get_block_size(level);
+		}
+
+		assert(offset == block_index * get_block_size(level));
+		assert(!is_free(get_node_index(level, block_index)));
+
+		m_allocated_size -= get_block_size(level);
+		--m_num_allocations;
+
+		// Merge with the buddy while it is free
+		while (level > 0)
+		{
+			std::size_t const buddy_node_index = get_node_index(level, block_index ^ 1);
+
+			if (!is_free(buddy_node_index))
+			{
+				break;
+			}
+
+			set_free(buddy_node_index, false);
+			--m_num_free_blocks[level];
+
+			--level;
+			block_index /= 2;
+
+			set_split(get_node_index(level, block_index), false);
+		}
+
+		push_free_block(level, block_index);
+	}
+
+
+	std::uint64_t Buddy_allocator::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	std::uint64_t Buddy_allocator::minimum_block_size() const noexcept
+	{
+		return m_minimum_block_size;
+	}
+
+	std::uint64_t Buddy_allocator::allocated_size() const noexcept
+	{
+		return m_allocated_size;
+	}
+
+	Allocator_statistics Buddy_allocator::statistics() const noexcept
+	{
+		std::uint64_t largest_free_block_size = 0;
+		std::size_t num_free_blocks = 0;
+
+		for (std::size_t level = 0; level < m_num_levels; ++level)
+		{
+			if (m_num_free_blocks[level] > 0 && largest_free_block_size == 0)
+			{
+				largest_free_block_size = get_block_size(level);
+			}
+
+			num_free_blocks += m_num_free_blocks[level];
+		}
+
+		return
+		{
+			m_capacity,
+			m_allocated_size,
+			m_capacity - m_allocated_size,
+			largest_free_block_size,
+			m_num_allocations,
+			num_free_blocks
+		};
+	}
+
+
+	std::size_t Buddy_allocator::get_node_index(std::size_t const level, std::uint64_t const block_index) const noexcept
+	{
+		return (std::size_t{ 1 } << level) - 1 + static_cast<std::size_t>(block_index);
+	}
+
+	std::uint64_t Buddy_allocator::get_block_size(std::size_t const level) const noexcept
+	{
+		return m_capacity >> level;
+	}
+
+	bool Buddy_allocator::is_free(std::size_t const node_index) const noexcept
+	{
+		return (m_free_bits[node_index / bits_per_word] >> (node_index % bits_per_word)) & 1;
+	}
+
+	bool Buddy_allocator::is_split(std::size_t const node_index) const noexcept
+	{
+		return (m_split_bits[node_index / bits_per_word] >> (node_index % bits_per_word)) & 1;
+	}
+
+	void Buddy_allocator::set_free(std::size_t const node_index, bool const value) noexcept
+	{
+		std::uint64_t const mask = std::uint64_t{ 1 } << (node_index % bits_per_word);
+		std::uint64_t& word = m_free_bits[node_index / bits_per_word];
+
+		word = value ? (word | mask) : (word & ~mask);
+	}
+
+	void Buddy_allocator::set_split(std::size_t const node_index, bool const value) noexcept
+	{
+		std::uint64_t const mask = std::uint64_t{ 1 } << (node_index % bits_per_word);
+		std::uint64_t& word = m_split_bits[node_index / bits_per_word];
+
+		word = value ? (word | mask) : (word & ~mask);
+	}
+
+	void Buddy_allocator::push_free_block(std::size_t const level, std::uint64_t const block_index)
+	{
+		set_free(get_node_index(level, block_index), true);
+		++m_num_free_blocks[level];
+
+		std::vector<std::uint64_t>& free_blocks = m_free_blocks[level];
+		free_blocks.push_back(block_index);
+
+		// Rebuilding scans the bitmap of the level, so only do it once the stale entries outnumber its words
+		std::size_t const num_level_words = ((std::size_t{ 1 } << level) + bits_per_word - 1) / bits_per_word;
+
+		if (free_blocks.size() > 2 * m_num_free_blocks[level] + num_level_words)
+		{
+			rebuild_free_blocks(level);
+		}
+	}
+
+	std::optional<std::uint64_t> Buddy_allocator::pop_free_block(std::size_t const level)
+	{
+		std::vector<std::uint64_t>& free_blocks = m_free_blocks[level];
+
+		while (!free_blocks.empty())
+		{
+			std::uint64_t const block_index = free_blocks.back();
+			free_blocks.pop_back();
+
+			std::size_t const node_index = get_node_index(level, block_index);
+
+			if (is_free(node_index))
+			{
+				set_free(node_index, false);
+				--m_num_free_blocks[level];
+
+				return block_index;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	void Buddy_allocator::rebuild_free_blocks(std::size_t const level)
+	{
+		std::vector<std::uint64_t>& free_blocks = m_free_blocks[level];
+		free_blocks.clear();
+
+		std::size_t const first_node_index = get_node_index(level, 0);
+		std::size_t const end_node_index = get_node_index(level + 1, 0);
+
+		std::size_t node_index = first_node_index;
+
+		while (node_index < end_node_index)
+		{
+			if (node_index % bits_per_word == 0 && node_index + bits_per_word <= end_node_index && m_free_bits[node_index / bits_per_word] == 0)
+			{
+				node_index += bits_per_word;
+				continue;
+			}
+
+			if (is_free(node_index))
+			{
+				free_blocks.push_back(node_index - first_node_index);
+			}
+
+			++node_index;
+		}
+	}
+}
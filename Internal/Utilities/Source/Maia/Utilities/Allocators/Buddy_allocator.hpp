@@ -1,12 +1,83 @@
 #ifndef MAIA_UTILITIES_BUDDYALLOCATOR_H_INCLUDED
 #define MAIA_UTILITIES_BUDDYALLOCATOR_H_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Maia/Utilities/Allocators/Allocator_statistics.hpp>
+
 namespace Maia::Utilities
 {
+	struct Buddy_allocation
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+	};
+
+	// Manages offsets in a range that is owned by the caller, such as a GPU heap or a host memory block.
+	// Blocks are powers of two between the minimum block size and the capacity. The split state and the free state
+	// of every block are kept in bitmaps so that allocate and deallocate are O(log(capacity / minimum_block_size)).
 	class Buddy_allocator
 	{
 	public:
 
+		// capacity and minimum_block_size must be powers of two and capacity >= minimum_block_size.
+		Buddy_allocator(std::uint64_t capacity, std::uint64_t minimum_block_size);
+
+
+		// Rounds size up to a power of two that is at least alignment and the minimum block size.
+		// Returns std::nullopt if there is no free block large enough.
+		std::optional<Buddy_allocation> allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+		// offset must have been returned by allocate and not deallocated yet.
+		void deallocate(std::uint64_t offset);
+
+
+		std::uint64_t capacity() const noexcept;
+
+		std::uint64_t minimum_block_size() const noexcept;
+
+		std::uint64_t allocated_size() const noexcept;
+
+		Allocator_statistics statistics() const noexcept;
+
+
+	private:
+
+		std::size_t get_node_index(std::size_t level, std::uint64_t block_index) const noexcept;
+
+		std::uint64_t get_block_size(std::size_t level) const noexcept;
+
+		bool is_free(std::size_t node_index) const noexcept;
+
+		bool is_split(std::size_t node_index) const noexcept;
+
+		void set_free(std::size_t node_index, bool value) noexcept;
+
+		void set_split(std::size_t node_index, bool value) noexcept;
+
+		void push_free_block(std::size_t level, std::uint64_t block_index);
+
+		std::optional<std::uint64_t> pop_free_block(std::size_t level);
+
+		void rebuild_free_blocks(std::size_t level);
+
+
+		std::uint64_t m_capacity;
+		std::uint64_t m_minimum_block_size;
+		std::size_t m_num_levels;
+		std::vector<std::uint64_t> m_free_bits;
+		std::vector<std::uint64_t> m_split_bits;
+
+		// Free lists are stacks of block indices. Blocks that are merged with their buddy are only removed from
+		// the free bitmap, so stale entries are skipped on pop and dropped when a stack is rebuilt.
+		std::vector<std::vector<std::uint64_t>> m_free_blocks;
+		std::vector<std::size_t> m_num_free_blocks;
+
+		std::uint64_t m_allocated_size;
+		std::size_t m_num_allocations;
 
 	};
 }
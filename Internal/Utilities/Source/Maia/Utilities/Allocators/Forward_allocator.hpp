@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <Maia/Utilities/Allocators/Memory_arena.hpp>
 
@@ -68,6 +69,9 @@ namespace Maia::Utilities
 	{
 		return !(lhs == rhs);
 	}
+
+	template <class T>
+	using Arena_vector = std::vector<T, Forward_allocator<T>>;
 }
 
 #endif
@@ -0,0 +1,42 @@
+#include "Frame_arenas.hpp"
+
+#include <cassert>
+
+namespace Maia::Utilities
+{
+	Frame_arenas::Frame_arenas(std::size_t const num_frames, std::size_t const block_size_in_bytes) :
+		m_arenas{},
+		m_current_index{ 0 }
+	{
+		assert(num_frames > 0);
+
+		m_arenas.reserve(num_frames);
+
+		for (std::size_t index = 0; index < num_frames; ++index)
+		{
+			m_arenas.push_back(std::make_unique<Memory_arena>(block_size_in_bytes));
+		}
+	}
+
+
+	void Frame_arenas::begin_frame() noexcept
+	{
+		m_current_index = (m_current_index + 1) % m_arenas.size();
+		m_arenas[m_current_index]->reset();
+	}
+
+	Memory_arena& Frame_arenas::current() noexcept
+	{
+		return *m_arenas[m_current_index];
+	}
+
+	Memory_arena const& Frame_arenas::current() const noexcept
+	{
+		return *m_arenas[m_current_index];
+	}
+
+	std::size_t Frame_arenas::num_frames() const noexcept
+	{
+		return m_arenas.size();
+	}
+}
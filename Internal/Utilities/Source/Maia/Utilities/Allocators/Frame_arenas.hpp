@@ -0,0 +1,38 @@
+#ifndef MAIA_UTILITIES_FRAMEARENAS_H_INCLUDED
+#define MAIA_UTILITIES_FRAMEARENAS_H_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <Maia/Utilities/Allocators/Memory_arena.hpp>
+
+namespace Maia::Utilities
+{
+	// Memory_arena per frame in flight, used in turns. What is allocated during a frame stays valid while the next
+	// num_frames - 1 frames are updated, so that the frame can still be read while it is rendered.
+	class Frame_arenas
+	{
+	public:
+
+		Frame_arenas(std::size_t num_frames, std::size_t block_size_in_bytes);
+
+
+		// Moves to the arena of the next frame and frees what was allocated in it num_frames frames ago.
+		void begin_frame() noexcept;
+
+		Memory_arena& current() noexcept;
+
+		Memory_arena const& current() const noexcept;
+
+		std::size_t num_frames() const noexcept;
+
+	private:
+
+		std::vector<std::unique_ptr<Memory_arena>> m_arenas;
+		std::size_t m_current_index;
+
+	};
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include "Memory_arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace Maia::Utilities
+{
+	Memory_arena::Memory_arena(std::size_t const block_size_in_bytes, std::size_t const maximum_capacity_in_bytes) :
+		m_block_size_in_bytes{ block_size_in_bytes },
+		m_maximum_capacity_in_bytes{ maximum_capacity_in_bytes },
+		m_blocks{},
+		m_capacity_in_bytes{ block_size_in_bytes },
+		m_block_index{ 0 },
+		m_offset_in_bytes{ 0 },
+		m_used_capacity_in_previous_blocks{ 0 },
+		m_high_water_mark{ 0 }
+	{
+		assert(block_size_in_bytes > 0 && block_size_in_bytes <= maximum_capacity_in_bytes);
+
+		m_blocks.push_back({ std::make_unique<std::byte[]>(block_size_in_bytes), block_size_in_bytes });
+	}
+
+
+	void* Memory_arena::allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		void* data = allocate_in_current_block(size_in_bytes, alignment_in_bytes);
+
+		if (data == nullptr)
+		{
+			data = allocate_in_next_blocks(size_in_bytes, alignment_in_bytes);
+		}
+
+		if (data == nullptr)
+		{
+			std::size_t const new_block_size_in_bytes = std::max(m_block_size_in_bytes, size_in_bytes + alignment_in_bytes - 1);
+
+			if (new_block_size_in_bytes > m_maximum_capacity_in_bytes - m_capacity_in_bytes)
+			{
+				throw std::bad_alloc();
+			}
+
+			m_blocks.push_back({ std::make_unique<std::byte[]>(new_block_size_in_bytes), new_block_size_in_bytes });
+			m_capacity_in_bytes += new_block_size_in_bytes;
+
+			data = allocate_in_next_blocks(size_in_bytes, alignment_in_bytes);
+			assert(data != nullptr);
+		}
+
+		m_high_water_mark = std::max(m_high_water_mark, used_capacity());
+
+		return data;
+	}
+
+
+	Memory_arena_marker Memory_arena::mark() const noexcept
+	{
+		return { m_block_index, m_offset_in_bytes, used_capacity() };
+	}
+
+	void Memory_arena::rewind(Memory_arena_marker const& marker) noexcept
+	{
+		assert(marker.block_index < m_block_index || (marker.block_index == m_block_index && marker.offset_in_bytes <= m_offset_in_bytes));
+
+		m_block_index = marker.block_index;
+		m_offset_in_bytes = marker.offset_in_bytes;
+		m_used_capacity_in_previous_blocks = marker.used_capacity - marker.offset_in_bytes;
+	}
+
+	void Memory_arena::reset() noexcept
+	{
+		rewind({ 0, 0, 0 });
+	}
+
+
+	std::size_t Memory_arena::capacity() const noexcept
+	{
+		return m_capacity_in_bytes;
+	}
+
+	std::size_t Memory_arena::used_capacity() const noexcept
+	{
+		return m_used_capacity_in_previous_blocks + m_offset_in_bytes;
+	}
+
+	std::size_t Memory_arena::high_water_mark() const noexcept
+	{
+		return m_high_water_mark;
+	}
+
+	std::size_t Memory_arena::num_blocks() const noexcept
+	{
+		return m_blocks.size();
+	}
+
+
+	void* Memory_arena::allocate_in_current_block(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes) noexcept
+	{
+		Block const& block = m_blocks[m_block_index];
+
+		void* data = block.data.get() + m_offset_in_bytes;
+		std::size_t space_in_bytes = block.size_in_bytes - m_offset_in_bytes;
+
+		if (!std::align(alignment_in_bytes, size_in_bytes, data, space_in_bytes))
+		{
+			return nullptr;
+		}
+
+		m_offset_in_bytes = static_cast<std::size_t>(static_cast<std::byte*>(data) - block.data.get()) + size_in_bytes;
+
+		return data;
+	}
+
+	void* Memory_arena::allocate_in_next_blocks(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes) noexcept
+	{
+		for (std::size_t block_index = m_block_index + 1; block_index < m_blocks.size(); ++block_index)
+		{
+			Block const& block = m_blocks[block_index];
+
+			void* data = block.data.get();
+			std::size_t space_in_bytes = block.size_in_bytes;
+
+			if (std::align(alignment_in_bytes, size_in_bytes, data, space_in_bytes))
+			{
+				// The end of the current block and the skipped blocks count as used
+				for (std::size_t used_block_index = m_block_index; used_block_index < block_index; ++used_block_index)
+				{
+					m_used_capacity_in_previous_blocks += m_blocks[used_block_index].size_in_bytes;
+				}
+
+				m_block_index = block_index;
+				m_offset_in_bytes = static_cast<std::size_t>(static_cast<std::byte*>(data) - block.data.get()) + size_in_bytes;
+
+				return data;
+			}
+		}
+
+		return nullptr;
+	}
+}
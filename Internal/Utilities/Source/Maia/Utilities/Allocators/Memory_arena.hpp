@@ -2,62 +2,87 @@
 #define MAIA_UTILITIES_MEMORYARENA_H_INCLUDED
 
 #include <cstddef>
+#include <limits>
 #include <memory>
-#include <stdexcept>
+#include <vector>
 
 namespace Maia::Utilities
 {
+	// Position of a Memory_arena that it can be rewound to.
+	struct Memory_arena_marker
+	{
+		std::size_t block_index;
+		std::size_t offset_in_bytes;
+		std::size_t used_capacity;
+	};
+
+
+	// Linear allocator over a chain of blocks. Memory is only freed by rewinding to a marker or by resetting, which
+	// keeps the blocks so that the next allocations reuse them.
 	class Memory_arena
 	{
 	public:
 
-		explicit Memory_arena(std::size_t const size_in_bytes) :
-			m_data{ std::make_unique<std::byte[]>(size_in_bytes) },
-			m_size_in_bytes{ size_in_bytes },
-			m_offset_in_bytes{ 0 }
-		{
-		}
+		// A block of block_size bytes is added when an allocation does not fit in the remaining blocks, or a larger
+		// one if the allocation needs it. Allocations throw std::bad_alloc if the blocks would exceed maximum_capacity.
+		explicit Memory_arena(
+			std::size_t block_size_in_bytes,
+			std::size_t maximum_capacity_in_bytes = std::numeric_limits<std::size_t>::max()
+		);
 		Memory_arena(Memory_arena const&) = delete;
 		Memory_arena(Memory_arena&& other) = delete;
 
 		Memory_arena& operator=(Memory_arena const&) = delete;
 		Memory_arena& operator=(Memory_arena&&) = delete;
 
-		void* allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
-		{
-			void* data = m_data.get() + m_offset_in_bytes;
-			
-			auto const original_space = m_size_in_bytes - m_offset_in_bytes;
-			auto original_space_minus_alignment = original_space;
-
-			if (!std::align(alignment_in_bytes, size_in_bytes, data, original_space_minus_alignment))
-			{
-				throw std::bad_alloc();
-			}
-
-			auto const bytes_used_for_alignment = original_space - original_space_minus_alignment;
-			m_offset_in_bytes += size_in_bytes + bytes_used_for_alignment;
+		void* allocate(std::size_t size_in_bytes, std::size_t alignment_in_bytes);
 
-			return data;
-		}
 		void deallocate(void* const data, std::size_t const size_in_bytes) noexcept
 		{
 		}
 
-		std::size_t capacity() const noexcept
-		{
-			return m_size_in_bytes;
-		}
-		std::size_t used_capacity() const noexcept
-		{
-			return m_offset_in_bytes;
-		}
+
+		Memory_arena_marker mark() const noexcept;
+
+		// Frees everything that was allocated after marker was taken.
+		void rewind(Memory_arena_marker const& marker) noexcept;
+
+		void reset() noexcept;
+
+
+		// Sum of the sizes of the blocks.
+		std::size_t capacity() const noexcept;
+
+		// Bytes allocated since the last reset, including alignment padding and the unused end of full blocks.
+		std::size_t used_capacity() const noexcept;
+
+		// Largest used capacity since construction.
+		std::size_t high_water_mark() const noexcept;
+
+		std::size_t num_blocks() const noexcept;
 
 	private:
 
-		std::unique_ptr<std::byte[]> const m_data;
-		std::size_t const m_size_in_bytes;
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> data;
+			std::size_t size_in_bytes;
+		};
+
+
+		void* allocate_in_current_block(std::size_t size_in_bytes, std::size_t alignment_in_bytes) noexcept;
+
+		void* allocate_in_next_blocks(std::size_t size_in_bytes, std::size_t alignment_in_bytes) noexcept;
+
+
+		std::size_t const m_block_size_in_bytes;
+		std::size_t const m_maximum_capacity_in_bytes;
+		std::vector<Block> m_blocks;
+		std::size_t m_capacity_in_bytes;
+		std::size_t m_block_index;
 		std::size_t m_offset_in_bytes;
+		std::size_t m_used_capacity_in_previous_blocks;
+		std::size_t m_high_water_mark;
 
 	};
 }
@@ -0,0 +1,153 @@
+#include "Memory_resources.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <optional>
+
+namespace Maia::Utilities
+{
+	namespace
+	{
+		// Size of the block index stored in front of the allocations of a Tlsf_memory_resource, which keeps them
+		// aligned because alignments are powers of two.
+		std::size_t get_tlsf_header_size(std::size_t const alignment_in_bytes) noexcept
+		{
+			return std::max(alignment_in_bytes, sizeof(std::uint32_t));
+		}
+	}
+
+	Memory_arena_resource::Memory_arena_resource(Memory_arena& memory_arena) noexcept :
+		m_memory_arena{ memory_arena }
+	{
+	}
+
+	Memory_arena& Memory_arena_resource::arena() const noexcept
+	{
+		return m_memory_arena;
+	}
+
+	void* Memory_arena_resource::do_allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		return m_memory_arena.allocate(size_in_bytes, alignment_in_bytes);
+	}
+
+	void Memory_arena_resource::do_deallocate(void* const data, std::size_t const size_in_bytes, std::size_t)
+	{
+		m_memory_arena.deallocate(data, size_in_bytes);
+	}
+
+	bool Memory_arena_resource::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		Memory_arena_resource const* const other_arena_resource = dynamic_cast<Memory_arena_resource const*>(&other);
+		return other_arena_resource != nullptr && &other_arena_resource->m_memory_arena == &m_memory_arena;
+	}
+
+
+	Buddy_memory_resource::Buddy_memory_resource(
+		std::uint64_t const capacity,
+		std::uint64_t const minimum_block_size,
+		std::pmr::memory_resource* const upstream
+	) :
+		m_allocator{ capacity, minimum_block_size },
+		m_upstream{ upstream },
+		m_buffer{ static_cast<std::byte*>(upstream->allocate(static_cast<std::size_t>(capacity), buffer_alignment)) }
+	{
+	}
+
+	Buddy_memory_resource::~Buddy_memory_resource() noexcept
+	{
+		m_upstream->deallocate(m_buffer, static_cast<std::size_t>(m_allocator.capacity()), buffer_alignment);
+	}
+
+	Buddy_allocator const& Buddy_memory_resource::allocator() const noexcept
+	{
+		return m_allocator;
+	}
+
+	void* Buddy_memory_resource::do_allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		assert(alignment_in_bytes <= buffer_alignment);
+
+		std::optional<Buddy_allocation> const allocation = m_allocator.allocate(size_in_bytes, alignment_in_bytes);
+
+		if (!allocation)
+		{
+			throw std::bad_alloc{};
+		}
+
+		return m_buffer + allocation->offset;
+	}
+
+	void Buddy_memory_resource::do_deallocate(void* const data, std::size_t, std::size_t)
+	{
+		m_allocator.deallocate(static_cast<std::uint64_t>(static_cast<std::byte*>(data) - m_buffer));
+	}
+
+	bool Buddy_memory_resource::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+	{
+		return this == &other;
+	}
+
+
+	Tlsf_memory_resource::Tlsf_memory_resource(
+		std::uint64_t const capacity,
+		std::pmr::memory_resource* const upstream
+	) :
+		m_allocator{ capacity },
+		m_upstream{ upstream },
+		m_buffer{ static_cast<std::byte*>(upstream->allocate(static_cast<std::size_t>(capacity), buffer_alignment)) }
+	{
+	}
+
+	Tlsf_memory_resource::~Tlsf_memory_resource() noexcept
+	{
+		m_upstream->deallocate(m_buffer, static_cast<std::size_t>(m_allocator.capacity()), buffer_alignment);
+	}
+
+	Tlsf_allocator const& Tlsf_memory_resource::allocator() const noexcept
+	{
+		return m_allocator;
+	}
+
+	void* Tlsf_memory_resource::do_allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		assert(alignment_in_bytes <= buffer_alignment);
+
+		std::size_t const header_size = get_tlsf_header_size(alignment_in_bytes);
+
+		std::optional<Tlsf_allocation> const allocation = m_allocator.allocate(size_in_bytes + header_size, alignment_in_bytes);
+
+		if (!allocation)
+		{
+			throw std::bad_alloc{};
+		}
+
+		std::byte* const data = m_buffer + allocation->offset + header_size;
+		std::memcpy(data - sizeof(std::uint32_t), &allocation->block_index, sizeof(std::uint32_t));
+
+		return data;
+	}
+
+	void Tlsf_memory_resource::do_deallocate(void* const data, std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		std::size_t const header_size = get_tlsf_header_size(alignment_in_bytes);
+		std::byte* const bytes = static_cast<std::byte*>(data);
+
+		std::uint32_t block_index;
+		std::memcpy(&block_index, bytes - sizeof(std::uint32_t), sizeof(std::uint32_t));
+
+		m_allocator.deallocate({ static_cast<std::uint64_t>(bytes - header_size - m_buffer), size_in_bytes + header_size, block_index });
+	}
+
+	bool Tlsf_memory_resource::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+	{
+		return this == &other;
+	}
+}
@@ -0,0 +1,119 @@
+#ifndef MAIA_UTILITIES_MEMORYRESOURCES_H_INCLUDED
+#define MAIA_UTILITIES_MEMORYRESOURCES_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
+#include <Maia/Utilities/Allocators/Memory_arena.hpp>
+#include <Maia/Utilities/Allocators/Tlsf_allocator.hpp>
+
+namespace Maia::Utilities
+{
+	// Allocates from a Memory_arena, so deallocations do nothing until the arena is rewound or reset.
+	class Memory_arena_resource final : public std::pmr::memory_resource
+	{
+	public:
+
+		explicit Memory_arena_resource(Memory_arena& memory_arena) noexcept;
+
+
+		Memory_arena& arena() const noexcept;
+
+
+	private:
+
+		void* do_allocate(std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		void do_deallocate(void* data, std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept final;
+
+
+		Memory_arena& m_memory_arena;
+
+	};
+
+
+	// Allocates from a buffer of the upstream resource that is managed by a Buddy_allocator.
+	// The buffer is aligned to buffer_alignment bytes, which is the largest supported alignment.
+	class Buddy_memory_resource final : public std::pmr::memory_resource
+	{
+	public:
+
+		static constexpr std::size_t buffer_alignment = 4096;
+
+		Buddy_memory_resource(
+			std::uint64_t capacity,
+			std::uint64_t minimum_block_size,
+			std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+		);
+		Buddy_memory_resource(Buddy_memory_resource const&) = delete;
+		Buddy_memory_resource(Buddy_memory_resource&&) = delete;
+		~Buddy_memory_resource() noexcept;
+
+		Buddy_memory_resource& operator=(Buddy_memory_resource const&) = delete;
+		Buddy_memory_resource& operator=(Buddy_memory_resource&&) = delete;
+
+
+		Buddy_allocator const& allocator() const noexcept;
+
+
+	private:
+
+		void* do_allocate(std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		void do_deallocate(void* data, std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept final;
+
+
+		Buddy_allocator m_allocator;
+		std::pmr::memory_resource* m_upstream;
+		std::byte* m_buffer;
+
+	};
+
+
+	// Allocates from a buffer of the upstream resource that is managed by a Tlsf_allocator.
+	// The block index that deallocate needs is stored in front of each allocation, in at least alignment bytes.
+	// The buffer is aligned to buffer_alignment bytes, which is the largest supported alignment.
+	class Tlsf_memory_resource final : public std::pmr::memory_resource
+	{
+	public:
+
+		static constexpr std::size_t buffer_alignment = 4096;
+
+		explicit Tlsf_memory_resource(
+			std::uint64_t capacity,
+			std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+		);
+		Tlsf_memory_resource(Tlsf_memory_resource const&) = delete;
+		Tlsf_memory_resource(Tlsf_memory_resource&&) = delete;
+		~Tlsf_memory_resource() noexcept;
+
+		Tlsf_memory_resource& operator=(Tlsf_memory_resource const&) = delete;
+		Tlsf_memory_resource& operator=(Tlsf_memory_resource&&) = delete;
+
+
+		Tlsf_allocator const& allocator() const noexcept;
+
+
+	private:
+
+		void* do_allocate(std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		void do_deallocate(void* data, std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept final;
+
+
+		Tlsf_allocator m_allocator;
+		std::pmr::memory_resource* m_upstream;
+		std::byte* m_buffer;
+
+	};
+}
+
+#endif
@@ -0,0 +1,18 @@
+#include "Scratch_arena.hpp"
+
+#include <cstddef>
+
+namespace Maia::Utilities
+{
+	namespace
+	{
+		constexpr std::size_t scratch_block_size_in_bytes = 64 * 1024;
+	}
+
+	Memory_arena& get_thread_scratch_arena()
+	{
+		thread_local Memory_arena scratch_arena{ scratch_block_size_in_bytes };
+
+		return scratch_arena;
+	}
+}
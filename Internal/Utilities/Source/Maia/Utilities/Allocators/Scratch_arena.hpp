@@ -0,0 +1,63 @@
+#ifndef MAIA_UTILITIES_SCRATCHARENA_H_INCLUDED
+#define MAIA_UTILITIES_SCRATCHARENA_H_INCLUDED
+
+#include <Maia/Utilities/Allocators/Forward_allocator.hpp>
+#include <Maia/Utilities/Allocators/Memory_arena.hpp>
+#include <Maia/Utilities/Allocators/Memory_resources.hpp>
+
+namespace Maia::Utilities
+{
+	// Arena of the calling thread for temporary data, created by the first call on each thread.
+	// It is reset by the owner of the thread once per frame, so data must not be kept between frames.
+	Memory_arena& get_thread_scratch_arena();
+
+
+	// Frees what was allocated in the arena during the lifetime of the scope.
+	class Scratch_scope
+	{
+	public:
+
+		explicit Scratch_scope(Memory_arena& memory_arena = get_thread_scratch_arena()) noexcept :
+			m_memory_arena{ memory_arena },
+			m_memory_resource{ memory_arena },
+			m_marker{ memory_arena.mark() }
+		{
+		}
+		Scratch_scope(Scratch_scope const&) = delete;
+		Scratch_scope(Scratch_scope&&) = delete;
+
+		~Scratch_scope() noexcept
+		{
+			m_memory_arena.rewind(m_marker);
+		}
+
+		Scratch_scope& operator=(Scratch_scope const&) = delete;
+		Scratch_scope& operator=(Scratch_scope&&) = delete;
+
+
+		Memory_arena& arena() const noexcept
+		{
+			return m_memory_arena;
+		}
+
+		template <class T>
+		Forward_allocator<T> allocator() const noexcept
+		{
+			return Forward_allocator<T>{ m_memory_arena };
+		}
+
+		std::pmr::memory_resource* resource() noexcept
+		{
+			return &m_memory_resource;
+		}
+
+	private:
+
+		Memory_arena& m_memory_arena;
+		Memory_arena_resource m_memory_resource;
+		Memory_arena_marker const m_marker;
+
+	};
+}
+
+#endif
@@ -0,0 +1,399 @@
+#include "Tlsf_allocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Maia::Utilities
+{
+	namespace
+	{
+		constexpr std::uint32_t second_level_count_log2 = 5;
+		constexpr std::uint32_t second_level_count = 1 << second_level_count_log2;
+		constexpr std::uint32_t first_level_count = 64 - second_level_count_log2 + 1;
+
+		std::uint32_t find_first_set(std::uint64_t const value) noexcept
+		{
+			assert(value != 0);
+
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward64(&index, value);
+			return static_cast<std::uint32_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+			return static_cast<std::uint32_t>(__builtin_ctzll(value));
+#else
+			std::uint32_t index = 0;
+			while (((value >> index) & 1) == 0)
+			{
+				++index;
+			}
+			return index;
+#endif
+		}
+
+		std::uint32_t find_last_set(std::uint64_t const value) noexcept
+		{
+			assert(value != 0);
+
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanReverse64(&index, value);
+			return static_cast<std::uint32_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+			return static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+#else
+			std::uint32_t index = 63;
+			while (((value >> index) & 1) == 0)
+			{
+				--index;
+			}
+			return index;
+#endif
+		}
+
+		struct Size_class
+		{
+			std::uint32_t first_level;
+			std::uint32_t second_level;
+		};
+
+		// Sizes below second_level_count have a list each. Larger sizes are split in powers of two, which are
+		// split in second_level_count lists of the same range.
+		Size_class get_size_class(std::uint64_t const size) noexcept
+		{
+			if (size < second_level_count)
+			{
+				return { 0, static_cast<std::uint32_t>(size) };
+			}
+
+			std::uint32_t const last_set = find_last_set(size);
+
+			return
+			{
+				last_set - second_level_count_log2 + 1,
+				static_cast<std::uint32_t>(size >> (last_set - second_level_count_log2)) - second_level_count
+			};
+		}
+
+		std::uint32_t get_list_index(Size_class const size_class) noexcept
+		{
+			return size_class.first_level * second_level_count + size_class.second_level;
+		}
+
+		std::uint64_t align(std::uint64_t const value, std::uint64_t const alignment) noexcept
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	Tlsf_allocator::Tlsf_allocator(std::uint64_t const capacity) :
+		m_capacity{ capacity },
+		m_blocks{},
+		m_unused_block_indices{},
+		m_first_level_bitmap{ 0 },
+		m_second_level_bitmaps(first_level_count, 0),
+		m_free_list_heads(first_level_count * second_level_count, null_index),
+		m_allocated_size{ 0 },
+		m_num_allocations{ 0 },
+		m_num_free_blocks{ 0 }
+	{
+		if (capacity > 0)
+		{
+			insert_free_block(create_block(0, capacity, null_index, null_index));
+		}
+	}
+
+
+	std::optional<Tlsf_allocation> Tlsf_allocator::allocate(std::uint64_t const size, std::uint64_t const alignment)
+	{
+		assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+		std::uint64_t const block_size = std::max(size, std::uint64_t{ 1 });
+
+		if (block_size > m_capacity || alignment - 1 > m_capacity - block_size)
+		{
+			return std::nullopt;
+		}
+
+		// Any block of the list found for the padded size fits the block at any alignment
+		std::optional<std::uint32_t> const free_block_index = find_free_block(block_size + alignment - 1);
+
+		if (!free_block_index)
+		{
+			return std::nullopt;
+		}
+
+		std::uint32_t block_index = *free_block_index;
+		remove_free_block(block_index);
+
+		{
+			std::uint64_t const offset = m_blocks[block_index].offset;
+			std::uint64_t const padding = align(offset, alignment) - offset;
+
+			if (padding > 0)
+			{
+				std::uint32_t const aligned_block_index = split_block(block_index, padding);
+				insert_free_block(block_index);
+				block_index = aligned_block_index;
+			}
+		}
+
+		if (m_blocks[block_index].size > block_size)
+		{
+			insert_free_block(split_block(block_index, block_size));
+		}
+
+		m_allocated_size += block_size;
+		++m_num_allocations;
+
+		return Tlsf_allocation{ m_blocks[block_index].offset, block_size, block_index };
+	}
+
+	void Tlsf_allocator::deallocate(Tlsf_allocation const& allocation)
+	{
+		std::uint32_t block_index = allocation.block_index;
+
+		assert(block_index < m_blocks.size());
+		assert(!m_blocks[block_index].is_free);
+		assert(m_blocks[block_index].offset == allocation.offset);
+
+		m_allocated_size -= m_blocks[block_index].size;
+		--m_num_allocations;
+
+		{
+			std::uint32_t const next_block_index = m_blocks[block_index].next_physical_block;
+
+			if (next_block_index != null_index && m_blocks[next_block_index].is_free)
+			{
+				remove_free_block(next_block_index);
+				merge_next_block(block_index);
+			}
+		}
+
+		{
+			std::uint32_t const previous_block_index = m_blocks[block_index].previous_physical_block;
+
+			if (previous_block_index != null_index && m_blocks[previous_block_index].is_free)
+			{
+				remove_free_block(previous_block_index);
+				merge_next_block(previous_block_index);
+				block_index = previous_block_index;
+			}
+		}
+
+		insert_free_block(block_index);
+	}
+
+
+	std::uint64_t Tlsf_allocator::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	std::uint64_t Tlsf_allocator::allocated_size() const noexcept
+	{
+		return m_allocated_size;
+	}
+
+	Allocator_statistics Tlsf_allocator::statistics() const noexcept
+	{
+		std::uint64_t largest_free_block_size = 0;
+
+		if (m_first_level_bitmap != 0)
+		{
+			std::uint32_t const first_level = find_last_set(m_first_level_bitmap);
+			std::uint32_t const second_level = find_last_set(m_second_level_bitmaps[first_level]);
+
+			for (std::uint32_t block_index = m_free_list_heads[get_list_index({ first_level, second_level })]; block_index != null_index; block_index = m_blocks[block_index].next_free_block)
+			{
+				largest_free_block_size = std::max(largest_free_block_size, m_blocks[block_index].size);
+			}
+		}
+
+		return
+		{
+			m_capacity,
+			m_allocated_size,
+			m_capacity - m_allocated_size,
+			largest_free_block_size,
+			m_num_allocations,
+			m_num_free_blocks
+		};
+	}
+
+
+	std::uint32_t Tlsf_allocator::create_block(std::uint64_t const offset, std::uint64_t const size, std::uint32_t const previous_physical_block, std::uint32_t const next_physical_block)
+	{
+		Block const block{ offset, size, previous_physical_block, next_physical_block, null_index, null_index, false };
+
+		if (!m_unused_block_indices.empty())
+		{
+			std::uint32_t const block_index = m_unused_block_indices.back();
+			m_unused_block_indices.pop_back();
+
+			m_blocks[block_index] = block;
+			return block_index;
+		}
+
+		m_blocks.push_back(block);
+		return static_cast<std::uint32_t>(m_blocks.size() - 1);
+	}
+
+	void Tlsf_allocator::destroy_block(std::uint32_t const block_index)
+	{
+		m_unused_block_indices.push_back(block_index);
+	}
+
+	void Tlsf_allocator::insert_free_block(std::uint32_t const block_index)
+	{
+		Block& block = m_blocks[block_index];
+
+		Size_class const size_class = get_size_class(block.size);
+		std::uint32_t& head = m_free_list_heads[get_list_index(size_class)];
+
+		block.is_free = true;
+		block.previous_free_block = null_index;
+		block.next_free_block = head;
+
+		if (head != null_index)
+		{
+			m_blocks[head].previous_free_block = block_index;
+		}
+
+		head = block_index;
+
+		m_first_level_bitmap |= std::uint64_t{ 1 } << size_class.first_level;
+		m_second_level_bitmaps[size_class.first_level] |= std::uint32_t{ 1 } << size_class.second_level;
+
+		++m_num_free_blocks;
+	}
+
+	void Tlsf_allocator::remove_free_block(std::uint32_t const block_index)
+	{
+		Block& block = m_blocks[block_index];
+		assert(block.is_free);
+
+		if (block.previous_free_block != null_index)
+		{
+			m_blocks[block.previous_free_block].next_free_block = block.next_free_block;
+		}
+
+		if (block.next_free_block != null_index)
+		{
+			m_blocks[block.next_free_block].previous_free_block = block.previous_free_block;
+		}
+
+		Size_class const size_class = get_size_class(block.size);
+		std::uint32_t& head = m_free_list_heads[get_list_index(size_class)];
+
+		if (head == block_index)
+		{
+			head = block.next_free_block;
+
+			if (head == null_index)
+			{
+				std::uint32_t& second_level_bitmap = m_second_level_bitmaps[size_class.first_level];
+				second_level_bitmap &= ~(std::uint32_t{ 1 } << size_class.second_level);
+
+				if (second_level_bitmap == 0)
+				{
+					m_first_level_bitmap &= ~(std::uint64_t{ 1 } << size_class.first_level);
+				}
+			}
+		}
+
+		block.is_free = false;
+		block.previous_free_block = null_index;
+		block.next_free_block = null_index;
+
+		--m_num_free_blocks;
+	}
+
+	std::uint32_t Tlsf_allocator::split_block(std::uint32_t const block_index, std::uint64_t const size)
+	{
+		assert(size < m_blocks[block_index].size);
+
+		std::uint64_t const offset = m_blocks[block_index].offset;
+		std::uint64_t const remaining_size = m_blocks[block_index].size - size;
+		std::uint32_t const next_block_index = m_blocks[block_index].next_physical_block;
+
+		std::uint32_t const remaining_block_index = create_block(offset + size, remaining_size, block_index, next_block_index);
+
+		if (next_block_index != null_index)
+		{
+			m_blocks[next_block_index].previous_physical_block = remaining_block_index;
+		}
+
+		m_blocks[block_index].size = size;
+		m_blocks[block_index].next_physical_block = remaining_block_index;
+
+		return remaining_block_index;
+	}
+
+	void Tlsf_allocator::merge_next_block(std::uint32_t const block_index)
+	{
+		std::uint32_t const next_block_index = m_blocks[block_index].next_physical_block;
+		assert(next_block_index != null_index);
+
+		Block const next_block = m_blocks[next_block_index];
+
+		m_blocks[block_index].size += next_block.size;
+		m_blocks[block_index].next_physical_block = next_block.next_physical_block;
+
+		if (next_block.next_physical_block != null_index)
+		{
+			m_blocks[next_block.next_physical_block].previous_physical_block = block_index;
+		}
+
+		destroy_block(next_block_index);
+	}
+
+	std::optional<std::uint32_t> Tlsf_allocator::find_free_block(std::uint64_t const size) const noexcept
+	{
+		// Round the size up to the next list, so that every block of the found list is large enough
+		std::uint64_t const rounded_size = size < second_level_count ?
+			size :
+			size + (std::uint64_t{ 1 } << (find_last_set(size) - second_level_count_log2)) - 1;
+
+		if (rounded_size >= size)
+		{
+			Size_class size_class = get_size_class(rounded_size);
+
+			std::uint32_t second_level_bitmap = m_second_level_bitmaps[size_class.first_level] & (~std::uint32_t{ 0 } << size_class.second_level);
+
+			if (second_level_bitmap == 0)
+			{
+				std::uint64_t const first_level_bitmap = size_class.first_level + 1 < 64 ?
+					m_first_level_bitmap & (~std::uint64_t{ 0 } << (size_class.first_level + 1)) :
+					0;
+
+				if (first_level_bitmap != 0)
+				{
+					size_class.first_level = find_first_set(first_level_bitmap);
+					second_level_bitmap = m_second_level_bitmaps[size_class.first_level];
+				}
+			}
+
+			if (second_level_bitmap != 0)
+			{
+				size_class.second_level = find_first_set(second_level_bitmap);
+				return m_free_list_heads[get_list_index(size_class)];
+			}
+		}
+
+		// The list of the size itself can still have a large enough block, such as the whole range of a new allocator
+		for (std::uint32_t block_index = m_free_list_heads[get_list_index(get_size_class(size))]; block_index != null_index; block_index = m_blocks[block_index].next_free_block)
+		{
+			if (m_blocks[block_index].size >= size)
+			{
+				return block_index;
+			}
+		}
+
+		return std::nullopt;
+	}
+}
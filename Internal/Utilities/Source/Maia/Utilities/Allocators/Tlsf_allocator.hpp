@@ -0,0 +1,95 @@
+#ifndef MAIA_UTILITIES_TLSFALLOCATOR_H_INCLUDED
+#define MAIA_UTILITIES_TLSFALLOCATOR_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Maia/Utilities/Allocators/Allocator_statistics.hpp>
+
+namespace Maia::Utilities
+{
+	struct Tlsf_allocation
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+		std::uint32_t block_index;
+	};
+
+
+	// Two-level segregated fit allocator of offsets in a range that is owned by the caller.
+	// Free blocks are kept in lists indexed by the power of two of their size and one of 32 subdivisions of it, with
+	// bitmaps of the non empty lists, so that allocate and deallocate are O(1). Only when no larger list has a block,
+	// the list of the requested size is walked. Blocks have the requested size and adjacent free blocks are merged.
+	class Tlsf_allocator
+	{
+	public:
+
+		explicit Tlsf_allocator(std::uint64_t capacity);
+
+
+		// alignment must be a power of two. Returns std::nullopt if there is no free block large enough.
+		std::optional<Tlsf_allocation> allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+		// allocation must have been returned by allocate and not deallocated yet.
+		void deallocate(Tlsf_allocation const& allocation);
+
+
+		std::uint64_t capacity() const noexcept;
+
+		std::uint64_t allocated_size() const noexcept;
+
+		// The largest free block is found by walking the free list of the largest size class.
+		Allocator_statistics statistics() const noexcept;
+
+
+	private:
+
+		static constexpr std::uint32_t null_index = ~std::uint32_t{ 0 };
+
+		struct Block
+		{
+			std::uint64_t offset;
+			std::uint64_t size;
+			std::uint32_t previous_physical_block;
+			std::uint32_t next_physical_block;
+			std::uint32_t previous_free_block;
+			std::uint32_t next_free_block;
+			bool is_free;
+		};
+
+
+		std::uint32_t create_block(std::uint64_t offset, std::uint64_t size, std::uint32_t previous_physical_block, std::uint32_t next_physical_block);
+
+		void destroy_block(std::uint32_t block_index);
+
+		void insert_free_block(std::uint32_t block_index);
+
+		void remove_free_block(std::uint32_t block_index);
+
+		// Splits the first size bytes of the block off, and returns the index of the free block with the rest.
+		std::uint32_t split_block(std::uint32_t block_index, std::uint64_t size);
+
+		// Merges the next physical block, which must be free and out of the free lists, into the block.
+		void merge_next_block(std::uint32_t block_index);
+
+		std::optional<std::uint32_t> find_free_block(std::uint64_t size) const noexcept;
+
+
+		std::uint64_t m_capacity;
+		std::vector<Block> m_blocks;
+		std::vector<std::uint32_t> m_unused_block_indices;
+
+		std::uint64_t m_first_level_bitmap;
+		std::vector<std::uint32_t> m_second_level_bitmaps;
+		std::vector<std::uint32_t> m_free_list_heads;
+
+		std::uint64_t m_allocated_size;
+		std::size_t m_num_allocations;
+		std::size_t m_num_free_blocks;
+
+	};
+}
+
+#endif
@@ -0,0 +1,290 @@
+#include "Virtual_memory_arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Maia::Utilities
+{
+	namespace
+	{
+		std::size_t align(std::size_t const value, std::size_t const alignment) noexcept
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+		// Large enough to hold the header of a deallocated block.
+		std::size_t get_size_class(std::size_t const size_in_bytes) noexcept
+		{
+			return align(std::max(size_in_bytes, sizeof(void*)), alignof(std::max_align_t));
+		}
+
+		struct Page_range
+		{
+			std::byte* first;
+			std::size_t size_in_bytes;
+		};
+
+		// Whole pages of a block that follow its header.
+		Page_range get_inner_pages(std::byte* const block, std::size_t const size_class, std::size_t const page_size) noexcept
+		{
+			std::uintptr_t const first = align(reinterpret_cast<std::uintptr_t>(block) + sizeof(void*), page_size);
+			std::uintptr_t const last = (reinterpret_cast<std::uintptr_t>(block) + size_class) & ~(page_size - 1);
+
+			return { reinterpret_cast<std::byte*>(first), last > first ? last - first : 0 };
+		}
+
+		std::size_t get_page_size() noexcept
+		{
+#if defined(_WIN32)
+			SYSTEM_INFO system_info;
+			GetSystemInfo(&system_info);
+			return static_cast<std::size_t>(system_info.dwPageSize);
+#else
+			return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		}
+
+		void* reserve_memory(std::size_t const size_in_bytes) noexcept
+		{
+#if defined(_WIN32)
+			return VirtualAlloc(nullptr, size_in_bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+			void* const mapping = mmap(nullptr, size_in_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			return mapping != MAP_FAILED ? mapping : nullptr;
+#endif
+		}
+
+		void release_memory(void* const mapping, std::size_t const size_in_bytes) noexcept
+		{
+#if defined(_WIN32)
+			VirtualFree(mapping, 0, MEM_RELEASE);
+#else
+			munmap(mapping, size_in_bytes);
+#endif
+		}
+
+		bool commit_memory(std::byte* const data, std::size_t const size_in_bytes) noexcept
+		{
+#if defined(_WIN32)
+			return VirtualAlloc(data, size_in_bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+			return mprotect(data, size_in_bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+		}
+
+		bool decommit_memory(std::byte* const data, std::size_t const size_in_bytes) noexcept
+		{
+#if defined(_WIN32)
+			return VirtualFree(data, size_in_bytes, MEM_DECOMMIT) != 0;
+#else
+			// The pages stay accessible and read as zeros until they are written again
+			return madvise(data, size_in_bytes, MADV_DONTNEED) == 0;
+#endif
+		}
+
+		void advise_huge_pages(std::byte* const data, std::size_t const size_in_bytes) noexcept
+		{
+#if defined(MADV_HUGEPAGE)
+			// Only a hint, the kernel uses normal pages if transparent huge pages are disabled
+			madvise(data, size_in_bytes, MADV_HUGEPAGE);
+#endif
+		}
+	}
+
+	Virtual_memory_arena::Virtual_memory_arena(std::size_t const reserved_size_in_bytes, bool const use_huge_pages) :
+		m_data{ nullptr },
+		m_reserved_size_in_bytes{ 0 },
+		m_mapped_size_in_bytes{ 0 },
+		m_committed_size_in_bytes{ 0 },
+		m_used_size_in_bytes{ 0 },
+		m_commit_granularity{ use_huge_pages ? huge_page_size_in_bytes : get_page_size() },
+		m_page_size{ get_page_size() },
+		m_mapping{ nullptr },
+		m_free_lists{},
+		m_free_size_in_bytes{ 0 },
+		m_decommitted_size_in_bytes{ 0 }
+	{
+		m_reserved_size_in_bytes = align(reserved_size_in_bytes, m_commit_granularity);
+
+		// Reserve an extra huge page so that the range can start at a huge page boundary
+		m_mapped_size_in_bytes = m_reserved_size_in_bytes + (use_huge_pages ? huge_page_size_in_bytes : 0);
+		m_mapping = reserve_memory(m_mapped_size_in_bytes);
+
+		if (m_mapping == nullptr)
+		{
+			throw std::bad_alloc{};
+		}
+
+		m_data = static_cast<std::byte*>(m_mapping) + (align(reinterpret_cast<std::uintptr_t>(m_mapping), m_commit_granularity) - reinterpret_cast<std::uintptr_t>(m_mapping));
+
+		if (use_huge_pages)
+		{
+			advise_huge_pages(m_data, m_reserved_size_in_bytes);
+		}
+	}
+
+	Virtual_memory_arena::~Virtual_memory_arena() noexcept
+	{
+		release_memory(m_mapping, m_mapped_size_in_bytes);
+	}
+
+
+	void Virtual_memory_arena::reset() noexcept
+	{
+		if (m_decommitted_size_in_bytes > 0)
+		{
+			[[maybe_unused]] bool const committed = commit_memory(m_data, m_committed_size_in_bytes);
+			assert(committed);
+		}
+
+		m_free_lists.clear();
+		m_free_size_in_bytes = 0;
+		m_decommitted_size_in_bytes = 0;
+		m_used_size_in_bytes = 0;
+	}
+
+
+	std::byte* Virtual_memory_arena::data() const noexcept
+	{
+		return m_data;
+	}
+
+	std::size_t Virtual_memory_arena::reserved_size() const noexcept
+	{
+		return m_reserved_size_in_bytes;
+	}
+
+	std::size_t Virtual_memory_arena::committed_size() const noexcept
+	{
+		return m_committed_size_in_bytes;
+	}
+
+	std::size_t Virtual_memory_arena::used_size() const noexcept
+	{
+		return m_used_size_in_bytes;
+	}
+
+	std::size_t Virtual_memory_arena::free_size() const noexcept
+	{
+		return m_free_size_in_bytes;
+	}
+
+	std::size_t Virtual_memory_arena::decommitted_size() const noexcept
+	{
+		return m_decommitted_size_in_bytes;
+	}
+
+	std::size_t Virtual_memory_arena::commit_granularity() const noexcept
+	{
+		return m_commit_granularity;
+	}
+
+
+	void* Virtual_memory_arena::do_allocate(std::size_t const size_in_bytes, std::size_t const alignment_in_bytes)
+	{
+		assert(alignment_in_bytes <= m_commit_granularity);
+
+		std::size_t const size_class = get_size_class(size_in_bytes);
+
+		auto const free_list = std::find_if(m_free_lists.begin(), m_free_lists.end(),
+			[size_class](Free_list const& free_list) -> bool { return free_list.size_class == size_class; });
+
+		if (free_list != m_free_lists.end())
+		{
+			for (Free_block** link = &free_list->first_block; *link != nullptr; link = &(*link)->next)
+			{
+				std::byte* const block = reinterpret_cast<std::byte*>(*link);
+
+				if (reinterpret_cast<std::uintptr_t>(block) % alignment_in_bytes == 0)
+				{
+					Page_range const inner_pages = get_inner_pages(block, size_class, m_page_size);
+
+					if (inner_pages.size_in_bytes > 0 && !commit_memory(inner_pages.first, inner_pages.size_in_bytes))
+					{
+						throw std::bad_alloc{};
+					}
+
+					*link = (*link)->next;
+					m_free_size_in_bytes -= size_class;
+					m_decommitted_size_in_bytes -= inner_pages.size_in_bytes;
+
+					return block;
+				}
+			}
+		}
+
+		std::size_t const offset = align(m_used_size_in_bytes, alignment_in_bytes);
+
+		if (offset > m_reserved_size_in_bytes || size_class > m_reserved_size_in_bytes - offset)
+		{
+			throw std::bad_alloc{};
+		}
+
+		std::size_t const end = offset + size_class;
+
+		if (end > m_committed_size_in_bytes)
+		{
+			std::size_t const committed_size = align(end, m_commit_granularity);
+
+			if (!commit_memory(m_data + m_committed_size_in_bytes, committed_size - m_committed_size_in_bytes))
+			{
+				throw std::bad_alloc{};
+			}
+
+			m_committed_size_in_bytes = committed_size;
+		}
+
+		m_used_size_in_bytes = end;
+
+		return m_data + offset;
+	}
+
+	void Virtual_memory_arena::do_deallocate(void* const data, std::size_t const size_in_bytes, std::size_t)
+	{
+		std::byte* const block = static_cast<std::byte*>(data);
+		assert(block >= m_data && block < m_data + m_used_size_in_bytes);
+
+		std::size_t const size_class = get_size_class(size_in_bytes);
+
+		Page_range const inner_pages = get_inner_pages(block, size_class, m_page_size);
+
+		if (inner_pages.size_in_bytes > 0)
+		{
+			[[maybe_unused]] bool const decommitted = decommit_memory(inner_pages.first, inner_pages.size_in_bytes);
+			assert(decommitted);
+
+			m_decommitted_size_in_bytes += inner_pages.size_in_bytes;
+		}
+
+		auto free_list = std::find_if(m_free_lists.begin(), m_free_lists.end(),
+			[size_class](Free_list const& free_list) -> bool { return free_list.size_class == size_class; });
+
+		if (free_list == m_free_lists.end())
+		{
+			free_list = m_free_lists.insert(m_free_lists.end(), { size_class, nullptr });
+		}
+
+		free_list->first_block = new (block) Free_block{ free_list->first_block };
+		m_free_size_in_bytes += size_class;
+	}
+
+	bool Virtual_memory_arena::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+	{
+		return this == &other;
+	}
+}
@@ -0,0 +1,91 @@
+#ifndef MAIA_UTILITIES_VIRTUALMEMORYARENA_H_INCLUDED
+#define MAIA_UTILITIES_VIRTUALMEMORYARENA_H_INCLUDED
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace Maia::Utilities
+{
+	// Linear allocator over a range of virtual memory that is reserved up front and committed as allocations reach
+	// it, so that everything allocated from it is contiguous.
+	// Deallocated blocks are kept in a free list per size class, rounded up to alignof(std::max_align_t), and reused by
+	// the next allocations of that class. The whole pages inside a deallocated block are decommitted, so that memory
+	// is given back to the system, and committed again when the block is reused. Resetting frees everything.
+	// With use_huge_pages, the range is aligned to huge pages and, on Linux, transparent huge pages are requested for
+	// it, so that sweeping the data needs fewer TLB entries. Elsewhere it only changes the commit granularity.
+	class Virtual_memory_arena final : public std::pmr::memory_resource
+	{
+	public:
+
+		static constexpr std::size_t huge_page_size_in_bytes = 2 * 1024 * 1024;
+
+		// Allocations throw std::bad_alloc past reserved_size_in_bytes, or if the memory cannot be committed.
+		explicit Virtual_memory_arena(std::size_t reserved_size_in_bytes, bool use_huge_pages = true);
+		Virtual_memory_arena(Virtual_memory_arena const&) = delete;
+		Virtual_memory_arena(Virtual_memory_arena&&) = delete;
+		~Virtual_memory_arena() noexcept;
+
+		Virtual_memory_arena& operator=(Virtual_memory_arena const&) = delete;
+		Virtual_memory_arena& operator=(Virtual_memory_arena&&) = delete;
+
+
+		void reset() noexcept;
+
+
+		std::byte* data() const noexcept;
+
+		std::size_t reserved_size() const noexcept;
+
+		std::size_t committed_size() const noexcept;
+
+		std::size_t used_size() const noexcept;
+
+		// Size of the deallocated blocks in the free lists.
+		std::size_t free_size() const noexcept;
+
+		// Size of the pages of the deallocated blocks that were given back to the system.
+		std::size_t decommitted_size() const noexcept;
+
+		// Size in which memory is committed.
+		std::size_t commit_granularity() const noexcept;
+
+
+	private:
+
+		// Header written at the start of a deallocated block, which is never decommitted.
+		struct Free_block
+		{
+			Free_block* next;
+		};
+
+		struct Free_list
+		{
+			std::size_t size_class;
+			Free_block* first_block;
+		};
+
+
+		void* do_allocate(std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		void do_deallocate(void* data, std::size_t size_in_bytes, std::size_t alignment_in_bytes) final;
+
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept final;
+
+
+		std::byte* m_data;
+		std::size_t m_reserved_size_in_bytes;
+		std::size_t m_mapped_size_in_bytes;
+		std::size_t m_committed_size_in_bytes;
+		std::size_t m_used_size_in_bytes;
+		std::size_t m_commit_granularity;
+		std::size_t m_page_size;
+		void* m_mapping;
+		std::vector<Free_list> m_free_lists;
+		std::size_t m_free_size_in_bytes;
+		std::size_t m_decommitted_size_in_bytes;
+
+	};
+}
+
+#endif
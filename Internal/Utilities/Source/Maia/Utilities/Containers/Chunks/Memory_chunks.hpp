@@ -153,7 +153,7 @@ namespace Maia::Utilities
 
 			Memory_chunk_index const element_index = { index.value - chunk_index };
 
-			return chunk.get_component_data<Component>(element_index);
+			return chunk.template get_component_data<Component>(element_index);
 		}
 
 		template <typename Component> // TODO enable_if Component is an element of Components
@@ -164,7 +164,7 @@ namespace Maia::Utilities
 
 			Memory_chunk_index const element_index = { index.value - chunk_index };
 
-			chunk.set_component_data<Component>(element_index, std::forward<Component>(component));
+			chunk.template set_component_data<Component>(element_index, std::forward<Component>(component));
 		}
 
 
@@ -0,0 +1,268 @@
+#ifndef MAIA_UTILITIES_CONCURRENTPOOL_H_INCLUDED
+#define MAIA_UTILITIES_CONCURRENTPOOL_H_INCLUDED
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Maia::Utilities
+{
+	// Fixed-size pool of objects that threads can create and destroy concurrently. The free slots are kept in a
+	// lock-free list whose head is tagged with a counter that changes on every update, so that a thread that was
+	// preempted in the middle of a pop cannot succeed after the same slot was popped and pushed back (ABA).
+	// Each thread should create and destroy through its own Thread_cache, which takes and returns slots in batches so
+	// that most calls do not touch the shared list.
+	template <class T>
+	class Concurrent_pool
+	{
+	public:
+
+		class Thread_cache;
+
+		// The capacity is allocated up front and create returns nullptr once it is exhausted.
+		explicit Concurrent_pool(std::size_t const capacity) :
+			m_slots{ std::make_unique<Slot[]>(capacity) },
+			m_next_indices{ std::make_unique<std::atomic<std::uint32_t>[]>(capacity) },
+			m_capacity{ capacity },
+			m_head{ make_head(capacity > 0 ? 0 : null_index, 0) }
+		{
+			assert(capacity < null_index);
+
+			for (std::size_t index = 0; index < capacity; ++index)
+			{
+				m_next_indices[index].store(index + 1 < capacity ? static_cast<std::uint32_t>(index + 1) : null_index, std::memory_order_relaxed);
+			}
+		}
+		Concurrent_pool(Concurrent_pool const&) = delete;
+		Concurrent_pool(Concurrent_pool&&) = delete;
+		// All objects must have been destroyed.
+		~Concurrent_pool() noexcept = default;
+
+		Concurrent_pool& operator=(Concurrent_pool const&) = delete;
+		Concurrent_pool& operator=(Concurrent_pool&&) = delete;
+
+
+		template <class ...ArgumentsT>
+		T* create(ArgumentsT&&... arguments)
+		{
+			std::uint32_t const index = pop();
+
+			if (index == null_index)
+			{
+				return nullptr;
+			}
+
+			return construct(index, std::forward<ArgumentsT>(arguments)...);
+		}
+
+		void destroy(T* const object) noexcept
+		{
+			std::uint32_t const index = destruct(object);
+			push(index, index);
+		}
+
+
+		std::size_t capacity() const noexcept
+		{
+			return m_capacity;
+		}
+
+	private:
+
+		static constexpr std::uint32_t null_index = std::numeric_limits<std::uint32_t>::max();
+
+		struct Slot
+		{
+			alignas(T) std::byte data[sizeof(T)];
+		};
+
+		// The index of the first free slot is in the low bits and the tag in the high bits.
+		static std::uint64_t make_head(std::uint32_t const index, std::uint64_t const tag) noexcept
+		{
+			return (tag << 32) | index;
+		}
+
+		static std::uint32_t get_index(std::uint64_t const head) noexcept
+		{
+			return static_cast<std::uint32_t>(head);
+		}
+
+		static std::uint64_t get_tag(std::uint64_t const head) noexcept
+		{
+			return head >> 32;
+		}
+
+		// Next indices are kept apart from the slots, so that reading the next index of a slot that another thread
+		// has just popped and is constructing an object in is not a data race. The tag makes the pop fail then.
+		std::uint32_t pop() noexcept
+		{
+			std::uint64_t head = m_head.load(std::memory_order_acquire);
+
+			while (get_index(head) != null_index)
+			{
+				std::uint32_t const next_index = m_next_indices[get_index(head)].load(std::memory_order_relaxed);
+
+				if (m_head.compare_exchange_weak(head, make_head(next_index, get_tag(head) + 1), std::memory_order_acquire, std::memory_order_acquire))
+				{
+					return get_index(head);
+				}
+			}
+
+			return null_index;
+		}
+
+		// Pushes the list of slots from first_index to last_index, which must already be linked.
+		void push(std::uint32_t const first_index, std::uint32_t const last_index) noexcept
+		{
+			std::uint64_t head = m_head.load(std::memory_order_relaxed);
+
+			do
+			{
+				m_next_indices[last_index].store(get_index(head), std::memory_order_relaxed);
+			}
+			while (!m_head.compare_exchange_weak(head, make_head(first_index, get_tag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		template <class ...ArgumentsT>
+		T* construct(std::uint32_t const index, ArgumentsT&&... arguments)
+		{
+			try
+			{
+				return ::new (static_cast<void*>(m_slots[index].data)) T(std::forward<ArgumentsT>(arguments)...);
+			}
+			catch (...)
+			{
+				push(index, index);
+				throw;
+			}
+		}
+
+		std::uint32_t destruct(T* const object) noexcept
+		{
+			std::uint32_t const index = static_cast<std::uint32_t>(reinterpret_cast<Slot*>(object) - m_slots.get());
+			assert(index < m_capacity);
+
+			object->~T();
+
+			return index;
+		}
+
+		void link(std::uint32_t const index, std::uint32_t const next_index) noexcept
+		{
+			m_next_indices[index].store(next_index, std::memory_order_relaxed);
+		}
+
+
+		std::unique_ptr<Slot[]> m_slots;
+		std::unique_ptr<std::atomic<std::uint32_t>[]> m_next_indices;
+		std::size_t m_capacity;
+		alignas(64) std::atomic<std::uint64_t> m_head;
+
+	};
+
+	// Free slots of a Concurrent_pool that only the owning thread uses. It must be destroyed before the pool, and
+	// returns its slots to it then.
+	template <class T>
+	class Concurrent_pool<T>::Thread_cache
+	{
+	public:
+
+		static constexpr std::size_t cache_capacity = 64;
+		static constexpr std::size_t batch_size = cache_capacity / 2;
+
+		explicit Thread_cache(Concurrent_pool& pool) noexcept :
+			m_pool{ pool },
+			m_indices{},
+			m_size{ 0 }
+		{
+		}
+		Thread_cache(Thread_cache const&) = delete;
+		Thread_cache(Thread_cache&&) = delete;
+		~Thread_cache() noexcept
+		{
+			flush(m_size);
+		}
+
+		Thread_cache& operator=(Thread_cache const&) = delete;
+		Thread_cache& operator=(Thread_cache&&) = delete;
+
+
+		// Takes batch_size slots from the pool when the cache is empty.
+		template <class ...ArgumentsT>
+		T* create(ArgumentsT&&... arguments)
+		{
+			if (m_size == 0)
+			{
+				refill();
+
+				if (m_size == 0)
+				{
+					return nullptr;
+				}
+			}
+
+			return m_pool.construct(m_indices[--m_size], std::forward<ArgumentsT>(arguments)...);
+		}
+
+		// Returns batch_size slots to the pool when the cache is full.
+		void destroy(T* const object) noexcept
+		{
+			if (m_size == cache_capacity)
+			{
+				flush(batch_size);
+			}
+
+			m_indices[m_size++] = m_pool.destruct(object);
+		}
+
+	private:
+
+		void refill() noexcept
+		{
+			while (m_size < batch_size)
+			{
+				std::uint32_t const index = m_pool.pop();
+
+				if (index == null_index)
+				{
+					break;
+				}
+
+				m_indices[m_size++] = index;
+			}
+		}
+
+		// Pushes the last count cached slots to the pool at once.
+		void flush(std::size_t const count) noexcept
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			std::size_t const first = m_size - count;
+
+			for (std::size_t index = first; index + 1 < m_size; ++index)
+			{
+				m_pool.link(m_indices[index], m_indices[index + 1]);
+			}
+
+			m_pool.push(m_indices[first], m_indices[m_size - 1]);
+			m_size = first;
+		}
+
+
+		Concurrent_pool& m_pool;
+		std::array<std::uint32_t, cache_capacity> m_indices;
+		std::size_t m_size;
+
+	};
+}
+
+#endif
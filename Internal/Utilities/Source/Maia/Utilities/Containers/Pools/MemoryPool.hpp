@@ -1,187 +1,413 @@
-#include <numeric>
-#include <stdexcept>
+#ifndef MAIA_UTILITIES_MEMORYPOOL_H_INCLUDED
+#define MAIA_UTILITIES_MEMORYPOOL_H_INCLUDED
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Maia::Utilities
 {
-	template <class T>
+	template <class T, std::size_t Page_capacity>
 	class Memory_pool;
 
-	template <class T>
+	namespace Detail
+	{
+		inline std::size_t find_first_set(std::uint64_t const value) noexcept
+		{
+			assert(value != 0);
+
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward64(&index, value);
+			return static_cast<std::size_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+			return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+			std::size_t index = 0;
+			while (((value >> index) & 1) == 0)
+			{
+				++index;
+			}
+			return index;
+#endif
+		}
+	}
+
+	template <class T, std::size_t Page_capacity>
 	class Memory_pool_const_iterator
 	{
 	public:
 
 		// Public member types:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type = std::ptrdiff_t;
 		using value_type = T;
-		using reference = T&;
-		using const_reference = T const&;
-		using pointer = T*;
+		using reference = T const&;
+		using pointer = T const*;
 
 		// Constructors:
-		Memory_pool_const_iterator(pointer element) :
-			m_element(element)
+		Memory_pool_const_iterator(Memory_pool<T, Page_capacity> const& pool, std::size_t const index) noexcept :
+			m_pool(&pool),
+			m_index(index)
 		{
 		}
 
 		// Element access:
-		const_reference operator*() const
+		reference operator*() const noexcept
+		{
+			return m_pool->get_slot(m_index).value;
+		}
+		pointer operator->() const noexcept
 		{
-			return *m_element;
+			return std::addressof(**this);
+		}
+
+		// Increment:
+		Memory_pool_const_iterator& operator++() noexcept
+		{
+			m_index = m_pool->find_next_element(m_index + 1);
+			return *this;
+		}
+		Memory_pool_const_iterator operator++(int) noexcept
+		{
+			Memory_pool_const_iterator const previous = *this;
+			++*this;
+			return previous;
+		}
+
+		// Comparison:
+		bool operator==(Memory_pool_const_iterator const& other) const noexcept
+		{
+			return m_index == other.m_index;
+		}
+		bool operator!=(Memory_pool_const_iterator const& other) const noexcept
+		{
+			return !(*this == other);
 		}
 
 	protected:
 
 		// Friends:
-		friend Memory_pool<value_type>;
+		friend Memory_pool<T, Page_capacity>;
 
 		// Members:
-		pointer m_element;
+		Memory_pool<T, Page_capacity> const* m_pool;
+		std::size_t m_index;
 
 	};
 
-	template <class T>
-	class Memory_pool_iterator : public Memory_pool_const_iterator<T>
+	template <class T, std::size_t Page_capacity>
+	class Memory_pool_iterator : public Memory_pool_const_iterator<T, Page_capacity>
 	{
 	public:
 
-		using pointer = typename Memory_pool_iterator<T>::pointer;
-		using reference = typename Memory_pool_iterator<T>::reference;
+		using reference = T&;
+		using pointer = T*;
 
 		// Constructors:
-		Memory_pool_iterator(pointer element) :
-			Memory_pool_const_iterator<T>(element)
+		Memory_pool_iterator(Memory_pool<T, Page_capacity>& pool, std::size_t const index) noexcept :
+			Memory_pool_const_iterator<T, Page_capacity>(pool, index)
 		{
 		}
 
 		// Element access:
-		reference operator*() const
+		reference operator*() const noexcept
 		{
-			return *Memory_pool_const_iterator<T>::m_element;
+			return const_cast<reference>(Memory_pool_const_iterator<T, Page_capacity>::operator*());
+		}
+		pointer operator->() const noexcept
+		{
+			return std::addressof(**this);
+		}
+
+		// Increment:
+		Memory_pool_iterator& operator++() noexcept
+		{
+			Memory_pool_const_iterator<T, Page_capacity>::operator++();
+			return *this;
+		}
+		Memory_pool_iterator operator++(int) noexcept
+		{
+			Memory_pool_iterator const previous = *this;
+			++*this;
+			return previous;
 		}
 
 	};
 
-	template <class T>
+	// Pool of elements allocated in pages of Page_capacity slots. Pages are never moved or freed before the pool is
+	// cleared, so elements keep their address. Free slots hold the index of the next free slot, which makes an
+	// intrusive free list, and an occupancy bitmap per page is used to iterate over the elements only.
+	template <class T, std::size_t Page_capacity = 64>
 	class Memory_pool
 	{
 	public:
 
+		static_assert(Page_capacity > 0 && Page_capacity % 64 == 0, "Page_capacity must be a multiple of 64");
+
 		// Public member types:
 		using size_type = std::size_t;
 		using value_type = T;
-		using reference = T & ;
-		using const_reference = const T&;
-		using iterator = Memory_pool_iterator<T>;
-		using const_iterator = Memory_pool_const_iterator<T>;
+		using reference = T&;
+		using const_reference = T const&;
+		using iterator = Memory_pool_iterator<T, Page_capacity>;
+		using const_iterator = Memory_pool_const_iterator<T, Page_capacity>;
 
 		// Constructors:
 		Memory_pool() noexcept = default;
-		Memory_pool(const Memory_pool& other) = delete;
-		Memory_pool(Memory_pool&& other) noexcept :
-			m_elements(std::move(other.m_elements)),
-			m_inactive_elements(std::move(other.m_inactive_elements)),
-			m_num_active_elements(other.m_num_active_elements)
+		Memory_pool(Memory_pool const& other) = delete;
+		Memory_pool(Memory_pool&& other) noexcept
 		{
+			swap(other);
 		}
-		Memory_pool(size_type capacity) :
-			m_elements(),
-			m_inactive_elements(),
-			m_num_active_elements(0)
+		explicit Memory_pool(size_type const capacity)
 		{
 			reserve(capacity);
 		}
 
+		// Destructor:
+		~Memory_pool() noexcept
+		{
+			destroy_elements();
+		}
+
 		// Copy/move assignment:
-		Memory_pool& operator=(const Memory_pool& other) = delete;
+		Memory_pool& operator=(Memory_pool const& other) = delete;
 		Memory_pool& operator=(Memory_pool&& other) noexcept
 		{
-			m_elements = std::move(other.m_elements);
-			m_inactive_elements = std::move(other.m_inactive_elements);
-			m_num_active_elements = std::move(other.m_num_active_elements);
+			Memory_pool{ std::move(other) }.swap(*this);
+			return *this;
 		}
 
 		// Iterators:
-		iterator begin()
+		iterator begin() noexcept
 		{
-			return iterator(m_elements.data());
+			return { *this, find_next_element(0) };
 		}
-		iterator end()
+		const_iterator begin() const noexcept
 		{
-			return iterator(m_elements.data() + size());
+			return { *this, find_next_element(0) };
+		}
+		iterator end() noexcept
+		{
+			return { *this, capacity() };
+		}
+		const_iterator end() const noexcept
+		{
+			return { *this, capacity() };
 		}
 
-		// capacity:
+		// Capacity:
 		bool empty() const noexcept
 		{
 			return size() == 0;
 		}
 		size_type size() const noexcept
 		{
-			return m_num_active_elements;
+			return m_size;
 		}
 		size_type max_size() const noexcept
 		{
-			return m_elements.max_size();
+			return std::numeric_limits<size_type>::max() - Page_capacity;
 		}
-		void reserve(size_type capacity)
+		// Adds pages until there are at least capacity slots. The elements are kept where they are.
+		void reserve(size_type const capacity)
 		{
-			m_elements.reserve(capacity);
-
-			m_inactive_elements.resize(capacity);
-			std::iota(m_inactive_elements.begin(), m_inactive_elements.end(), 0);
+			while (this->capacity() < capacity)
+			{
+				add_page();
+			}
 		}
 		size_type capacity() const noexcept
 		{
-			return m_elements.capacity();
+			return m_pages.size() * Page_capacity;
+		}
+		size_type num_pages() const noexcept
+		{
+			return m_pages.size();
 		}
 
 		// Modifiers:
+		// Destroys all elements but keeps the pages.
 		void clear() noexcept
 		{
-			m_elements.clear();
-			m_inactive_elements.clear();
-			m_num_active_elements = 0;
+			destroy_elements();
+
+			m_free_index = null_index;
+
+			for (size_type page_index = m_pages.size(); page_index > 0; --page_index)
+			{
+				link_free_slots(page_index - 1);
+			}
 		}
+		// Constructs an element in a free slot, adding a page if there is none.
 		template <class ...ArgumentsT>
 		iterator emplace(ArgumentsT&&... arguments)
 		{
-			if (m_inactive_elements.empty())
+			if (m_free_index == null_index)
 			{
-				throw std::out_of_range("Memory pool is full! Use the reserve method to reserve a block of memory!");
+				add_page();
 			}
 
-			auto index = m_inactive_elements.back();
-			m_inactive_elements.pop_back();
-			++m_num_active_elements;
+			size_type const index = m_free_index;
+			Page& page = get_page(index);
+			Slot& slot = page.slots[index % Page_capacity];
+			m_free_index = slot.next_free_index;
 
-			m_elements[index] = value_type(std::forward<ArgumentsT>(arguments)...);
+			try
+			{
+				::new (static_cast<void*>(std::addressof(slot.value))) T(std::forward<ArgumentsT>(arguments)...);
+			}
+			catch (...)
+			{
+				slot.next_free_index = m_free_index;
+				m_free_index = index;
+				throw;
+			}
+
+			page.occupancy[(index % Page_capacity) / 64] |= std::uint64_t{ 1 } << (index % 64);
+			++m_size;
 
-			return iterator(m_elements.data() + index);
+			return { *this, index };
 		}
-		void erase(const_iterator position)
+		void erase(const_iterator const position) noexcept
 		{
-			--m_num_active_elements;
-			m_inactive_elements.emplace_back(position.m_element - m_elements.data());
+			assert(position.m_pool == this && position.m_index < capacity());
+
+			size_type const index = position.m_index;
+			Page& page = get_page(index);
+			Slot& slot = page.slots[index % Page_capacity];
 
+			assert((page.occupancy[(index % Page_capacity) / 64] & (std::uint64_t{ 1 } << (index % 64))) != 0);
+
+			slot.value.~T();
+			slot.next_free_index = m_free_index;
+			m_free_index = index;
+
+			page.occupancy[(index % Page_capacity) / 64] &= ~(std::uint64_t{ 1 } << (index % 64));
+			--m_size;
 		}
-		void swap(Memory_pool<value_type>& other) noexcept
+		void swap(Memory_pool& other) noexcept
 		{
-			std::swap(m_elements, other.m_elements);
-			std::swap(m_inactive_elements, other.m_inactive_elements);
-			std::swap(m_num_active_elements, other.m_num_active_elements);
+			std::swap(m_pages, other.m_pages);
+			std::swap(m_free_index, other.m_free_index);
+			std::swap(m_size, other.m_size);
 		}
 
 	private:
 
 		// Friends:
-		friend class const_iterator;
-		friend class iterator;
+		friend const_iterator;
+
+		// Member types:
+		static constexpr size_type null_index = std::numeric_limits<size_type>::max();
+
+		union Slot
+		{
+			Slot() noexcept :
+				next_free_index(null_index)
+			{
+			}
+			~Slot() noexcept
+			{
+			}
+
+			size_type next_free_index;
+			T value;
+		};
+
+		struct Page
+		{
+			std::array<Slot, Page_capacity> slots;
+			std::array<std::uint64_t, Page_capacity / 64> occupancy{};
+		};
+
+		// Member functions:
+		Page& get_page(size_type const index) noexcept
+		{
+			return *m_pages[index / Page_capacity];
+		}
+		Slot const& get_slot(size_type const index) const noexcept
+		{
+			return m_pages[index / Page_capacity]->slots[index % Page_capacity];
+		}
+
+		// Returns the index of the first element at or after index, or capacity() if there is none.
+		size_type find_next_element(size_type index) const noexcept
+		{
+			size_type const end_index = capacity();
+
+			while (index < end_index)
+			{
+				Page const& page = *m_pages[index / Page_capacity];
+				std::uint64_t const word = page.occupancy[(index % Page_capacity) / 64] >> (index % 64);
+
+				if (word != 0)
+				{
+					return index + Detail::find_first_set(word);
+				}
+
+				index = (index / 64 + 1) * 64;
+			}
+
+			return end_index;
+		}
+
+		void add_page()
+		{
+			m_pages.push_back(std::make_unique<Page>());
+			link_free_slots(m_pages.size() - 1);
+		}
+
+		// Pushes all the slots of the page to the front of the free list, so that they are used in order.
+		void link_free_slots(size_type const page_index) noexcept
+		{
+			Page& page = *m_pages[page_index];
+
+			for (size_type slot_index = Page_capacity; slot_index > 0; --slot_index)
+			{
+				page.slots[slot_index - 1].next_free_index = m_free_index;
+				m_free_index = page_index * Page_capacity + slot_index - 1;
+			}
+		}
+
+		void destroy_elements() noexcept
+		{
+			for (size_type page_index = 0; page_index < m_pages.size(); ++page_index)
+			{
+				Page& page = *m_pages[page_index];
+
+				for (size_type word_index = 0; word_index < page.occupancy.size(); ++word_index)
+				{
+					for (std::uint64_t word = page.occupancy[word_index]; word != 0; word &= word - 1)
+					{
+						page.slots[word_index * 64 + Detail::find_first_set(word)].value.~T();
+					}
+
+					page.occupancy[word_index] = 0;
+				}
+			}
+
+			m_size = 0;
+		}
 
 		// Members:
-		std::vector<value_type> m_elements;
-		std::vector<size_type> m_inactive_elements;
-		std::size_t m_num_active_elements = 0;
+		std::vector<std::unique_ptr<Page>> m_pages;
+		size_type m_free_index = null_index;
+		size_type m_size = 0;
 
 	};
 }
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef MAIA_UTILITIES_SLOTMAP_H_INCLUDED
+#define MAIA_UTILITIES_SLOTMAP_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Maia::Utilities
+{
+	// Identifies an element of a Slot_map<T>. The generation tells apart the elements that used the same slot, so a
+	// handle to an erased element stays invalid after its slot is reused.
+	template <class T>
+	struct Slot_map_handle
+	{
+		std::uint32_t index{ std::numeric_limits<std::uint32_t>::max() };
+		std::uint32_t generation{ 0 };
+	};
+
+	template <class T>
+	bool operator==(Slot_map_handle<T> const lhs, Slot_map_handle<T> const rhs) noexcept
+	{
+		return lhs.index == rhs.index && lhs.generation == rhs.generation;
+	}
+
+	template <class T>
+	bool operator!=(Slot_map_handle<T> const lhs, Slot_map_handle<T> const rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	// Keeps its elements packed in a vector, so that iterating over them is as fast as iterating over a vector, and
+	// finds them in O(1) through handles that stay valid while the elements are moved around.
+	// Erasing moves the last element into the hole, so it changes the order of the elements and invalidates pointers
+	// and iterators to them, but not handles.
+	template <class T>
+	class Slot_map
+	{
+	public:
+
+		// Public member types:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = T&;
+		using const_reference = T const&;
+		using handle = Slot_map_handle<T>;
+		using iterator = typename std::vector<T>::iterator;
+		using const_iterator = typename std::vector<T>::const_iterator;
+
+		// Element access:
+		T* get(handle const element) noexcept
+		{
+			return contains(element) ? &m_values[m_slots[element.index].dense_index] : nullptr;
+		}
+		T const* get(handle const element) const noexcept
+		{
+			return contains(element) ? &m_values[m_slots[element.index].dense_index] : nullptr;
+		}
+		reference at(handle const element)
+		{
+			T* const value = get(element);
+
+			if (value == nullptr)
+			{
+				throw std::out_of_range{ "Slot map handle does not refer to an element" };
+			}
+
+			return *value;
+		}
+		const_reference at(handle const element) const
+		{
+			return const_cast<Slot_map&>(*this).at(element);
+		}
+		reference operator[](handle const element) noexcept
+		{
+			assert(contains(element));
+			return m_values[m_slots[element.index].dense_index];
+		}
+		const_reference operator[](handle const element) const noexcept
+		{
+			assert(contains(element));
+			return m_values[m_slots[element.index].dense_index];
+		}
+		T* data() noexcept
+		{
+			return m_values.data();
+		}
+		T const* data() const noexcept
+		{
+			return m_values.data();
+		}
+
+		// Lookup:
+		bool contains(handle const element) const noexcept
+		{
+			return element.index < m_slots.size() && m_slots[element.index].generation == element.generation && is_used(m_slots[element.index]);
+		}
+		// Returns the handle of the element at position in the dense storage.
+		handle get_handle(size_type const position) const noexcept
+		{
+			assert(position < size());
+
+			std::uint32_t const index = m_dense_to_slot[position];
+			return { index, m_slots[index].generation };
+		}
+		handle get_handle(const_iterator const position) const noexcept
+		{
+			return get_handle(static_cast<size_type>(position - m_values.begin()));
+		}
+
+		// Iterators:
+		iterator begin() noexcept
+		{
+			return m_values.begin();
+		}
+		const_iterator begin() const noexcept
+		{
+			return m_values.begin();
+		}
+		iterator end() noexcept
+		{
+			return m_values.end();
+		}
+		const_iterator end() const noexcept
+		{
+			return m_values.end();
+		}
+
+		// Capacity:
+		bool empty() const noexcept
+		{
+			return m_values.empty();
+		}
+		size_type size() const noexcept
+		{
+			return m_values.size();
+		}
+		size_type max_size() const noexcept
+		{
+			return null_index;
+		}
+		void reserve(size_type const capacity)
+		{
+			m_values.reserve(capacity);
+			m_dense_to_slot.reserve(capacity);
+			m_slots.reserve(capacity);
+		}
+		size_type capacity() const noexcept
+		{
+			return m_values.capacity();
+		}
+
+		// Modifiers:
+		// Erases all elements. Their handles become invalid.
+		void clear() noexcept
+		{
+			for (std::uint32_t const index : m_dense_to_slot)
+			{
+				free_slot(index);
+			}
+
+			m_values.clear();
+			m_dense_to_slot.clear();
+		}
+		handle insert(T const& value)
+		{
+			return emplace(value);
+		}
+		handle insert(T&& value)
+		{
+			return emplace(std::move(value));
+		}
+		template <class ...ArgumentsT>
+		handle emplace(ArgumentsT&&... arguments)
+		{
+			if (size() == max_size())
+			{
+				throw std::length_error{ "Slot map is full" };
+			}
+
+			if (m_free_index == null_index)
+			{
+				m_slots.push_back({ null_index, 0 });
+				m_free_index = static_cast<std::uint32_t>(m_slots.size() - 1);
+			}
+
+			m_dense_to_slot.reserve(m_dense_to_slot.size() + 1);
+			m_values.emplace_back(std::forward<ArgumentsT>(arguments)...);
+
+			std::uint32_t const index = m_free_index;
+			Slot& slot = m_slots[index];
+			m_free_index = slot.dense_index;
+
+			++slot.generation;
+			slot.dense_index = static_cast<std::uint32_t>(m_values.size() - 1);
+			m_dense_to_slot.push_back(index);
+
+			return { index, slot.generation };
+		}
+		// Moves the last element into the place of the erased one. Returns false if the handle is invalid.
+		bool erase(handle const element)
+		{
+			if (!contains(element))
+			{
+				return false;
+			}
+
+			std::uint32_t const dense_index = m_slots[element.index].dense_index;
+			std::uint32_t const last_dense_index = static_cast<std::uint32_t>(m_values.size() - 1);
+
+			if (dense_index != last_dense_index)
+			{
+				m_values[dense_index] = std::move(m_values[last_dense_index]);
+				m_dense_to_slot[dense_index] = m_dense_to_slot[last_dense_index];
+				m_slots[m_dense_to_slot[dense_index]].dense_index = dense_index;
+			}
+
+			m_values.pop_back();
+			m_dense_to_slot.pop_back();
+			free_slot(element.index);
+
+			return true;
+		}
+		void swap(Slot_map& other) noexcept
+		{
+			std::swap(m_values, other.m_values);
+			std::swap(m_dense_to_slot, other.m_dense_to_slot);
+			std::swap(m_slots, other.m_slots);
+			std::swap(m_free_index, other.m_free_index);
+		}
+
+	private:
+
+		static constexpr std::uint32_t null_index = std::numeric_limits<std::uint32_t>::max();
+
+		// The generation is odd while the slot is used. dense_index is the index of the next free slot otherwise.
+		struct Slot
+		{
+			std::uint32_t dense_index;
+			std::uint32_t generation;
+		};
+
+		static bool is_used(Slot const slot) noexcept
+		{
+			return (slot.generation & 1) != 0;
+		}
+
+		void free_slot(std::uint32_t const index) noexcept
+		{
+			Slot& slot = m_slots[index];
+			++slot.generation;
+			slot.dense_index = m_free_index;
+			m_free_index = index;
+		}
+
+		// Members:
+		std::vector<T> m_values;
+		std::vector<std::uint32_t> m_dense_to_slot;
+		std::vector<Slot> m_slots;
+		std::uint32_t m_free_index = null_index;
+
+	};
+}
+
+#endif
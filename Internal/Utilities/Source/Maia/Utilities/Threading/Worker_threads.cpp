@@ -0,0 +1,125 @@
+#include "Worker_threads.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Maia::Utilities
+{
+	Worker_threads::Worker_threads(std::size_t const num_threads) :
+		m_mutex{},
+		m_tasks_started{},
+		m_tasks_finished{},
+		m_task_function{ nullptr },
+		m_context{ nullptr },
+		m_num_tasks{ 0 },
+		m_num_pending_tasks{ 0 },
+		m_run_index{ 0 },
+		m_stop{ false },
+		m_threads{}
+	{
+		std::size_t const num_workers = std::max(num_threads, std::size_t{ 1 }) - 1;
+		m_threads.reserve(num_workers);
+
+		for (std::size_t task_index = 1; task_index <= num_workers; ++task_index)
+		{
+			m_threads.emplace_back(&Worker_threads::work, this, task_index);
+		}
+	}
+
+	Worker_threads::~Worker_threads() noexcept
+	{
+		{
+			std::lock_guard<std::mutex> const lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_tasks_started.notify_all();
+
+		for (std::thread& thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+
+
+	std::size_t Worker_threads::num_threads() const noexcept
+	{
+		return m_threads.size() + 1;
+	}
+
+	void Worker_threads::run(std::size_t const num_tasks, Task_function const task_function, void const* const context)
+	{
+		assert(num_tasks <= num_threads());
+
+		if (num_tasks == 0)
+		{
+			return;
+		}
+
+		if (num_tasks > 1)
+		{
+			{
+				std::lock_guard<std::mutex> const lock{ m_mutex };
+				m_task_function = task_function;
+				m_context = context;
+				m_num_tasks = num_tasks;
+				m_num_pending_tasks = num_tasks - 1;
+				++m_run_index;
+			}
+
+			m_tasks_started.notify_all();
+		}
+
+		task_function(context, 0);
+
+		if (num_tasks > 1)
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_tasks_finished.wait(lock, [this] { return m_num_pending_tasks == 0; });
+		}
+	}
+
+	void Worker_threads::work(std::size_t const task_index)
+	{
+		std::size_t last_run_index = 0;
+
+		while (true)
+		{
+			Task_function task_function;
+			void const* context;
+
+			{
+				std::unique_lock<std::mutex> lock{ m_mutex };
+				m_tasks_started.wait(lock, [this, last_run_index] { return m_stop || m_run_index != last_run_index; });
+
+				if (m_stop)
+				{
+					return;
+				}
+
+				last_run_index = m_run_index;
+
+				if (task_index >= m_num_tasks)
+				{
+					continue;
+				}
+
+				task_function = m_task_function;
+				context = m_context;
+			}
+
+			task_function(context, task_index);
+
+			bool is_last_task;
+			{
+				std::lock_guard<std::mutex> const lock{ m_mutex };
+				is_last_task = --m_num_pending_tasks == 0;
+			}
+
+			if (is_last_task)
+			{
+				m_tasks_finished.notify_one();
+			}
+		}
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef MAIA_UTILITIES_WORKERTHREADS_H_INCLUDED
+#define MAIA_UTILITIES_WORKERTHREADS_H_INCLUDED
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Maia::Utilities
+{
+	// Threads that are started once and then run the tasks of parallel loops, so that a loop that runs every frame
+	// does not start threads or allocate. num_threads includes the calling thread, so num_threads - 1 threads are started.
+	class Worker_threads
+	{
+	public:
+
+		explicit Worker_threads(std::size_t num_threads);
+		Worker_threads(Worker_threads const&) = delete;
+		Worker_threads(Worker_threads&&) = delete;
+
+		~Worker_threads() noexcept;
+
+		Worker_threads& operator=(Worker_threads const&) = delete;
+		Worker_threads& operator=(Worker_threads&&) = delete;
+
+
+		std::size_t num_threads() const noexcept;
+
+		// Calls function(task_index) for every task_index in [0, num_tasks) and waits for all of them. Task 0 runs on the
+		// calling thread and task i on worker i. num_tasks must not exceed num_threads and tasks must not throw.
+		template <typename Function>
+		void run(std::size_t const num_tasks, Function const& function)
+		{
+			run(
+				num_tasks,
+				[](void const* const context, std::size_t const task_index) -> void
+				{
+					(*static_cast<Function const*>(context))(task_index);
+				},
+				&function
+			);
+		}
+
+	private:
+
+		using Task_function = void(*)(void const* context, std::size_t task_index);
+
+
+		void run(std::size_t num_tasks, Task_function task_function, void const* context);
+
+		void work(std::size_t task_index);
+
+
+		std::mutex m_mutex;
+		std::condition_variable m_tasks_started;
+		std::condition_variable m_tasks_finished;
+		Task_function m_task_function;
+		void const* m_context;
+		std::size_t m_num_tasks;
+		std::size_t m_num_pending_tasks;
+		std::size_t m_run_index;
+		bool m_stop;
+		std::vector<std::thread> m_threads;
+
+	};
+}
+
+#endif
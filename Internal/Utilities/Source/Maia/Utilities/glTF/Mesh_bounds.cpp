@@ -0,0 +1,215 @@
+#include "Mesh_bounds.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAIA_UTILITIES_GLTF_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Maia::Utilities::glTF
+{
+	bool operator==(Bounds const& lhs, Bounds const& rhs)
+	{
+		return lhs.minimum == rhs.minimum && lhs.maximum == rhs.maximum;
+	}
+	bool operator!=(Bounds const& lhs, Bounds const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	Bounds merge(Bounds const& lhs, Bounds const& rhs)
+	{
+		return { lhs.minimum.cwiseMin(rhs.minimum), lhs.maximum.cwiseMax(rhs.maximum) };
+	}
+
+
+	std::optional<Bounds> get_accessor_bounds(Accessor const& accessor)
+	{
+		if (accessor.min && accessor.max)
+		{
+			return Bounds{ *accessor.min, *accessor.max };
+		}
+		else
+		{
+			return {};
+		}
+	}
+
+	Bounds calculate_positions_bounds(
+		gsl::span<std::byte const> const data,
+		std::size_t const count,
+		std::size_t const byte_stride
+	)
+	{
+		if (count == 0)
+		{
+			return {};
+		}
+
+		std::size_t const data_size = static_cast<std::size_t>(data.size());
+		assert((count - 1) * byte_stride + 3 * sizeof(float) <= data_size);
+
+#if defined(MAIA_UTILITIES_GLTF_SSE)
+		__m128 minimum = _mm_set1_ps(std::numeric_limits<float>::max());
+		__m128 maximum = _mm_set1_ps(std::numeric_limits<float>::lowest());
+
+		std::size_t index = 0;
+
+		// Loads 4 floats at once while the 4th one is still inside data, it is ignored when storing the result
+		for (std::size_t offset = 0; index < count && offset + 4 * sizeof(float) <= data_size; ++index, offset += byte_stride)
+		{
+			__m128 const position = _mm_loadu_ps(reinterpret_cast<float const*>(data.data() + offset));
+
+			minimum = _mm_min_ps(minimum, position);
+			maximum = _mm_max_ps(maximum, position);
+		}
+
+		for (; index < count; ++index)
+		{
+			float values[3];
+			std::memcpy(values, data.data() + index * byte_stride, sizeof(values));
+
+			__m128 const position = _mm_setr_ps(values[0], values[1], values[2], 0.0f);
+
+			minimum = _mm_min_ps(minimum, position);
+			maximum = _mm_max_ps(maximum, position);
+		}
+
+		float minimum_values[4];
+		_mm_storeu_ps(minimum_values, minimum);
+
+		float maximum_values[4];
+		_mm_storeu_ps(maximum_values, maximum);
+
+		return
+		{
+			{ minimum_values[0], minimum_values[1], minimum_values[2] },
+			{ maximum_values[0], maximum_values[1], maximum_values[2] }
+		};
+#else
+		Eigen::Vector3f minimum{ Eigen::Vector3f::Constant(std::numeric_limits<float>::max()) };
+		Eigen::Vector3f maximum{ Eigen::Vector3f::Constant(std::numeric_limits<float>::lowest()) };
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			Eigen::Vector3f position;
+			std::memcpy(position.data(), data.data() + index * byte_stride, 3 * sizeof(float));
+
+			minimum = minimum.cwiseMin(position);
+			maximum = maximum.cwiseMax(position);
+		}
+
+		return { minimum, maximum };
+#endif
+	}
+
+	namespace
+	{
+		std::optional<std::size_t> find_position_accessor_index(Primitive const& primitive)
+		{
+			auto const location = primitive.attributes.find("POSITION");
+
+			if (location != primitive.attributes.end())
+			{
+				return location->second;
+			}
+			else
+			{
+				return {};
+			}
+		}
+
+		std::optional<Bounds> scan_accessor_bounds(
+			Gltf const& gltf,
+			Accessor const& accessor,
+			gsl::span<std::vector<std::byte> const> const buffers_data
+		)
+		{
+			if (!accessor.buffer_view_index || !gltf.buffer_views || accessor.component_type != Component_type::Float)
+			{
+				return {};
+			}
+
+			Buffer_view const& buffer_view = gltf.buffer_views->at(*accessor.buffer_view_index);
+
+			if (static_cast<std::size_t>(buffers_data.size()) <= buffer_view.buffer_index)
+			{
+				return {};
+			}
+
+			std::vector<std::byte> const& buffer_data = buffers_data[buffer_view.buffer_index];
+
+			std::size_t const first_byte = buffer_view.byte_offset + accessor.byte_offset;
+			std::size_t const last_byte = std::min(buffer_view.byte_offset + buffer_view.byte_length, buffer_data.size());
+			assert(first_byte <= last_byte);
+
+			gsl::span<std::byte const> const data{ buffer_data.data() + first_byte, static_cast<std::ptrdiff_t>(last_byte - first_byte) };
+
+			return calculate_positions_bounds(
+				data,
+				accessor.count,
+				buffer_view.byte_stride ? *buffer_view.byte_stride : 3 * sizeof(float)
+			);
+		}
+	}
+
+	std::optional<Bounds> calculate_mesh_bounds(
+		Gltf const& gltf,
+		Mesh const& mesh,
+		gsl::span<std::vector<std::byte> const> const buffers_data
+	)
+	{
+		std::optional<Bounds> mesh_bounds;
+
+		if (!gltf.accessors)
+		{
+			return mesh_bounds;
+		}
+
+		for (Primitive const& primitive : mesh.primitives)
+		{
+			if (std::optional<std::size_t> const accessor_index = find_position_accessor_index(primitive))
+			{
+				Accessor const& accessor = gltf.accessors->at(*accessor_index);
+
+				std::optional<Bounds> const primitive_bounds = [&]() -> std::optional<Bounds>
+				{
+					if (std::optional<Bounds> const accessor_bounds = get_accessor_bounds(accessor))
+					{
+						return accessor_bounds;
+					}
+					else
+					{
+						return scan_accessor_bounds(gltf, accessor, buffers_data);
+					}
+				}();
+
+				if (primitive_bounds)
+				{
+					mesh_bounds = mesh_bounds ? merge(*mesh_bounds, *primitive_bounds) : *primitive_bounds;
+				}
+			}
+		}
+
+		return mesh_bounds;
+	}
+
+	bool requires_buffers_data(Gltf const& gltf, Mesh const& mesh)
+	{
+		if (!gltf.accessors)
+		{
+			return false;
+		}
+
+		return std::any_of(mesh.primitives.begin(), mesh.primitives.end(), [&gltf](Primitive const& primitive) -> bool
+		{
+			std::optional<std::size_t> const accessor_index = find_position_accessor_index(primitive);
+
+			return accessor_index && !get_accessor_bounds(gltf.accessors->at(*accessor_index));
+		});
+	}
+}
@@ -0,0 +1,51 @@
+#ifndef MAIA_UTILITIES_GLTF_MESHBOUNDS_H_INCLUDED
+#define MAIA_UTILITIES_GLTF_MESHBOUNDS_H_INCLUDED
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/Utilities/glTF/gltf.hpp>
+
+namespace Maia::Utilities::glTF
+{
+	struct Bounds
+	{
+		Eigen::Vector3f minimum{ 0.0f, 0.0f, 0.0f };
+		Eigen::Vector3f maximum{ 0.0f, 0.0f, 0.0f };
+	};
+
+	bool operator==(Bounds const& lhs, Bounds const& rhs);
+	bool operator!=(Bounds const& lhs, Bounds const& rhs);
+
+	Bounds merge(Bounds const& lhs, Bounds const& rhs);
+
+
+	// Returns the bounds stored in the min and max properties of the accessor, if both are present.
+	std::optional<Bounds> get_accessor_bounds(Accessor const& accessor);
+
+	// Scans count float3 positions that are byte_stride bytes apart.
+	// data.size() must be at least (count - 1) * byte_stride + 3 * sizeof(float).
+	Bounds calculate_positions_bounds(
+		gsl::span<std::byte const> data,
+		std::size_t count,
+		std::size_t byte_stride
+	);
+
+	// Merges the bounds of the POSITION attribute of every primitive of mesh.
+	// Uses the accessor min and max when available and otherwise scans the positions in buffers_data, which is indexed like gltf.buffers.
+	// Returns an empty optional if no primitive has positions.
+	std::optional<Bounds> calculate_mesh_bounds(
+		Gltf const& gltf,
+		Mesh const& mesh,
+		gsl::span<std::vector<std::byte> const> buffers_data
+	);
+
+	// Returns true if some POSITION accessor of mesh has no min or max, in which case calculate_mesh_bounds needs the buffers data.
+	bool requires_buffers_data(Gltf const& gltf, Mesh const& mesh);
+}
+
+#endif
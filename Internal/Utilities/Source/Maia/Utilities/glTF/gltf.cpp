@@ -174,6 +174,7 @@ namespace Maia::Utilities::glTF
 	void from_json(nlohmann::json const& json, Accessor& value)
 	{
 		get_to_if_exists(json, "bufferView", value.buffer_view_index);
+		replace_default_if_exists(json, "byteOffset", value.byte_offset);
 		json.at("componentType").get_to(value.component_type);
 		json.at("count").get_to(value.count);
 		json.at("type").get_to(value.type);
@@ -212,6 +213,7 @@ namespace Maia::Utilities::glTF
 		json.at("buffer").get_to(value.buffer_index);
 		replace_default_if_exists(json, "byteOffset", value.byte_offset);
 		json.at("byteLength").get_to(value.byte_length);
+		get_to_if_exists(json, "byteStride", value.byte_stride);
 	}
 
 
@@ -40,6 +40,7 @@ namespace Maia::Utilities::glTF
 		};
 
 		std::optional<std::size_t> buffer_view_index;
+		std::size_t byte_offset{ 0 };
 		Component_type component_type;
 		std::size_t count;
 		Type type;
@@ -67,6 +68,7 @@ namespace Maia::Utilities::glTF
 		std::size_t buffer_index;
 		std::size_t byte_offset{ 0 };
 		std::size_t byte_length;
+		std::optional<std::size_t> byte_stride;
 	};
 
 	void from_json(nlohmann::json const& json, Buffer_view& value);
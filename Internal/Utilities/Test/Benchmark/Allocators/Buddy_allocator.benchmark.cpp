@@ -0,0 +1,67 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
+
+namespace Maia::Utilities::Benchmark
+{
+	void buddy_allocator_allocate_deallocate(benchmark::State& state)
+	{
+		std::uint64_t const capacity = static_cast<std::uint64_t>(state.range(0));
+		std::uint64_t const minimum_block_size = static_cast<std::uint64_t>(state.range(1));
+
+		Buddy_allocator allocator{ capacity, minimum_block_size };
+
+		for (auto _ : state)
+		{
+			std::optional<Buddy_allocation> const allocation = allocator.allocate(minimum_block_size);
+			benchmark::DoNotOptimize(allocation);
+
+			allocator.deallocate(allocation->offset);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(buddy_allocator_allocate_deallocate)
+		->Args({ 64 * 1024 * 1024, 256 })
+		->Args({ 1024 * 1024 * 1024, 256 });
+
+	// Keeps the allocator half full with geometry sized blocks, replacing a random block every iteration
+	void buddy_allocator_churn(benchmark::State& state)
+	{
+		std::uint64_t const capacity = static_cast<std::uint64_t>(state.range(0));
+		std::uint64_t const minimum_block_size = static_cast<std::uint64_t>(state.range(1));
+
+		Buddy_allocator allocator{ capacity, minimum_block_size };
+
+		std::mt19937 random_engine{ 0 };
+		std::uniform_int_distribution<std::uint64_t> size_distribution{ 1, 64 * 1024 };
+
+		std::vector<Buddy_allocation> allocations;
+
+		while (allocator.allocated_size() < capacity / 2)
+		{
+			allocations.push_back(*allocator.allocate(size_distribution(random_engine)));
+		}
+
+		std::uniform_int_distribution<std::size_t> index_distribution{ 0, allocations.size() - 1 };
+
+		for (auto _ : state)
+		{
+			Buddy_allocation& allocation = allocations[index_distribution(random_engine)];
+			allocator.deallocate(allocation.offset);
+
+			std::optional<Buddy_allocation> const new_allocation = allocator.allocate(size_distribution(random_engine));
+			benchmark::DoNotOptimize(new_allocation);
+
+			allocation = new_allocation ? *new_allocation : *allocator.allocate(minimum_block_size);
+		}
+
+		state.SetItemsProcessed(state.iterations() * 2);
+		state.counters["external_fragmentation"] = calculate_external_fragmentation(allocator.statistics());
+	}
+	BENCHMARK(buddy_allocator_churn)
+		->Args({ 64 * 1024 * 1024, 256 });
+}
@@ -0,0 +1,96 @@
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
+#include <Maia/Utilities/Allocators/Tlsf_allocator.hpp>
+
+namespace Maia::Utilities::Benchmark
+{
+	namespace
+	{
+		void deallocate(Buddy_allocator& allocator, Buddy_allocation const& allocation)
+		{
+			allocator.deallocate(allocation.offset);
+		}
+
+		void deallocate(Tlsf_allocator& allocator, Tlsf_allocation const& allocation)
+		{
+			allocator.deallocate(allocation);
+		}
+
+		// Fills three quarters of the allocator with random sizes and alignments of vertex streams and texture
+		// uploads, then replaces a random allocation every iteration.
+		template <typename Allocator, typename Allocation>
+		void stress(benchmark::State& state, Allocator& allocator)
+		{
+			std::uint64_t const capacity = allocator.capacity();
+
+			std::mt19937 random_engine{ 0 };
+			std::uniform_int_distribution<std::uint64_t> size_distribution{ 16, 256 * 1024 };
+			std::uniform_int_distribution<int> alignment_log2_distribution{ 2, 9 };
+
+			auto const allocate = [&]() -> std::optional<Allocation>
+			{
+				return allocator.allocate(size_distribution(random_engine), std::uint64_t{ 1 } << alignment_log2_distribution(random_engine));
+			};
+
+			std::vector<Allocation> allocations;
+			std::uint64_t requested_size = 0;
+
+			while (requested_size < capacity / 4 * 3)
+			{
+				std::optional<Allocation> const allocation = allocate();
+
+				if (!allocation)
+				{
+					break;
+				}
+
+				allocations.push_back(*allocation);
+				requested_size += allocation->size;
+			}
+
+			std::uniform_int_distribution<std::size_t> index_distribution{ 0, allocations.size() - 1 };
+			std::size_t num_failed_allocations = 0;
+
+			for (auto _ : state)
+			{
+				Allocation& allocation = allocations[index_distribution(random_engine)];
+				deallocate(allocator, allocation);
+
+				std::optional<Allocation> new_allocation = allocate();
+				benchmark::DoNotOptimize(new_allocation);
+
+				while (!new_allocation)
+				{
+					++num_failed_allocations;
+					new_allocation = allocate();
+				}
+
+				allocation = *new_allocation;
+			}
+
+			state.SetItemsProcessed(state.iterations() * 2);
+			state.counters["external_fragmentation"] = calculate_external_fragmentation(allocator.statistics());
+			state.counters["allocated_fraction"] = static_cast<double>(allocator.allocated_size()) / static_cast<double>(capacity);
+			state.counters["failed_allocations"] = static_cast<double>(num_failed_allocations);
+		}
+	}
+
+	void buddy_allocator_stress(benchmark::State& state)
+	{
+		Buddy_allocator allocator{ static_cast<std::uint64_t>(state.range(0)), 16 };
+		stress<Buddy_allocator, Buddy_allocation>(state, allocator);
+	}
+	BENCHMARK(buddy_allocator_stress)->Arg(256 * 1024 * 1024);
+
+	void tlsf_allocator_stress(benchmark::State& state)
+	{
+		Tlsf_allocator allocator{ static_cast<std::uint64_t>(state.range(0)) };
+		stress<Tlsf_allocator, Tlsf_allocation>(state, allocator);
+	}
+	BENCHMARK(tlsf_allocator_stress)->Arg(256 * 1024 * 1024);
+}
@@ -0,0 +1,135 @@
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/Utilities/Containers/Pools/Concurrent_pool.hpp>
+#include <Maia/Utilities/Containers/Pools/MemoryPool.hpp>
+
+namespace Maia::Utilities::Benchmark
+{
+	namespace
+	{
+		struct Upload_request
+		{
+			std::array<std::byte, 48> data;
+			std::size_t offset;
+			std::size_t size;
+		};
+
+		constexpr std::size_t batch_size = 64;
+		constexpr std::size_t max_num_threads = 64;
+
+		// Every iteration, the thread creates a batch of requests and destroys them, like a worker that records
+		// the upload requests of a job.
+		template <typename Create_function, typename Destroy_function>
+		void run_batches(benchmark::State& state, Create_function&& create, Destroy_function&& destroy)
+		{
+			std::array<Upload_request*, batch_size> requests{};
+
+			for (auto _ : state)
+			{
+				for (std::size_t index = 0; index < batch_size; ++index)
+				{
+					requests[index] = create(index);
+				}
+
+				benchmark::ClobberMemory();
+
+				for (Upload_request* const request : requests)
+				{
+					destroy(request);
+				}
+			}
+
+			state.SetItemsProcessed(state.iterations() * batch_size * 2);
+		}
+
+		Upload_request make_request(std::size_t const index) noexcept
+		{
+			return { {}, index, batch_size };
+		}
+
+		Concurrent_pool<Upload_request>& get_concurrent_pool()
+		{
+			static Concurrent_pool<Upload_request> pool{ max_num_threads * (batch_size + Concurrent_pool<Upload_request>::Thread_cache::cache_capacity) };
+			return pool;
+		}
+	}
+
+	void concurrent_pool_with_thread_caches(benchmark::State& state)
+	{
+		Concurrent_pool<Upload_request>::Thread_cache cache{ get_concurrent_pool() };
+
+		run_batches(
+			state,
+			[&](std::size_t const index) { return cache.create(make_request(index)); },
+			[&](Upload_request* const request) { cache.destroy(request); }
+		);
+	}
+	BENCHMARK(concurrent_pool_with_thread_caches)->ThreadRange(1, 16)->UseRealTime();
+
+	void concurrent_pool(benchmark::State& state)
+	{
+		Concurrent_pool<Upload_request>& pool = get_concurrent_pool();
+
+		run_batches(
+			state,
+			[&](std::size_t const index) { return pool.create(make_request(index)); },
+			[&](Upload_request* const request) { pool.destroy(request); }
+		);
+	}
+	BENCHMARK(concurrent_pool)->ThreadRange(1, 16)->UseRealTime();
+
+	void malloc_and_free(benchmark::State& state)
+	{
+		run_batches(
+			state,
+			[](std::size_t const index) { return new (std::malloc(sizeof(Upload_request))) Upload_request{ make_request(index) }; },
+			[](Upload_request* const request) { request->~Upload_request(); std::free(request); }
+		);
+	}
+	BENCHMARK(malloc_and_free)->ThreadRange(1, 16)->UseRealTime();
+
+	void memory_pool_with_mutex(benchmark::State& state)
+	{
+		static Memory_pool<Upload_request> pool;
+		static std::mutex mutex;
+
+		// Memory_pool erases through iterators, which are kept in the order of the requests
+		std::vector<Memory_pool<Upload_request>::iterator> positions;
+		positions.reserve(batch_size);
+		std::size_t num_destroyed = 0;
+
+		run_batches(
+			state,
+			[&](std::size_t const index)
+			{
+				std::lock_guard<std::mutex> const lock{ mutex };
+				positions.push_back(pool.emplace(make_request(index)));
+				return &*positions.back();
+			},
+			[&](Upload_request* const request)
+			{
+				Memory_pool<Upload_request>::iterator const position = positions[num_destroyed++];
+				benchmark::DoNotOptimize(request == &*position);
+
+				{
+					std::lock_guard<std::mutex> const lock{ mutex };
+					pool.erase(position);
+				}
+
+				if (num_destroyed == positions.size())
+				{
+					positions.clear();
+					num_destroyed = 0;
+				}
+			}
+		);
+	}
+	BENCHMARK(memory_pool_with_mutex)->ThreadRange(1, 16)->UseRealTime();
+}
@@ -0,0 +1,172 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Maia/Utilities/Containers/Pools/MemoryPool.hpp>
+
+namespace Maia::Utilities::Benchmark
+{
+	namespace
+	{
+		struct Particle
+		{
+			std::array<float, 3> position;
+			std::array<float, 3> velocity;
+			std::array<float, 4> color;
+			float age;
+			float lifetime;
+			std::array<float, 4> padding;
+		};
+
+		Particle create_particle(std::size_t const index) noexcept
+		{
+			float const value = static_cast<float>(index);
+			return { { value, value, value }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, 0.0f, 1.0f, {} };
+		}
+	}
+
+	// Allocates state.range(0) particles and frees them all.
+	void memory_pool_allocate_and_free(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		Memory_pool<Particle> memory_pool;
+		std::vector<Memory_pool<Particle>::iterator> particles;
+		particles.reserve(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				particles.push_back(memory_pool.emplace(create_particle(index)));
+			}
+
+			benchmark::ClobberMemory();
+
+			for (Memory_pool<Particle>::iterator const particle : particles)
+			{
+				memory_pool.erase(particle);
+			}
+
+			particles.clear();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count * 2);
+	}
+	BENCHMARK(memory_pool_allocate_and_free)->Arg(4096);
+
+	void new_delete_allocate_and_free(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<std::unique_ptr<Particle>> particles;
+		particles.reserve(count);
+
+		for (auto _ : state)
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				particles.push_back(std::make_unique<Particle>(create_particle(index)));
+			}
+
+			benchmark::ClobberMemory();
+
+			particles.clear();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count * 2);
+	}
+	BENCHMARK(new_delete_allocate_and_free)->Arg(4096);
+
+	// Keeps state.range(0) particles alive and replaces a random one every iteration.
+	void memory_pool_churn(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		Memory_pool<Particle> memory_pool;
+		std::vector<Memory_pool<Particle>::iterator> particles;
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			particles.push_back(memory_pool.emplace(create_particle(index)));
+		}
+
+		std::mt19937 random_engine{ 0 };
+		std::uniform_int_distribution<std::size_t> index_distribution{ 0, count - 1 };
+
+		for (auto _ : state)
+		{
+			Memory_pool<Particle>::iterator& particle = particles[index_distribution(random_engine)];
+			memory_pool.erase(particle);
+			particle = memory_pool.emplace(create_particle(count));
+			benchmark::DoNotOptimize(*particle);
+		}
+
+		state.SetItemsProcessed(state.iterations() * 2);
+	}
+	BENCHMARK(memory_pool_churn)->Arg(64 * 1024);
+
+	void new_delete_churn(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		std::vector<std::unique_ptr<Particle>> particles;
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			particles.push_back(std::make_unique<Particle>(create_particle(index)));
+		}
+
+		std::mt19937 random_engine{ 0 };
+		std::uniform_int_distribution<std::size_t> index_distribution{ 0, count - 1 };
+
+		for (auto _ : state)
+		{
+			std::unique_ptr<Particle>& particle = particles[index_distribution(random_engine)];
+			particle.reset();
+			particle = std::make_unique<Particle>(create_particle(count));
+			benchmark::DoNotOptimize(*particle);
+		}
+
+		state.SetItemsProcessed(state.iterations() * 2);
+	}
+	BENCHMARK(new_delete_churn)->Arg(64 * 1024);
+
+	// Sums the ages of the particles after erasing every other one.
+	void memory_pool_iterate(benchmark::State& state)
+	{
+		std::size_t const count = static_cast<std::size_t>(state.range(0));
+
+		Memory_pool<Particle> memory_pool;
+		std::vector<Memory_pool<Particle>::iterator> particles;
+
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			particles.push_back(memory_pool.emplace(create_particle(index)));
+		}
+
+		for (std::size_t index = 0; index < count; index += 2)
+		{
+			memory_pool.erase(particles[index]);
+		}
+
+		for (auto _ : state)
+		{
+			float total_age = 0.0f;
+
+			for (Particle const& particle : memory_pool)
+			{
+				total_age += particle.age;
+			}
+
+			benchmark::DoNotOptimize(total_age);
+		}
+
+		state.SetItemsProcessed(state.iterations() * memory_pool.size());
+	}
+	BENCHMARK(memory_pool_iterate)->Arg(64 * 1024);
+}
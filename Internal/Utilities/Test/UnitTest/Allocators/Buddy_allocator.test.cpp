@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate and deallocate blocks with a buddy allocator", "[Buddy_allocator]")
+	{
+		GIVEN("A buddy allocator of 1024 bytes with a minimum block size of 64 bytes")
+		{
+			Buddy_allocator allocator{ 1024, 64 };
+
+			THEN("The whole range is a single free block")
+			{
+				Allocator_statistics const statistics = allocator.statistics();
+
+				CHECK(statistics.capacity == 1024);
+				CHECK(statistics.allocated_size == 0);
+				CHECK(statistics.free_size == 1024);
+				CHECK(statistics.largest_free_block_size == 1024);
+				CHECK(statistics.num_free_blocks == 1);
+				CHECK(calculate_external_fragmentation(statistics) == 0.0f);
+			}
+
+			WHEN("Blocks of 100, 64 and 512 bytes are allocated")
+			{
+				std::optional<Buddy_allocation> const first = allocator.allocate(100);
+				std::optional<Buddy_allocation> const second = allocator.allocate(64);
+				std::optional<Buddy_allocation> const third = allocator.allocate(512);
+
+				THEN("Sizes are rounded up to powers of two and blocks are split from the start of the range")
+				{
+					REQUIRE(first);
+					CHECK(first->offset == 0);
+					CHECK(first->size == 128);
+
+					REQUIRE(second);
+					CHECK(second->offset == 128);
+					CHECK(second->size == 64);
+
+					REQUIRE(third);
+					CHECK(third->offset == 512);
+					CHECK(third->size == 512);
+				}
+
+				THEN("The statistics report the remaining free blocks of 256 and 64 bytes")
+				{
+					Allocator_statistics const statistics = allocator.statistics();
+
+					CHECK(statistics.allocated_size == 704);
+					CHECK(statistics.free_size == 320);
+					CHECK(statistics.largest_free_block_size == 256);
+					CHECK(statistics.num_allocations == 3);
+					CHECK(statistics.num_free_blocks == 2);
+					CHECK(calculate_external_fragmentation(statistics) == Approx(0.2f));
+				}
+
+				THEN("A block larger than the largest free block cannot be allocated")
+				{
+					CHECK(!allocator.allocate(512));
+					CHECK(allocator.allocate(256));
+				}
+
+				WHEN("All blocks are deallocated")
+				{
+					allocator.deallocate(second->offset);
+					allocator.deallocate(first->offset);
+					allocator.deallocate(third->offset);
+
+					THEN("The buddies are merged back into a single block")
+					{
+						Allocator_statistics const statistics = allocator.statistics();
+
+						CHECK(statistics.allocated_size == 0);
+						CHECK(statistics.num_allocations == 0);
+						CHECK(statistics.num_free_blocks == 1);
+						CHECK(statistics.largest_free_block_size == 1024);
+
+						std::optional<Buddy_allocation> const whole = allocator.allocate(1024);
+						REQUIRE(whole);
+						CHECK(whole->offset == 0);
+					}
+				}
+			}
+
+			WHEN("A block larger than the capacity is allocated")
+			{
+				THEN("The allocation fails")
+				{
+					CHECK(!allocator.allocate(2048));
+				}
+			}
+
+			WHEN("A small block with a large alignment is allocated")
+			{
+				std::optional<Buddy_allocation> const padding = allocator.allocate(64);
+				std::optional<Buddy_allocation> const aligned = allocator.allocate(10, 256);
+
+				THEN("The block is as large as the alignment and its offset is aligned")
+				{
+					REQUIRE(padding);
+					REQUIRE(aligned);
+					CHECK(aligned->size == 256);
+					CHECK(aligned->offset % 256 == 0);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Allocate and deallocate random blocks with a buddy allocator", "[Buddy_allocator]")
+	{
+		GIVEN("A buddy allocator of 1 MiB with a minimum block size of 256 bytes")
+		{
+			Buddy_allocator allocator{ 1024 * 1024, 256 };
+
+			std::mt19937 random_engine{ 3 };
+			std::uniform_int_distribution<std::uint64_t> size_distribution{ 1, 16 * 1024 };
+
+			WHEN("Random blocks are allocated until the allocator is full and deallocated in random order, several times")
+			{
+				bool blocks_overlap = false;
+				bool blocks_out_of_range = false;
+
+				for (std::size_t iteration = 0; iteration < 8; ++iteration)
+				{
+					std::vector<Buddy_allocation> allocations;
+
+					while (std::optional<Buddy_allocation> const allocation = allocator.allocate(size_distribution(random_engine)))
+					{
+						allocations.push_back(*allocation);
+					}
+
+					std::sort(allocations.begin(), allocations.end(), [](Buddy_allocation const& lhs, Buddy_allocation const& rhs) -> bool
+					{
+						return lhs.offset < rhs.offset;
+					});
+
+					for (std::size_t index = 0; index < allocations.size(); ++index)
+					{
+						blocks_out_of_range |= allocations[index].offset + allocations[index].size > allocator.capacity();
+						blocks_overlap |= index > 0 && allocations[index - 1].offset + allocations[index - 1].size > allocations[index].offset;
+					}
+
+					std::shuffle(allocations.begin(), allocations.end(), random_engine);
+
+					for (Buddy_allocation const& allocation : allocations)
+					{
+						allocator.deallocate(allocation.offset);
+					}
+				}
+
+				THEN("Blocks never overlap and all memory is merged back into a single block")
+				{
+					CHECK(!blocks_overlap);
+					CHECK(!blocks_out_of_range);
+
+					Allocator_statistics const statistics = allocator.statistics();
+
+					CHECK(statistics.allocated_size == 0);
+					CHECK(statistics.num_free_blocks == 1);
+					CHECK(statistics.largest_free_block_size == allocator.capacity());
+				}
+			}
+		}
+	}
+}
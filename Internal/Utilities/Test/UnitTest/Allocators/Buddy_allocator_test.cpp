@@ -1,10 +0,0 @@
-#include <gtest/gtest.h>
-
-#include <Maia/Utilities/Allocators/Buddy_allocator.hpp>
-
-namespace Maia::Utilities::Test
-{
-	class Buddy_allocator_test : public ::testing::Test
-	{
-	};
-}
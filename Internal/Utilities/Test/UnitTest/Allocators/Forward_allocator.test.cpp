@@ -0,0 +1,63 @@
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Forward_allocator.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate with a forward allocator", "[Forward_allocator]")
+	{
+		GIVEN("A forward allocator of bytes over a memory arena of 64 bytes that cannot grow")
+		{
+			constexpr std::size_t arena_capacity_in_bytes = 64;
+			Memory_arena arena{ arena_capacity_in_bytes, arena_capacity_in_bytes };
+			Forward_allocator<std::byte> allocator{ arena };
+
+			WHEN("64 bytes are allocated")
+			{
+				std::byte* const data = allocator.allocate(arena_capacity_in_bytes);
+
+				THEN("The memory comes from the arena")
+				{
+					CHECK(data != nullptr);
+					CHECK(arena.used_capacity() == arena_capacity_in_bytes);
+				}
+
+				allocator.deallocate(data, arena_capacity_in_bytes);
+			}
+
+			WHEN("More bytes than the arena capacity are allocated")
+			{
+				THEN("std::bad_alloc is thrown")
+				{
+					CHECK_THROWS_AS(allocator.allocate(arena_capacity_in_bytes + 1), std::bad_alloc);
+				}
+			}
+		}
+
+		GIVEN("A vector that uses a forward allocator over a memory arena of 64 byte blocks")
+		{
+			Memory_arena arena{ 64 };
+			std::vector<int, Forward_allocator<int>> values{ Forward_allocator<int>{ arena } };
+
+			WHEN("It grows past the size of a block")
+			{
+				for (int value = 0; value < 100; ++value)
+				{
+					values.push_back(value);
+				}
+
+				THEN("The arena adds blocks and the values are kept")
+				{
+					CHECK(arena.num_blocks() > 1);
+					CHECK(values.size() == 100);
+					CHECK(values.front() == 0);
+					CHECK(values.back() == 99);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Frame_arenas.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate the data of frames in flight from frame arenas", "[Frame_arenas]")
+	{
+		GIVEN("Frame arenas for two frames")
+		{
+			Frame_arenas frame_arenas{ 2, 256 };
+
+			Memory_arena& first_arena = frame_arenas.current();
+			void* const first_frame_data = first_arena.allocate(64, 16);
+
+			WHEN("The next frame begins")
+			{
+				frame_arenas.begin_frame();
+
+				THEN("It uses another arena and the data of the previous frame is kept")
+				{
+					CHECK(&frame_arenas.current() != &first_arena);
+					CHECK(frame_arenas.current().used_capacity() == 0);
+					CHECK(first_arena.used_capacity() >= 64);
+				}
+
+				WHEN("Data is allocated and another frame begins")
+				{
+					frame_arenas.current().allocate(32, 16);
+					frame_arenas.begin_frame();
+
+					THEN("The first arena is reused from its beginning")
+					{
+						CHECK(&frame_arenas.current() == &first_arena);
+						CHECK(first_arena.used_capacity() == 0);
+						CHECK(first_arena.allocate(64, 16) == first_frame_data);
+						CHECK(first_arena.num_blocks() == 1);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Memory_arena.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate from a growable memory arena", "[Memory_arena]")
+	{
+		GIVEN("A memory arena of 64 byte blocks")
+		{
+			Memory_arena arena{ 64 };
+
+			THEN("It starts with a single empty block")
+			{
+				CHECK(arena.capacity() == 64);
+				CHECK(arena.num_blocks() == 1);
+				CHECK(arena.used_capacity() == 0);
+			}
+
+			WHEN("Aligned allocations are made")
+			{
+				void* const first = arena.allocate(3, 1);
+				void* const second = arena.allocate(8, 16);
+
+				THEN("They are aligned and the padding is counted as used")
+				{
+					CHECK(reinterpret_cast<std::uintptr_t>(second) % 16 == 0);
+					CHECK(static_cast<std::byte*>(second) > static_cast<std::byte*>(first));
+					CHECK(arena.used_capacity() >= 11);
+					CHECK(arena.used_capacity() <= 3 + 15 + 8);
+				}
+			}
+
+			WHEN("Allocations do not fit in the first block")
+			{
+				arena.allocate(48, 1);
+				arena.allocate(32, 1);
+
+				THEN("A block is added and the end of the first one is counted as used")
+				{
+					CHECK(arena.num_blocks() == 2);
+					CHECK(arena.capacity() == 128);
+					CHECK(arena.used_capacity() == 64 + 32);
+				}
+			}
+
+			WHEN("An allocation is larger than a block")
+			{
+				arena.allocate(100, 1);
+
+				THEN("It gets a block of its own size")
+				{
+					CHECK(arena.num_blocks() == 2);
+					CHECK(arena.capacity() == 164);
+				}
+			}
+
+			WHEN("The arena is rewound to a marker")
+			{
+				arena.allocate(16, 1);
+				Memory_arena_marker const marker = arena.mark();
+
+				void* const first = arena.allocate(40, 1);
+				arena.allocate(40, 1);
+				arena.allocate(40, 1);
+
+				arena.rewind(marker);
+
+				THEN("The memory allocated after the marker is reused and the high-water mark is kept")
+				{
+					CHECK(arena.used_capacity() == 16);
+					CHECK(arena.high_water_mark() == 64 + 64 + 40);
+					CHECK(arena.allocate(40, 1) == first);
+				}
+			}
+
+			WHEN("The arena is reset after growing")
+			{
+				void* const first = arena.allocate(64, 1);
+				arena.allocate(64, 1);
+				arena.allocate(64, 1);
+
+				arena.reset();
+
+				THEN("The blocks are kept and reused from the first one")
+				{
+					CHECK(arena.used_capacity() == 0);
+					CHECK(arena.num_blocks() == 3);
+					CHECK(arena.allocate(64, 1) == first);
+					CHECK(arena.allocate(64, 1) != first);
+					CHECK(arena.num_blocks() == 3);
+				}
+			}
+		}
+
+		GIVEN("A memory arena of 64 byte blocks with a maximum capacity of 128 bytes")
+		{
+			Memory_arena arena{ 64, 128 };
+
+			WHEN("More than the maximum capacity is allocated")
+			{
+				arena.allocate(64, 1);
+				arena.allocate(64, 1);
+
+				THEN("std::bad_alloc is thrown")
+				{
+					CHECK_THROWS_AS(arena.allocate(1, 1), std::bad_alloc);
+				}
+			}
+		}
+	}
+}
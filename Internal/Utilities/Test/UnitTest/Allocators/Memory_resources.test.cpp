@@ -0,0 +1,134 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Memory_resources.hpp>
+
+namespace Maia::Utilities::Test
+{
+	namespace
+	{
+		bool is_aligned(void const* const data, std::size_t const alignment)
+		{
+			return reinterpret_cast<std::uintptr_t>(data) % alignment == 0;
+		}
+	}
+
+	SCENARIO("Use a memory arena as a memory resource", "[Memory_resources]")
+	{
+		GIVEN("A memory resource over a memory arena of 256 byte blocks")
+		{
+			Memory_arena arena{ 256 };
+			Memory_arena_resource resource{ arena };
+
+			WHEN("A pmr vector grows in it")
+			{
+				std::pmr::vector<int> values{ &resource };
+
+				for (int value = 0; value < 200; ++value)
+				{
+					values.push_back(value);
+				}
+
+				THEN("Its memory comes from the arena")
+				{
+					CHECK(values.back() == 199);
+					CHECK(arena.used_capacity() >= 200 * sizeof(int));
+				}
+			}
+
+			THEN("It is equal to other resources over the same arena only")
+			{
+				Memory_arena other_arena{ 256 };
+
+				CHECK(resource == Memory_arena_resource{ arena });
+				CHECK(resource != Memory_arena_resource{ other_arena });
+			}
+		}
+	}
+
+	SCENARIO("Use offset allocators as memory resources", "[Memory_resources]")
+	{
+		GIVEN("A buddy memory resource of 4 KiB")
+		{
+			Buddy_memory_resource resource{ 4096, 16 };
+
+			WHEN("Aligned blocks are allocated and deallocated")
+			{
+				void* const first = resource.allocate(24, 8);
+				void* const second = resource.allocate(100, 64);
+
+				THEN("They are aligned and do not overlap")
+				{
+					CHECK(is_aligned(first, 8));
+					CHECK(is_aligned(second, 64));
+					CHECK(static_cast<std::byte*>(second) >= static_cast<std::byte*>(first) + 24);
+					CHECK(resource.allocator().allocated_size() == 32 + 128);
+				}
+
+				resource.deallocate(second, 100, 64);
+				resource.deallocate(first, 24, 8);
+
+				THEN("All the memory is free again")
+				{
+					CHECK(resource.allocator().allocated_size() == 0);
+				}
+			}
+
+			WHEN("More than the capacity is allocated")
+			{
+				THEN("std::bad_alloc is thrown")
+				{
+					CHECK_THROWS_AS(resource.allocate(8192), std::bad_alloc);
+				}
+			}
+		}
+
+		GIVEN("A TLSF memory resource of 64 KiB")
+		{
+			Tlsf_memory_resource resource{ 64 * 1024 };
+
+			WHEN("A pmr vector of pmr vectors grows in it and is destroyed")
+			{
+				{
+					std::pmr::vector<std::pmr::vector<std::uint64_t>> values{ &resource };
+
+					for (std::uint64_t index = 0; index < 32; ++index)
+					{
+						values.emplace_back(index + 1, index);
+					}
+
+					CHECK(values[31].size() == 32);
+					CHECK(is_aligned(values[31].data(), alignof(std::uint64_t)));
+					CHECK(resource.allocator().allocated_size() > 0);
+				}
+
+				THEN("All the memory is merged back into a single free block")
+				{
+					Allocator_statistics const statistics = resource.allocator().statistics();
+
+					CHECK(statistics.allocated_size == 0);
+					CHECK(statistics.num_free_blocks == 1);
+				}
+			}
+
+			WHEN("A block with a large alignment is allocated")
+			{
+				void* const unaligned = resource.allocate(3, 1);
+				void* const aligned = resource.allocate(16, 256);
+
+				THEN("It is aligned")
+				{
+					CHECK(is_aligned(aligned, 256));
+				}
+
+				resource.deallocate(aligned, 16, 256);
+				resource.deallocate(unaligned, 3, 1);
+			}
+		}
+	}
+}
@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate temporary data from the scratch arena of a thread", "[Scratch_arena]")
+	{
+		GIVEN("The scratch arena of the calling thread")
+		{
+			Memory_arena& scratch_arena = get_thread_scratch_arena();
+			std::size_t const used_capacity = scratch_arena.used_capacity();
+
+			WHEN("A vector is filled inside a scratch scope")
+			{
+				{
+					Scratch_scope const scope;
+
+					Arena_vector<int> values{ scope.allocator<int>() };
+
+					for (int value = 0; value < 1000; ++value)
+					{
+						values.push_back(value);
+					}
+
+					CHECK(&scope.arena() == &scratch_arena);
+					CHECK(scratch_arena.used_capacity() >= used_capacity + 1000 * sizeof(int));
+				}
+
+				THEN("Its memory is freed when the scope ends")
+				{
+					CHECK(scratch_arena.used_capacity() == used_capacity);
+				}
+			}
+
+			WHEN("The scratch arena is requested from another thread")
+			{
+				Memory_arena* other_scratch_arena = nullptr;
+
+				std::thread thread{ [&other_scratch_arena]() -> void
+				{
+					other_scratch_arena = &get_thread_scratch_arena();
+				} };
+				thread.join();
+
+				THEN("Each thread has its own arena")
+				{
+					CHECK(other_scratch_arena != &scratch_arena);
+				}
+			}
+		}
+	}
+}
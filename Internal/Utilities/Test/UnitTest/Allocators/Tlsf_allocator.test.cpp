@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Tlsf_allocator.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate and deallocate blocks with a TLSF allocator", "[Tlsf_allocator]")
+	{
+		GIVEN("A TLSF allocator of 1000 bytes")
+		{
+			Tlsf_allocator allocator{ 1000 };
+
+			THEN("The whole range is a single free block")
+			{
+				Allocator_statistics const statistics = allocator.statistics();
+
+				CHECK(statistics.capacity == 1000);
+				CHECK(statistics.free_size == 1000);
+				CHECK(statistics.largest_free_block_size == 1000);
+				CHECK(statistics.num_free_blocks == 1);
+			}
+
+			WHEN("Blocks of 100, 7 and 300 bytes are allocated")
+			{
+				std::optional<Tlsf_allocation> const first = allocator.allocate(100);
+				std::optional<Tlsf_allocation> const second = allocator.allocate(7);
+				std::optional<Tlsf_allocation> const third = allocator.allocate(300);
+
+				THEN("The blocks have the requested sizes and are placed one after another")
+				{
+					REQUIRE(first);
+					CHECK(first->offset == 0);
+					CHECK(first->size == 100);
+
+					REQUIRE(second);
+					CHECK(second->offset == 100);
+					CHECK(second->size == 7);
+
+					REQUIRE(third);
+					CHECK(third->offset == 107);
+					CHECK(third->size == 300);
+
+					Allocator_statistics const statistics = allocator.statistics();
+					CHECK(statistics.allocated_size == 407);
+					CHECK(statistics.largest_free_block_size == 593);
+					CHECK(statistics.num_allocations == 3);
+					CHECK(statistics.num_free_blocks == 1);
+				}
+
+				WHEN("The middle block is deallocated")
+				{
+					allocator.deallocate(*second);
+
+					THEN("There are two free blocks and the hole is reused by a small allocation")
+					{
+						Allocator_statistics const statistics = allocator.statistics();
+						CHECK(statistics.num_free_blocks == 2);
+						CHECK(calculate_external_fragmentation(statistics) == Approx(7.0f / 600.0f));
+
+						std::optional<Tlsf_allocation> const small = allocator.allocate(5);
+						REQUIRE(small);
+						CHECK(small->offset == 100);
+					}
+				}
+
+				WHEN("All blocks are deallocated")
+				{
+					allocator.deallocate(*first);
+					allocator.deallocate(*third);
+					allocator.deallocate(*second);
+
+					THEN("The free blocks are merged into a single block")
+					{
+						Allocator_statistics const statistics = allocator.statistics();
+						CHECK(statistics.allocated_size == 0);
+						CHECK(statistics.num_free_blocks == 1);
+						CHECK(statistics.largest_free_block_size == 1000);
+
+						CHECK(allocator.allocate(1000));
+					}
+				}
+			}
+
+			WHEN("An aligned block is allocated after an unaligned one")
+			{
+				std::optional<Tlsf_allocation> const unaligned = allocator.allocate(3);
+				std::optional<Tlsf_allocation> const aligned = allocator.allocate(64, 256);
+
+				THEN("Its offset is aligned and the padding stays free")
+				{
+					REQUIRE(unaligned);
+					REQUIRE(aligned);
+					CHECK(aligned->offset == 256);
+					CHECK(aligned->size == 64);
+					CHECK(allocator.statistics().num_free_blocks == 2);
+				}
+			}
+
+			WHEN("A block larger than the capacity is allocated")
+			{
+				THEN("The allocation fails")
+				{
+					CHECK(!allocator.allocate(1001));
+					CHECK(!allocator.allocate(1000, 2048));
+				}
+			}
+		}
+	}
+
+	SCENARIO("Allocate and deallocate random blocks with a TLSF allocator", "[Tlsf_allocator]")
+	{
+		GIVEN("A TLSF allocator of 1 MiB")
+		{
+			Tlsf_allocator allocator{ 1024 * 1024 };
+
+			std::mt19937 random_engine{ 7 };
+			std::uniform_int_distribution<std::uint64_t> size_distribution{ 1, 16 * 1024 };
+			std::uniform_int_distribution<int> alignment_log2_distribution{ 0, 8 };
+
+			WHEN("Random blocks are allocated until the allocator is full and deallocated in random order, several times")
+			{
+				bool blocks_overlap = false;
+				bool blocks_out_of_range = false;
+				bool blocks_unaligned = false;
+
+				for (std::size_t iteration = 0; iteration < 8; ++iteration)
+				{
+					std::vector<Tlsf_allocation> allocations;
+
+					while (true)
+					{
+						std::uint64_t const alignment = std::uint64_t{ 1 } << alignment_log2_distribution(random_engine);
+						std::optional<Tlsf_allocation> const allocation = allocator.allocate(size_distribution(random_engine), alignment);
+
+						if (!allocation)
+						{
+							break;
+						}
+
+						blocks_unaligned |= allocation->offset % alignment != 0;
+						allocations.push_back(*allocation);
+					}
+
+					std::sort(allocations.begin(), allocations.end(), [](Tlsf_allocation const& lhs, Tlsf_allocation const& rhs) -> bool
+					{
+						return lhs.offset < rhs.offset;
+					});
+
+					for (std::size_t index = 0; index < allocations.size(); ++index)
+					{
+						blocks_out_of_range |= allocations[index].offset + allocations[index].size > allocator.capacity();
+						blocks_overlap |= index > 0 && allocations[index - 1].offset + allocations[index - 1].size > allocations[index].offset;
+					}
+
+					std::shuffle(allocations.begin(), allocations.end(), random_engine);
+
+					for (Tlsf_allocation const& allocation : allocations)
+					{
+						allocator.deallocate(allocation);
+					}
+				}
+
+				THEN("Blocks never overlap, are aligned and all memory is merged back into a single block")
+				{
+					CHECK(!blocks_overlap);
+					CHECK(!blocks_out_of_range);
+					CHECK(!blocks_unaligned);
+
+					Allocator_statistics const statistics = allocator.statistics();
+
+					CHECK(statistics.allocated_size == 0);
+					CHECK(statistics.num_free_blocks == 1);
+					CHECK(statistics.largest_free_block_size == allocator.capacity());
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,149 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Allocators/Virtual_memory_arena.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Allocate from a reserved range of virtual memory", "[Virtual_memory_arena]")
+	{
+		GIVEN("A virtual memory arena of 8 MiB with huge pages")
+		{
+			Virtual_memory_arena arena{ 8 * 1024 * 1024 };
+
+			THEN("The range is reserved at a huge page boundary and nothing is committed")
+			{
+				CHECK(arena.reserved_size() == 8 * 1024 * 1024);
+				CHECK(arena.committed_size() == 0);
+				CHECK(reinterpret_cast<std::uintptr_t>(arena.data()) % Virtual_memory_arena::huge_page_size_in_bytes == 0);
+			}
+
+			WHEN("Aligned blocks are allocated")
+			{
+				void* const first = arena.allocate(100, 8);
+				void* const second = arena.allocate(3 * 1024 * 1024, 64);
+
+				THEN("They are contiguous and memory is committed in huge pages up to their end")
+				{
+					CHECK(first == arena.data());
+					CHECK(second == arena.data() + 128);
+					CHECK(arena.used_size() == 128 + 3 * 1024 * 1024);
+					CHECK(arena.committed_size() == 2 * Virtual_memory_arena::huge_page_size_in_bytes);
+
+					std::memset(second, 0xFF, 3 * 1024 * 1024);
+				}
+
+				AND_WHEN("The arena is reset")
+				{
+					arena.reset();
+
+					THEN("The memory is reused and stays committed")
+					{
+						CHECK(arena.allocate(16, 16) == first);
+						CHECK(arena.committed_size() == 2 * Virtual_memory_arena::huge_page_size_in_bytes);
+					}
+				}
+			}
+
+			WHEN("More than the reserved size is allocated")
+			{
+				void* const data = arena.allocate(8 * 1024 * 1024 - 16, 1);
+
+				THEN("std::bad_alloc is thrown")
+				{
+					CHECK(data == arena.data());
+					CHECK_THROWS_AS(arena.allocate(32, 1), std::bad_alloc);
+				}
+			}
+		}
+
+		GIVEN("A virtual memory arena without huge pages with blocks of several pages")
+		{
+			Virtual_memory_arena arena{ 1024 * 1024, false };
+
+			std::size_t const block_size = 4 * arena.commit_granularity();
+
+			void* const first = arena.allocate(block_size, 64);
+			void* const second = arena.allocate(block_size, 64);
+			std::memset(first, 0xFF, block_size);
+
+			WHEN("A block is deallocated")
+			{
+				arena.deallocate(first, block_size, 64);
+
+				THEN("It is kept in a free list and the pages after its header are decommitted")
+				{
+					CHECK(arena.free_size() == block_size);
+					CHECK(arena.decommitted_size() == 3 * arena.commit_granularity());
+					CHECK(arena.used_size() == 2 * block_size);
+				}
+
+				AND_WHEN("A block of the same size is allocated")
+				{
+					void* const third = arena.allocate(block_size, 64);
+					std::memset(third, 0xFF, block_size);
+
+					THEN("The deallocated block is reused and committed again")
+					{
+						CHECK(third == first);
+						CHECK(arena.free_size() == 0);
+						CHECK(arena.decommitted_size() == 0);
+						CHECK(arena.used_size() == 2 * block_size);
+					}
+				}
+
+				AND_WHEN("A block of another size is allocated")
+				{
+					void* const third = arena.allocate(block_size / 2, 64);
+
+					THEN("It is allocated after the others")
+					{
+						CHECK(third == static_cast<std::byte*>(second) + block_size);
+						CHECK(arena.free_size() == block_size);
+					}
+				}
+
+				AND_WHEN("The arena is reset")
+				{
+					arena.reset();
+
+					THEN("The free lists are emptied and every page is committed again")
+					{
+						CHECK(arena.free_size() == 0);
+						CHECK(arena.decommitted_size() == 0);
+						CHECK(arena.allocate(block_size, 64) == first);
+
+						std::memset(first, 0xFF, 2 * block_size);
+					}
+				}
+			}
+		}
+
+		GIVEN("A virtual memory arena without huge pages used by a pmr vector")
+		{
+			Virtual_memory_arena arena{ 1024 * 1024, false };
+			std::pmr::vector<int> values{ &arena };
+
+			WHEN("The vector grows")
+			{
+				for (int value = 0; value < 10000; ++value)
+				{
+					values.push_back(value);
+				}
+
+				THEN("Memory is committed in pages")
+				{
+					CHECK(values.back() == 9999);
+					CHECK(arena.committed_size() % arena.commit_granularity() == 0);
+					CHECK(arena.committed_size() < arena.reserved_size());
+				}
+			}
+		}
+	}
+}
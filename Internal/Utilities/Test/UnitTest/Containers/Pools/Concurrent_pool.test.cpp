@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Containers/Pools/Concurrent_pool.hpp>
+
+namespace Maia::Utilities::Test
+{
+	namespace
+	{
+		struct Job
+		{
+			std::size_t thread_index;
+			std::size_t value;
+		};
+
+		struct Throws_on_construction
+		{
+			Throws_on_construction()
+			{
+				throw std::runtime_error{ "Construction failed" };
+			}
+		};
+	}
+
+	SCENARIO("Create and destroy objects of a concurrent pool", "[Concurrent_pool]")
+	{
+		GIVEN("A concurrent pool of 4 jobs")
+		{
+			Concurrent_pool<Job> pool{ 4 };
+
+			WHEN("All jobs are created")
+			{
+				std::vector<Job*> jobs;
+
+				for (std::size_t index = 0; index < 4; ++index)
+				{
+					jobs.push_back(pool.create(Job{ 0, index }));
+				}
+
+				THEN("They are distinct and no more can be created")
+				{
+					CHECK(std::set<Job*>(jobs.begin(), jobs.end()).size() == 4);
+					CHECK(std::none_of(jobs.begin(), jobs.end(), [](Job const* const job) { return job == nullptr; }));
+					CHECK(jobs[3]->value == 3);
+					CHECK(pool.create(Job{ 0, 4 }) == nullptr);
+				}
+
+				AND_WHEN("A job is destroyed")
+				{
+					pool.destroy(jobs[1]);
+
+					THEN("Its slot is reused")
+					{
+						CHECK(pool.create(Job{ 0, 5 }) == jobs[1]);
+					}
+				}
+			}
+
+			WHEN("Jobs are created through a thread cache")
+			{
+				Job* job = nullptr;
+
+				{
+					Concurrent_pool<Job>::Thread_cache cache{ pool };
+
+					job = cache.create(Job{ 0, 1 });
+					cache.destroy(job);
+				}
+
+				THEN("The cache returns its slots to the pool when destroyed")
+				{
+					std::vector<Job*> jobs;
+
+					for (std::size_t index = 0; index < 4; ++index)
+					{
+						jobs.push_back(pool.create(Job{ 0, index }));
+					}
+
+					CHECK(std::find(jobs.begin(), jobs.end(), nullptr) == jobs.end());
+					CHECK(std::find(jobs.begin(), jobs.end(), job) != jobs.end());
+				}
+			}
+		}
+
+		GIVEN("A concurrent pool whose objects throw on construction")
+		{
+			Concurrent_pool<Throws_on_construction> pool{ 1 };
+
+			WHEN("An object is created")
+			{
+				CHECK_THROWS_AS(pool.create(), std::runtime_error);
+
+				THEN("The slot is returned to the pool")
+				{
+					CHECK_THROWS_AS(pool.create(), std::runtime_error);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Create and destroy objects of a concurrent pool from several threads", "[Concurrent_pool]")
+	{
+		GIVEN("A concurrent pool shared by 4 threads")
+		{
+			constexpr std::size_t num_threads = 4;
+			constexpr std::size_t num_live_jobs_per_thread = 100;
+
+			// Caches can hold free slots that the other threads need
+			Concurrent_pool<Job> pool{ num_threads * (num_live_jobs_per_thread + Concurrent_pool<Job>::Thread_cache::cache_capacity) };
+
+			WHEN("Each thread repeatedly creates jobs and destroys them")
+			{
+				std::atomic<std::size_t> num_overwritten_jobs{ 0 };
+				std::atomic<std::size_t> num_failed_creations{ 0 };
+
+				auto const run = [&](std::size_t const thread_index, bool const use_cache)
+				{
+					std::unique_ptr<Concurrent_pool<Job>::Thread_cache> cache = use_cache ? std::make_unique<Concurrent_pool<Job>::Thread_cache>(pool) : nullptr;
+					std::vector<Job*> jobs;
+
+					for (std::size_t iteration = 0; iteration < 1000; ++iteration)
+					{
+						for (std::size_t index = 0; index < num_live_jobs_per_thread; ++index)
+						{
+							Job* const job = cache ? cache->create(Job{ thread_index, index }) : pool.create(Job{ thread_index, index });
+
+							if (job == nullptr)
+							{
+								++num_failed_creations;
+								continue;
+							}
+
+							jobs.push_back(job);
+						}
+
+						for (std::size_t index = 0; index < jobs.size(); ++index)
+						{
+							if (jobs[index]->thread_index != thread_index || jobs[index]->value != index)
+							{
+								++num_overwritten_jobs;
+							}
+
+							if (cache)
+							{
+								cache->destroy(jobs[index]);
+							}
+							else
+							{
+								pool.destroy(jobs[index]);
+							}
+						}
+
+						jobs.clear();
+					}
+				};
+
+				std::vector<std::thread> threads;
+				for (std::size_t thread_index = 0; thread_index < num_threads; ++thread_index)
+				{
+					threads.emplace_back(run, thread_index, thread_index % 2 == 0);
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+
+				THEN("No job is given to two threads and no slot is lost")
+				{
+					CHECK(num_overwritten_jobs == 0);
+					CHECK(num_failed_creations == 0);
+
+					std::vector<Job*> jobs;
+					for (std::size_t index = 0; index < pool.capacity(); ++index)
+					{
+						jobs.push_back(pool.create(Job{ 0, index }));
+					}
+
+					CHECK(std::find(jobs.begin(), jobs.end(), nullptr) == jobs.end());
+					CHECK(pool.create(Job{ 0, 0 }) == nullptr);
+				}
+			}
+		}
+	}
+}
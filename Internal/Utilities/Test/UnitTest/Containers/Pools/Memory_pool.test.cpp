@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Containers/Pools/MemoryPool.hpp>
+
+namespace Maia::Utilities::Test
+{
+	namespace
+	{
+		struct Throws_on_construction
+		{
+			Throws_on_construction()
+			{
+				throw std::runtime_error{ "Construction failed" };
+			}
+		};
+
+		std::vector<int> get_values(Memory_pool<int> const& memory_pool)
+		{
+			return { memory_pool.begin(), memory_pool.end() };
+		}
+	}
+
+	SCENARIO("Create a memory pool", "[Memory_pool]")
+	{
+		GIVEN("A default constructed memory pool")
+		{
+			Memory_pool<int> memory_pool;
+
+			THEN("It is empty and has no capacity")
+			{
+				CHECK(memory_pool.empty());
+				CHECK(memory_pool.size() == 0);
+				CHECK(memory_pool.capacity() == 0);
+				CHECK(memory_pool.begin() == memory_pool.end());
+			}
+
+			WHEN("An element is emplaced")
+			{
+				auto const position = memory_pool.emplace(3);
+
+				THEN("A page is added")
+				{
+					CHECK(*position == 3);
+					CHECK(memory_pool.size() == 1);
+					CHECK(memory_pool.num_pages() == 1);
+					CHECK(memory_pool.capacity() == 64);
+				}
+			}
+		}
+
+		GIVEN("A memory pool constructed with a capacity of 100")
+		{
+			Memory_pool<int> memory_pool{ 100 };
+
+			THEN("It is empty and the capacity is rounded up to whole pages")
+			{
+				CHECK(memory_pool.empty());
+				CHECK(memory_pool.num_pages() == 2);
+				CHECK(memory_pool.capacity() == 128);
+			}
+		}
+	}
+
+	SCENARIO("Emplace and erase elements of a memory pool", "[Memory_pool]")
+	{
+		GIVEN("A memory pool with a full page of elements")
+		{
+			Memory_pool<int> memory_pool;
+			std::vector<int*> addresses;
+
+			for (int value = 0; value < 64; ++value)
+			{
+				addresses.push_back(&*memory_pool.emplace(value));
+			}
+
+			WHEN("More elements are emplaced")
+			{
+				for (int value = 64; value < 200; ++value)
+				{
+					memory_pool.emplace(value);
+				}
+
+				THEN("Pages are added and the existing elements are not moved")
+				{
+					CHECK(memory_pool.size() == 200);
+					CHECK(memory_pool.num_pages() == 4);
+
+					for (int value = 0; value < 64; ++value)
+					{
+						CHECK(*addresses[value] == value);
+					}
+				}
+			}
+
+			WHEN("More capacity is reserved")
+			{
+				memory_pool.reserve(1000);
+
+				THEN("The elements are kept")
+				{
+					CHECK(memory_pool.capacity() >= 1000);
+					CHECK(memory_pool.size() == 64);
+					CHECK(get_values(memory_pool).size() == 64);
+					CHECK(*addresses[10] == 10);
+				}
+			}
+
+			WHEN("Some elements are erased")
+			{
+				auto position = memory_pool.begin();
+				while (position != memory_pool.end())
+				{
+					auto const current = position++;
+
+					if (*current % 2 == 0)
+					{
+						memory_pool.erase(current);
+					}
+				}
+
+				THEN("Iteration only visits the remaining elements")
+				{
+					std::vector<int> const values = get_values(memory_pool);
+
+					CHECK(memory_pool.size() == 32);
+					CHECK(values.size() == 32);
+					CHECK(std::all_of(values.begin(), values.end(), [](int const value) { return value % 2 == 1; }));
+				}
+
+				AND_WHEN("New elements are emplaced")
+				{
+					int* const address = &*memory_pool.emplace(-1);
+
+					THEN("The free slots are reused before adding pages")
+					{
+						CHECK(memory_pool.num_pages() == 1);
+						CHECK(std::find(addresses.begin(), addresses.end(), address) != addresses.end());
+					}
+				}
+			}
+
+			WHEN("The memory pool is cleared")
+			{
+				memory_pool.clear();
+
+				THEN("It is empty and keeps its pages")
+				{
+					CHECK(memory_pool.empty());
+					CHECK(memory_pool.begin() == memory_pool.end());
+					CHECK(memory_pool.capacity() == 64);
+				}
+			}
+		}
+	}
+
+	SCENARIO("Manage the lifetime of the elements of a memory pool", "[Memory_pool]")
+	{
+		GIVEN("A memory pool of shared pointers")
+		{
+			std::shared_ptr<int> const value = std::make_shared<int>(1);
+
+			{
+				Memory_pool<std::shared_ptr<int>> memory_pool;
+
+				auto const position = memory_pool.emplace(value);
+				memory_pool.emplace(value);
+				memory_pool.emplace(value);
+
+				CHECK(value.use_count() == 4);
+
+				memory_pool.erase(position);
+
+				CHECK(value.use_count() == 3);
+			}
+
+			THEN("The elements are destroyed when erased or when the memory pool is destroyed")
+			{
+				CHECK(value.use_count() == 1);
+			}
+		}
+
+		GIVEN("A memory pool with free slots")
+		{
+			Memory_pool<Throws_on_construction> memory_pool{ 64 };
+
+			WHEN("The constructor of a new element throws")
+			{
+				CHECK_THROWS_AS(memory_pool.emplace(), std::runtime_error);
+
+				THEN("The memory pool is unchanged")
+				{
+					CHECK(memory_pool.empty());
+					CHECK(memory_pool.capacity() == 64);
+				}
+			}
+		}
+
+		GIVEN("Two memory pools")
+		{
+			Memory_pool<int> memory_pool_0;
+			memory_pool_0.emplace(1);
+
+			Memory_pool<int> memory_pool_1;
+			memory_pool_1.emplace(2);
+
+			WHEN("They are swapped")
+			{
+				memory_pool_0.swap(memory_pool_1);
+
+				THEN("Their elements are swapped")
+				{
+					CHECK(*memory_pool_0.begin() == 2);
+					CHECK(*memory_pool_1.begin() == 1);
+				}
+			}
+
+			WHEN("One is moved into the other")
+			{
+				int* const address = &*memory_pool_0.begin();
+				memory_pool_1 = std::move(memory_pool_0);
+
+				THEN("The elements keep their address")
+				{
+					CHECK(memory_pool_1.size() == 1);
+					CHECK(&*memory_pool_1.begin() == address);
+				}
+			}
+		}
+	}
+}
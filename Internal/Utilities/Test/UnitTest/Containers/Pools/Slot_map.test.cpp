@@ -0,0 +1,124 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Containers/Pools/Slot_map.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Insert, find and erase elements of a slot map", "[Slot_map]")
+	{
+		GIVEN("A slot map with three elements")
+		{
+			Slot_map<std::string> slot_map;
+
+			Slot_map_handle<std::string> const first = slot_map.insert("first");
+			Slot_map_handle<std::string> const second = slot_map.insert("second");
+			Slot_map_handle<std::string> const third = slot_map.emplace(5, 'c');
+
+			THEN("The elements are found by their handles and are contiguous")
+			{
+				CHECK(slot_map.size() == 3);
+				CHECK(slot_map[first] == "first");
+				CHECK(slot_map.at(second) == "second");
+				CHECK(*slot_map.get(third) == "ccccc");
+				CHECK(&slot_map[third] == slot_map.data() + 2);
+			}
+
+			THEN("A default constructed handle does not refer to an element")
+			{
+				Slot_map_handle<std::string> const handle;
+
+				CHECK(!slot_map.contains(handle));
+				CHECK(slot_map.get(handle) == nullptr);
+				CHECK_THROWS_AS(slot_map.at(handle), std::out_of_range);
+			}
+
+			WHEN("The first element is erased")
+			{
+				CHECK(slot_map.erase(first));
+
+				THEN("The last element is moved into its place and the other handles still work")
+				{
+					CHECK(slot_map.size() == 2);
+					CHECK(slot_map.data()[0] == "ccccc");
+					CHECK(slot_map[second] == "second");
+					CHECK(slot_map[third] == "ccccc");
+					CHECK(slot_map.get_handle(slot_map.begin()) == third);
+				}
+
+				THEN("Its handle is invalid")
+				{
+					CHECK(!slot_map.contains(first));
+					CHECK(!slot_map.erase(first));
+				}
+
+				AND_WHEN("A new element is inserted")
+				{
+					Slot_map_handle<std::string> const fourth = slot_map.insert("fourth");
+
+					THEN("It reuses the slot, but the old handle stays invalid")
+					{
+						CHECK(fourth.index == first.index);
+						CHECK(fourth != first);
+						CHECK(!slot_map.contains(first));
+						CHECK(slot_map[fourth] == "fourth");
+					}
+				}
+			}
+
+			WHEN("The slot map is cleared")
+			{
+				slot_map.clear();
+
+				THEN("It is empty and all handles are invalid")
+				{
+					CHECK(slot_map.empty());
+					CHECK(slot_map.begin() == slot_map.end());
+					CHECK(!slot_map.contains(first));
+					CHECK(!slot_map.contains(second));
+					CHECK(!slot_map.contains(third));
+				}
+			}
+		}
+	}
+
+	SCENARIO("Iterate over the elements of a slot map", "[Slot_map]")
+	{
+		GIVEN("A slot map of move-only elements where some were erased")
+		{
+			Slot_map<std::unique_ptr<int>> slot_map;
+
+			for (int value = 0; value < 10; ++value)
+			{
+				Slot_map_handle<std::unique_ptr<int>> const handle = slot_map.insert(std::make_unique<int>(value));
+
+				if (value % 3 == 0)
+				{
+					slot_map.erase(handle);
+				}
+			}
+
+			THEN("Iteration visits the remaining elements, whose handles are retrieved from their position")
+			{
+				for (std::size_t position = 0; position < slot_map.size(); ++position)
+				{
+					Slot_map_handle<std::unique_ptr<int>> const handle = slot_map.get_handle(position);
+
+					CHECK(slot_map.get(handle) == &slot_map.data()[position]);
+				}
+
+				int sum = 0;
+				for (std::unique_ptr<int> const& value : slot_map)
+				{
+					sum += *value;
+				}
+
+				CHECK(slot_map.size() == 6);
+				CHECK(sum == 1 + 2 + 4 + 5 + 7 + 8);
+			}
+		}
+	}
+}
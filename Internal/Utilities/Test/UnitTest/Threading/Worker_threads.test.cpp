@@ -0,0 +1,87 @@
+#include <array>
+#include <cstddef>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+namespace Maia::Utilities::Test
+{
+	SCENARIO("Run the tasks of parallel loops on persistent worker threads", "[Worker_threads]")
+	{
+		GIVEN("Worker threads for four threads")
+		{
+			Worker_threads worker_threads{ 4 };
+
+			THEN("The calling thread is counted")
+			{
+				CHECK(worker_threads.num_threads() == 4);
+			}
+
+			WHEN("Several loops are run one after the other")
+			{
+				std::array<std::size_t, 4> run_counts{};
+				std::array<std::thread::id, 4> thread_ids{};
+
+				for (std::size_t loop = 0; loop < 100; ++loop)
+				{
+					worker_threads.run(4, [&](std::size_t const task_index) -> void
+					{
+						++run_counts[task_index];
+						thread_ids[task_index] = std::this_thread::get_id();
+					});
+				}
+
+				THEN("Every task of every loop runs once, the first one on the calling thread")
+				{
+					CHECK(run_counts == std::array<std::size_t, 4>{ 100, 100, 100, 100 });
+					CHECK(thread_ids[0] == std::this_thread::get_id());
+					CHECK(thread_ids[1] != thread_ids[0]);
+					CHECK(thread_ids[2] != thread_ids[1]);
+					CHECK(thread_ids[3] != thread_ids[2]);
+				}
+			}
+
+			WHEN("A loop uses fewer tasks than threads")
+			{
+				std::array<std::size_t, 4> run_counts{};
+
+				worker_threads.run(2, [&](std::size_t const task_index) -> void
+				{
+					++run_counts[task_index];
+				});
+				worker_threads.run(0, [&](std::size_t const task_index) -> void
+				{
+					++run_counts[task_index];
+				});
+
+				THEN("Only those tasks run")
+				{
+					CHECK(run_counts == std::array<std::size_t, 4>{ 1, 1, 0, 0 });
+				}
+			}
+		}
+
+		GIVEN("Worker threads for a single thread")
+		{
+			Worker_threads worker_threads{ 1 };
+
+			WHEN("A loop is run")
+			{
+				std::thread::id thread_id{};
+
+				worker_threads.run(1, [&](std::size_t) -> void
+				{
+					thread_id = std::this_thread::get_id();
+				});
+
+				THEN("It runs on the calling thread")
+				{
+					CHECK(worker_threads.num_threads() == 1);
+					CHECK(thread_id == std::this_thread::get_id());
+				}
+			}
+		}
+	}
+}
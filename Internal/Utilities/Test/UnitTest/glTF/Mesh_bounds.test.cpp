@@ -0,0 +1,134 @@
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <Maia/Utilities/glTF/Mesh_bounds.hpp>
+
+namespace Maia::Utilities::Test
+{
+	namespace
+	{
+		template <std::size_t Count>
+		std::vector<std::byte> create_buffer_data(std::array<float, Count> const& values)
+		{
+			std::vector<std::byte> data(sizeof(values));
+			std::memcpy(data.data(), values.data(), sizeof(values));
+			return data;
+		}
+	}
+
+	SCENARIO("Calculate the bounds of positions", "[glTF][Mesh_bounds]")
+	{
+		using namespace Maia::Utilities::glTF;
+
+		GIVEN("Three tightly packed positions")
+		{
+			std::vector<std::byte> const data = create_buffer_data<9>(
+			{
+				1.0f, -2.0f, 3.0f,
+				-1.0f, 4.0f, 0.5f,
+				0.0f, 0.0f, -3.0f
+			});
+
+			WHEN("The positions are scanned")
+			{
+				Bounds const bounds = calculate_positions_bounds(data, 3, 3 * sizeof(float));
+
+				THEN("The bounds enclose every position")
+				{
+					CHECK(bounds == Bounds{ { -1.0f, -2.0f, -3.0f }, { 1.0f, 4.0f, 3.0f } });
+				}
+			}
+		}
+
+		GIVEN("Two positions interleaved with a 4th attribute value")
+		{
+			std::vector<std::byte> const data = create_buffer_data<8>(
+			{
+				1.0f, 2.0f, 3.0f, 100.0f,
+				-1.0f, -2.0f, -3.0f, -100.0f
+			});
+
+			WHEN("The positions are scanned with a stride of 16 bytes")
+			{
+				Bounds const bounds = calculate_positions_bounds(data, 2, 4 * sizeof(float));
+
+				THEN("The interleaved values are ignored")
+				{
+					CHECK(bounds == Bounds{ { -1.0f, -2.0f, -3.0f }, { 1.0f, 2.0f, 3.0f } });
+				}
+			}
+		}
+	}
+
+	SCENARIO("Calculate the bounds of a mesh", "[glTF][Mesh_bounds]")
+	{
+		using namespace Maia::Utilities::glTF;
+
+		GIVEN("A mesh with a primitive whose accessor has min and max and another whose accessor has not")
+		{
+			std::vector<std::byte> const data = create_buffer_data<6>(
+			{
+				5.0f, 0.0f, 0.0f,
+				4.0f, -6.0f, 1.0f
+			});
+
+			Gltf gltf;
+			gltf.buffers = std::vector<Buffer>{ Buffer{ {}, data.size() } };
+			gltf.buffer_views = std::vector<Buffer_view>{ Buffer_view{ 0, 0, data.size(), {} } };
+
+			Accessor accessor_with_bounds{};
+			accessor_with_bounds.component_type = Component_type::Float;
+			accessor_with_bounds.count = 8;
+			accessor_with_bounds.type = Accessor::Type::Vector3;
+			accessor_with_bounds.min = Eigen::Vector3f{ -1.0f, -1.0f, -1.0f };
+			accessor_with_bounds.max = Eigen::Vector3f{ 1.0f, 1.0f, 1.0f };
+
+			Accessor accessor_without_bounds{};
+			accessor_without_bounds.buffer_view_index = 0;
+			accessor_without_bounds.component_type = Component_type::Float;
+			accessor_without_bounds.count = 2;
+			accessor_without_bounds.type = Accessor::Type::Vector3;
+
+			gltf.accessors = std::vector<Accessor>{ accessor_with_bounds, accessor_without_bounds };
+
+			Mesh mesh;
+			mesh.primitives.push_back(Primitive{ { { "POSITION", 0 } }, {}, {} });
+			mesh.primitives.push_back(Primitive{ { { "POSITION", 1 } }, {}, {} });
+
+			THEN("The buffers data is required")
+			{
+				CHECK(requires_buffers_data(gltf, mesh));
+			}
+
+			WHEN("The bounds of the mesh are calculated")
+			{
+				std::array<std::vector<std::byte>, 1> const buffers_data{ data };
+
+				std::optional<Bounds> const bounds = calculate_mesh_bounds(gltf, mesh, buffers_data);
+
+				THEN("The bounds of both primitives are merged")
+				{
+					REQUIRE(bounds.has_value());
+					CHECK(*bounds == Bounds{ { -1.0f, -6.0f, -1.0f }, { 5.0f, 1.0f, 1.0f } });
+				}
+			}
+
+			WHEN("Only the primitive with min and max is kept")
+			{
+				mesh.primitives.pop_back();
+
+				THEN("The accessor bounds are used without buffers data")
+				{
+					CHECK(!requires_buffers_data(gltf, mesh));
+
+					std::optional<Bounds> const bounds = calculate_mesh_bounds(gltf, mesh, {});
+					REQUIRE(bounds.has_value());
+					CHECK(*bounds == Bounds{ { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } });
+				}
+			}
+		}
+	}
+}
@@ -1,9 +1,15 @@
 #include <array>
+#include <chrono>
 #include <iostream>
 #include <filesystem>
+#include <memory>
 
 #include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Systems/Spatial_sort_system.hpp>
 #include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/GameEngine/Systems/World_bounds_system.hpp>
+#include <Maia/Utilities/Allocators/Forward_allocator.hpp>
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
 #include <Maia/Utilities/glTF/gltf.hpp>
 
 #include "Camera.hpp"
@@ -13,7 +19,7 @@
 #include "Input_state.hpp"
 
 #include <Maia/GameEngine/Systems/Transform_system.hpp>
-#include "Render/D3D12/Render_system.hpp"
+#include "Render/IRender_system.hpp"
 #include "Transform_freely_system.hpp"
 #include <Components/Camera_component.hpp>
 
@@ -25,6 +31,24 @@ using namespace Maia::Mythology;
 
 namespace
 {
+	// Frame data is kept while the next frame is updated, so that it can still be read while rendering.
+	constexpr std::size_t c_num_frame_arenas = 2;
+	constexpr std::size_t c_frame_arena_block_size = 256 * 1024;
+
+	// Address space reserved for the component chunks of the scenes of a glTF file. Memory is committed as it is used.
+	constexpr std::size_t c_chunk_arena_reserved_size = 1024 * 1024 * 1024;
+
+	// Time spent per frame releasing the empty chunks of the current entity manager.
+	constexpr std::chrono::microseconds c_defragment_time_budget{ 100 };
+
+	// Entities moved per frame to keep the entities with a mesh sorted by their position.
+	constexpr std::size_t c_max_num_sort_swaps_per_frame = 64;
+
+	std::unique_ptr<Maia::Utilities::Virtual_memory_arena> create_chunk_arena()
+	{
+		return std::make_unique<Maia::Utilities::Virtual_memory_arena>(c_chunk_arena_reserved_size);
+	}
+
 	Maia::GameEngine::Entity create_camera_entity(Entity_manager& entity_manager)
 	{
 		Entity_type_id const entity_type_id = entity_manager.create_entity_type<
@@ -72,8 +96,9 @@ namespace
 		using namespace Maia::Mythology;
 
 		Maia::Mythology::Scenes_resources scenes_resources = {};
+		scenes_resources.chunk_arena = create_chunk_arena();
 
-		scenes_resources.entity_managers.emplace_back();
+		scenes_resources.entity_managers.emplace_back(scenes_resources.chunk_arena.get());
 
 		scenes_resources.scenes_entities.emplace_back();
 
@@ -129,18 +154,18 @@ namespace
 		return scenes_resources;
 	}
 
-	Maia::Mythology::Scenes_resources load_scenes(Maia::Mythology::D3D12::Load_scene_system& load_scene_system, std::filesystem::path const& gltf_file_path)
+	Maia::Mythology::Scenes_resources load_scenes(Maia::Mythology::IRender_system& render_system, std::filesystem::path const& gltf_file_path)
 	{
 		using namespace Maia::Mythology;
 		using namespace Maia::Utilities::glTF;
 
-		Maia::Utilities::glTF::Gltf const gltf = D3D12::read_gltf(gltf_file_path);
+		Maia::Utilities::glTF::Gltf const gltf = read_gltf(gltf_file_path);
 
-		D3D12::Scenes_resources scenes_resources =
-			load_scene_system.load(gltf);
+		Mesh_ID const first_mesh = render_system.load_meshes(gltf);
 
+		std::unique_ptr<Maia::Utilities::Virtual_memory_arena> chunk_arena = create_chunk_arena();
 		std::vector<Maia::GameEngine::Entity_manager> entity_managers;
-		std::vector<Maia::Mythology::D3D12::Scene_entities> scenes_entities;
+		std::vector<Maia::Mythology::Scene_entities> scenes_entities;
 		
 
 		if (gltf.scenes)
@@ -150,25 +175,28 @@ namespace
 
 			for (Maia::Utilities::glTF::Scene const& scene : *gltf.scenes)
 			{
-				Maia::GameEngine::Entity_manager entity_manager;
+				Maia::GameEngine::Entity_manager entity_manager{ chunk_arena.get() };
 
-				Maia::Mythology::D3D12::Scene_entities scene_entities =
-					D3D12::create_entities(gltf, scene, entity_manager);
+				Maia::Mythology::Scene_entities scene_entities =
+					create_entities(gltf, scene, entity_manager, first_mesh);
+
+				// The entities with a mesh are sorted by the position of their bounds, so that the entities that are
+				// culled and drawn together are close in memory
+				Transform_system{}.execute(entity_manager, scene_entities.transform_hierarchy);
+				World_bounds_system{}.execute(entity_manager);
+				Spatial_sort_system::sort(entity_manager, scene_entities.entity_types_with_mesh);
 
 				entity_managers.push_back(std::move(entity_manager));
 				scenes_entities.push_back(std::move(scene_entities));
 			}
 		}
 
-		load_scene_system.wait();
-
 		return
 		{
+			std::move(chunk_arena),
 			std::move(entity_managers),
 			std::move(scenes_entities),
-			0,
-			std::move(scenes_resources.geometry_resources),
-			std::move(scenes_resources.mesh_views)
+			0
 		};
 	}
 }
@@ -176,24 +204,33 @@ namespace
 namespace Maia::Mythology
 {
 	Application::Application(
-		std::unique_ptr<Maia::Mythology::D3D12::Load_scene_system> load_scene_system
+		Maia::Mythology::IRender_system& render_system
 	) :
-		m_load_scene_system{ std::move(load_scene_system) },
+		m_render_system{ render_system },
 		m_scene_being_loaded{},
-		m_scenes_resources{ create_default_scene() },
-		m_current_scenes_index{ 0 }
+		m_scenes_resources{},
+		m_current_scenes_index{ 0 },
+		m_frame_arenas{ c_num_frame_arenas, c_frame_arena_block_size }
 	{
+		// Entity managers cannot be copied, so the scene is not passed as an initializer list
+		m_scenes_resources.push_back(create_default_scene());
+
 		/*m_scene_being_loaded =
 			std::async(std::launch::deferred,
-				[&]() -> Scenes_resources { return load_scenes(*m_load_scene_system, L"box.gltf"); });
+				[&]() -> Scenes_resources { return load_scenes(m_render_system, L"box.gltf"); });
 
 		m_scenes_resources.push_back(m_scene_being_loaded->get());
 		m_scene_being_loaded = {};
 		m_current_scenes_index = m_scenes_resources.size() - 1;*/
 	}
 
+	void Application::load_scenes(std::filesystem::path const& gltf_file_path)
+	{
+		m_scenes_resources.push_back(::load_scenes(m_render_system, gltf_file_path));
+		set_current_scenes(m_scenes_resources.size() - 1);
+	}
+
 	void Application::run(
-		Maia::Mythology::D3D12::Render_system& render_system,
 		std::function<bool()> process_events,
 		Maia::Mythology::Input::IInput_system& input_system
 	)
@@ -213,6 +250,13 @@ namespace Maia::Mythology
 			previous_time_point = current_time_point;
 			lag += delta_time;
 
+			m_frame_arenas.begin_frame();
+			Maia::Utilities::get_thread_scratch_arena().reset();
+
+			{
+				Scenes_resources& scenes = m_scenes_resources[m_current_scenes_index];
+				scenes.entity_managers[scenes.current_scene_index].defragment(c_defragment_time_budget);
+			}
 
 			if (!process_events())
 				break;
@@ -227,7 +271,7 @@ namespace Maia::Mythology
 				lag -= fixed_update_duration;
 			}
 
-			render_update(render_system, duration<float>{ lag } / fixed_update_duration);
+			render_update(duration<float>{ lag } / fixed_update_duration);
 		}
 	}
 
@@ -238,7 +282,7 @@ namespace Maia::Mythology
 		{
 			m_scene_being_loaded =
 				std::async(std::launch::async,
-					[&]() -> Scenes_resources { return load_scenes(*m_load_scene_system, L"Resources/gizmo.gltf"); });
+					[&]() -> Scenes_resources { return ::load_scenes(m_render_system, L"Resources/gizmo.gltf"); });
 		}
 	}
 
@@ -253,7 +297,7 @@ namespace Maia::Mythology
 				m_scenes_resources.push_back(m_scene_being_loaded->get());
 				m_scene_being_loaded = {};
 
-				m_current_scenes_index = m_scenes_resources.size() - 1;
+				set_current_scenes(m_scenes_resources.size() - 1);
 			}
 		}
 
@@ -306,27 +350,77 @@ namespace Maia::Mythology
 		}
 	}
 
-	void Application::render_update(Maia::Mythology::D3D12::Render_system& render_system, float update_percentage)
+	void Application::set_current_scenes(std::size_t const scenes_index)
+	{
+		m_current_scenes_index = scenes_index;
+
+		m_spatial_sort_system.reset();
+		m_render_system.on_scene_changed();
+
+		{
+			Scenes_resources const& scenes = m_scenes_resources[m_current_scenes_index];
+			m_render_system.set_occluders(scenes.scenes_entities[scenes.current_scene_index].occluders);
+		}
+	}
+
+	void Application::render_update(float update_percentage)
 	{
 		using namespace Maia::GameEngine::Systems;
 
+		Maia::Utilities::Arena_vector<Entity> changed_entities{ Maia::Utilities::Forward_allocator<Entity>{ m_frame_arenas.current() } };
+
 		{
 			Scenes_resources& scenes = m_scenes_resources[m_current_scenes_index];
-			Transform_system{}.execute(scenes.entity_managers[scenes.current_scene_index]);
+			Entity_manager& entity_manager = scenes.entity_managers[scenes.current_scene_index];
+
+			Transform_system{}.execute(
+				entity_manager,
+				scenes.scenes_entities[scenes.current_scene_index].transform_hierarchy,
+				changed_entities
+			);
+
+			World_bounds_system{}.execute(entity_manager, changed_entities);
+
+			{
+				Scene_entities const& scene_entities = scenes.scenes_entities[scenes.current_scene_index];
+
+				m_spatial_sort_system.execute(entity_manager, scene_entities.entity_types_with_mesh, c_max_num_sort_swaps_per_frame);
+				Entity const camera_entity = scene_entities.cameras[0];
+
+				Maia::Utilities::glTF::Camera const camera =
+					entity_manager.get_component_data<Camera_component>(camera_entity).value;
+
+				// The projected size of orthographic cameras does not depend on the distance, so levels are kept as they are
+				if (camera.type == Maia::Utilities::glTF::Camera::Type::Perspective)
+				{
+					auto const& perspective = std::get<Maia::Utilities::glTF::Camera::Perspective>(camera.projection);
+
+					Eigen::Vector3f const camera_position =
+						entity_manager.get_component_data<Transform_matrix>(camera_entity).value.block<3, 1>(0, 3);
+
+					m_lod_selection_system.execute(
+						entity_manager,
+						scene_entities.entity_types_with_mesh,
+						scene_entities.entity_types_lod_groups,
+						camera_position,
+						Maia::GameEngine::Lod::calculate_projection_scale(perspective.vertical_field_of_view)
+					);
+				}
+			}
 		}
 
 		{
 			Scenes_resources const& scenes = m_scenes_resources[m_current_scenes_index];
 
 
-			D3D12::Scene_entities const& scene_entities = scenes.scenes_entities[scenes.current_scene_index];
+			Scene_entities const& scene_entities = scenes.scenes_entities[scenes.current_scene_index];
 
-			render_system.render_frame(
+			m_render_system.extract_frame(
 				scenes.entity_managers[scenes.current_scene_index],
 				scene_entities.cameras[0],
 				scene_entities.entity_types_with_mesh,
-				scene_entities.entity_types_mesh_indices,
-				scenes.mesh_views
+				scene_entities.entity_types_mesh_lods,
+				changed_entities
 			);
 		}
 	}
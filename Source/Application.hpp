@@ -2,6 +2,7 @@
 #define MAIA_MYTHOLOGY_APPLICATION_H_INCLUDED
 
 #include <cstddef>
+#include <filesystem>
 #include <functional>
 #include <future>
 #include <memory>
@@ -9,18 +10,18 @@
 #include <vector>
 
 #include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Systems/Lod_selection_system.hpp>
+#include <Maia/GameEngine/Systems/Spatial_sort_system.hpp>
+#include <Maia/Utilities/Allocators/Frame_arenas.hpp>
+#include <Maia/Utilities/Allocators/Virtual_memory_arena.hpp>
 
 #include <Game_clock.hpp>
 #include <Input_state_views.hpp>
-
-#include "Render/D3D12/Load_scene_system.hpp"
+#include <Scene_entities.hpp>
 
 namespace Maia::Mythology
 {
-	namespace D3D12
-	{
-		class Render_system;
-	}
+	class IRender_system;
 
 	namespace Input
 	{
@@ -29,12 +30,12 @@ namespace Maia::Mythology
 
 	struct Scenes_resources
 	{
+		// The component chunks of the entity managers are allocated contiguously from chunk_arena, which is declared
+		// first so that it outlives them.
+		std::unique_ptr<Maia::Utilities::Virtual_memory_arena> chunk_arena;
 		std::vector<Maia::GameEngine::Entity_manager> entity_managers;
-		std::vector<Maia::Mythology::D3D12::Scene_entities> scenes_entities;
+		std::vector<Maia::Mythology::Scene_entities> scenes_entities;
 		std::size_t current_scene_index{};
-
-		Maia::Mythology::D3D12::Geometry_resources geometry_resources{};
-		std::vector<Maia::Mythology::D3D12::Mesh_view> mesh_views{};
 	};
 
 	class Application
@@ -42,12 +43,14 @@ namespace Maia::Mythology
 	public:
 
 		explicit Application(
-			std::unique_ptr<Maia::Mythology::D3D12::Load_scene_system> load_scene_system
+			Maia::Mythology::IRender_system& render_system
 		);
 
+		// Loads the scenes of a glTF file and makes the first of them the current one.
+		void load_scenes(std::filesystem::path const& gltf_file_path);
+
 		// TODO pass all other systems that are platform specific through the application constructor or through here
 		void run(
-			Maia::Mythology::D3D12::Render_system& render_system,
 			std::function<bool()> process_events,
 			Maia::Mythology::Input::IInput_system& input_system
 		);
@@ -58,12 +61,18 @@ namespace Maia::Mythology
 		
 		void handle_input_events(Maia::Mythology::Input::Input_events_view input_events_view);
 		void fixed_update(Game_clock::duration delta_time, Maia::Mythology::Input::Input_state_view input_state_view);
-		void render_update(Maia::Mythology::D3D12::Render_system& render_system, float update_percentage);
+		void render_update(float update_percentage);
+
+		// Makes the scenes of m_scenes_resources[scenes_index] the current ones and passes their occluders to the render system.
+		void set_current_scenes(std::size_t scenes_index);
 
-		std::unique_ptr<Maia::Mythology::D3D12::Load_scene_system> m_load_scene_system;
+		Maia::Mythology::IRender_system& m_render_system;
 		std::optional<std::future<Scenes_resources>> m_scene_being_loaded;
 		std::vector<Scenes_resources> m_scenes_resources;
 		std::size_t m_current_scenes_index;
+		Maia::Utilities::Frame_arenas m_frame_arenas;
+		Maia::GameEngine::Systems::Lod_selection_system m_lod_selection_system;
+		Maia::GameEngine::Systems::Spatial_sort_system m_spatial_sort_system;
 
 	};
 
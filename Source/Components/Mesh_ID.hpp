@@ -2,6 +2,7 @@
 #define MYTHOLOGY_MESHID_H_INCLUDED
 
 #include <cstdint>
+#include <vector>
 
 namespace Maia::Mythology
 {
@@ -9,6 +10,12 @@ namespace Maia::Mythology
 	{
 		std::uint16_t value;
 	};
+
+	// Meshes of the levels of detail of an entity type, from the most detailed one.
+	struct Mesh_lods
+	{
+		std::vector<Mesh_ID> levels;
+	};
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+#include "Application.hpp"
+#include "Game_clock.hpp"
+#include "Game_key.hpp"
+#include "Heap_allocation_counter.hpp"
+#include "IInput_system.hpp"
+#include "Input_state.hpp"
+#include "Render/Null/Render_system.hpp"
+
+namespace
+{
+	// Holds the keys that turn the camera, so that the visible instances change between frames.
+	class Input_system final : public Maia::Mythology::Input::IInput_system
+	{
+	public:
+
+		Input_system()
+		{
+			m_input_state.keys_current_state.set(Maia::Mythology::Game_key::Rotate_positive_yaw, true);
+			m_input_state.keys_previous_state = m_input_state.keys_current_state;
+		}
+
+
+		Maia::Mythology::Input::Input_state const& execute() final
+		{
+			return m_input_state;
+		}
+
+
+	private:
+
+		Maia::Mythology::Input::Input_state m_input_state{};
+
+	};
+
+	void print_frame_time_statistics(std::vector<Maia::Mythology::Game_clock::duration> frame_times)
+	{
+		using Milliseconds = std::chrono::duration<double, std::milli>;
+
+		if (frame_times.empty())
+		{
+			return;
+		}
+
+		std::sort(frame_times.begin(), frame_times.end());
+
+		auto const percentile = [&frame_times](double const value) -> Milliseconds
+		{
+			std::size_t const index = static_cast<std::size_t>(value * (frame_times.size() - 1));
+			return frame_times[index];
+		};
+
+		Milliseconds const total = std::accumulate(frame_times.begin(), frame_times.end(), Maia::Mythology::Game_clock::duration{});
+
+		std::cout << "Frames: " << frame_times.size() << '\n';
+		std::cout << "Mean: " << total.count() / frame_times.size() << " ms\n";
+		std::cout << "Min: " << Milliseconds{ frame_times.front() }.count() << " ms\n";
+		std::cout << "Median: " << percentile(0.5).count() << " ms\n";
+		std::cout << "95th percentile: " << percentile(0.95).count() << " ms\n";
+		std::cout << "99th percentile: " << percentile(0.99).count() << " ms\n";
+		std::cout << "Max: " << Milliseconds{ frame_times.back() }.count() << " ms\n";
+	}
+}
+
+// Runs frames of a glTF scene without a window nor a GPU and reports their CPU time and the general heap allocations
+// of the second half of them.
+// Usage: MaiaMythologyHeadless [glTF file] [number of frames]
+// An empty glTF file runs the frames without loading a scene.
+int main(int const argc, char const* const* const argv)
+{
+	using namespace Maia::Mythology;
+
+	try
+	{
+		std::size_t const num_frames = argc > 2 ? std::stoul(argv[2]) : 1000;
+
+		// Shared by the parallel loops of every frame
+		Maia::Utilities::Worker_threads worker_threads{ std::max(std::thread::hardware_concurrency(), 1u) };
+
+		Null::Render_system render_system{ { 1280, 720 }, 3, worker_threads };
+		Input_system input_system;
+
+		Application application{ render_system };
+
+		if (argc > 1 && *argv[1] != '\0')
+		{
+			application.load_scenes(argv[1]);
+		}
+
+		std::vector<Game_clock::duration> frame_times;
+		frame_times.reserve(num_frames);
+
+		Game_clock::time_point previous_time_point{};
+
+		// The first frames grow the containers that the next ones reuse, so only the frames after them are expected
+		// not to allocate from the general heap
+		std::size_t const num_warm_up_frames = num_frames / 2;
+		std::size_t num_heap_allocations_after_warm_up = 0;
+
+		auto const process_events = [&]() -> bool
+		{
+			Game_clock::time_point const current_time_point{ Game_clock::now() };
+
+			if (previous_time_point != Game_clock::time_point{})
+			{
+				frame_times.push_back(current_time_point - previous_time_point);
+			}
+
+			previous_time_point = current_time_point;
+
+			if (frame_times.size() == num_warm_up_frames)
+			{
+				num_heap_allocations_after_warm_up = get_num_heap_allocations();
+			}
+
+			return frame_times.size() < num_frames;
+		};
+
+		application.run(process_events, input_system);
+		render_system.wait();
+
+		std::size_t const num_steady_state_heap_allocations = get_num_heap_allocations() - num_heap_allocations_after_warm_up;
+
+		print_frame_time_statistics(std::move(frame_times));
+
+		Null::Frame_statistics const& frame_statistics = render_system.get_last_frame_statistics();
+		std::cout << "Last frame: " << frame_statistics.draw_count << " draws, " << frame_statistics.instance_count << " instances, " << frame_statistics.uploaded_bytes << " uploaded bytes, " << frame_statistics.geometry_bytes << " geometry bytes\n";
+		std::cout << "Steady state heap allocations: " << num_steady_state_heap_allocations << '\n';
+	}
+	catch (std::exception const& error)
+	{
+		std::cerr << error.what() << '\n';
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include "Heap_allocation_counter.hpp"
+
+namespace
+{
+	std::atomic<std::size_t> g_num_heap_allocations{ 0 };
+
+	void* allocate(std::size_t const size_in_bytes) noexcept
+	{
+		++g_num_heap_allocations;
+
+		return std::malloc(size_in_bytes != 0 ? size_in_bytes : 1);
+	}
+
+	void* allocate(std::size_t const size_in_bytes, std::align_val_t const alignment) noexcept
+	{
+		++g_num_heap_allocations;
+
+		std::size_t const alignment_in_bytes = static_cast<std::size_t>(alignment);
+
+#if defined(_WIN32)
+		return _aligned_malloc(size_in_bytes != 0 ? size_in_bytes : 1, alignment_in_bytes);
+#else
+		// aligned_alloc requires a size that is a multiple of the alignment
+		std::size_t const aligned_size = ((size_in_bytes + alignment_in_bytes - 1) / alignment_in_bytes) * alignment_in_bytes;
+		return std::aligned_alloc(alignment_in_bytes, aligned_size != 0 ? aligned_size : alignment_in_bytes);
+#endif
+	}
+
+	void deallocate(void* const data, std::align_val_t) noexcept
+	{
+#if defined(_WIN32)
+		_aligned_free(data);
+#else
+		std::free(data);
+#endif
+	}
+}
+
+namespace Maia::Mythology
+{
+	std::size_t get_num_heap_allocations() noexcept
+	{
+		return g_num_heap_allocations;
+	}
+}
+
+// The array versions call these, so they are counted too.
+void* operator new(std::size_t const size_in_bytes)
+{
+	if (void* const data = allocate(size_in_bytes))
+	{
+		return data;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t const size_in_bytes, std::nothrow_t const&) noexcept
+{
+	return allocate(size_in_bytes);
+}
+
+void* operator new(std::size_t const size_in_bytes, std::align_val_t const alignment)
+{
+	if (void* const data = allocate(size_in_bytes, alignment))
+	{
+		return data;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t const size_in_bytes, std::align_val_t const alignment, std::nothrow_t const&) noexcept
+{
+	return allocate(size_in_bytes, alignment);
+}
+
+void operator delete(void* const data) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::size_t) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::nothrow_t const&) noexcept
+{
+	std::free(data);
+}
+
+void operator delete(void* const data, std::align_val_t const alignment) noexcept
+{
+	deallocate(data, alignment);
+}
+
+void operator delete(void* const data, std::size_t, std::align_val_t const alignment) noexcept
+{
+	deallocate(data, alignment);
+}
+
+void operator delete(void* const data, std::align_val_t const alignment, std::nothrow_t const&) noexcept
+{
+	deallocate(data, alignment);
+}
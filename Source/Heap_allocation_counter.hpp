@@ -0,0 +1,13 @@
+#ifndef MAIA_MYTHOLOGY_HEAPALLOCATIONCOUNTER_H_INCLUDED
+#define MAIA_MYTHOLOGY_HEAPALLOCATIONCOUNTER_H_INCLUDED
+
+#include <cstddef>
+
+namespace Maia::Mythology
+{
+	// Number of general heap allocations since the start of the program, counted by the replacements of the global
+	// operator new in Heap_allocation_counter.cpp. Only the executables that compile that file count them.
+	std::size_t get_num_heap_allocations() noexcept;
+}
+
+#endif
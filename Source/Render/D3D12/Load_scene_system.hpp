@@ -1,26 +1,20 @@
 #ifndef MAIA_MYTHOLOGY_LOADSCENESYSTEM_H_INCLUDED
 #define MAIA_MYTHOLOGY_LOADSCENESYSTEM_H_INCLUDED
 
-#include <filesystem>
 #include <utility>
 #include <vector>
 
-#include <Maia/GameEngine/Systems/Transform_system.hpp>
-
+#include <Maia/Renderer/Geometry_pool.hpp>
 #include <Maia/Utilities/glTF/gltf.hpp>
 
-#include <Components/Camera_component.hpp>
-
 #include "Render_data.hpp"
-#include "Components/Mesh_ID.hpp"
 
 namespace Maia::Mythology::D3D12
 {
+	// Buffers of a glTF, suballocated from the geometry buffers of the Load_scene_system.
 	struct Geometry_resources
 	{
-		winrt::com_ptr<ID3D12Heap> heap;
-		Geometry_buffer buffer;
-		std::vector<UINT64> offsets;
+		std::vector<Maia::Renderer::Geometry_allocation> allocations;
 	};
 
 	// TODO rename
@@ -31,51 +25,36 @@ namespace Maia::Mythology::D3D12
 	};
 
 
-	Maia::Utilities::glTF::Gltf read_gltf(std::filesystem::path const& gltf_file_path);
-
 	class Load_scene_system
 	{
 	public:
 
-		explicit Load_scene_system(ID3D12Device& device);
+		explicit Load_scene_system(ID3D12Device& device, UINT64 geometry_buffer_size = 64 * 1024 * 1024);
 
 
 		Scenes_resources load(Maia::Utilities::glTF::Gltf const& gltf);
 
 		void wait();
 
+		// The geometry is reused by later loads once last_used_fence_value is passed to release_unloaded.
+		void unload(Geometry_resources const& geometry_resources, UINT64 last_used_fence_value);
+
+		void release_unloaded(UINT64 completed_fence_value);
+
 	private:
 
 		ID3D12Device& m_device;
 		winrt::com_ptr<ID3D12CommandQueue> m_command_queue;
 		winrt::com_ptr<ID3D12CommandAllocator> m_command_allocator;
 		winrt::com_ptr<ID3D12GraphicsCommandList> m_command_list;
-		winrt::com_ptr<ID3D12Heap> m_upload_heap;
-		winrt::com_ptr<ID3D12Resource> m_upload_buffer;
+		Maia::Renderer::Geometry_pool m_geometry_pool;
+		std::vector<Placed_buffer> m_geometry_buffers;
+		std::vector<Placed_buffer> m_pending_upload_buffers;
 		UINT64 m_fence_value;
 		winrt::com_ptr<ID3D12Fence> m_fence;
 		winrt::handle m_fence_event;
 
 	};
-
-
-	struct Scene_entities
-	{
-		std::vector<Maia::GameEngine::Entity> cameras;
-
-		std::vector<Maia::GameEngine::Entity_type_id> entity_types_with_mesh;
-		std::vector<Maia::Mythology::Mesh_ID> entity_types_mesh_indices;
-	};
-
-	Scene_entities create_entities(
-		Maia::Utilities::glTF::Gltf const& gltf,
-		Maia::Utilities::glTF::Scene const& scene,
-		Maia::GameEngine::Entity_manager& entity_manager
-	);
-	void destroy_entities(
-		Maia::GameEngine::Entity_manager& entity_manager
-		// TODO entity types
-	);
 }
 
 #endif
\ No newline at end of file
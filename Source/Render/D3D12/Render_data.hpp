@@ -27,6 +27,13 @@ namespace Maia::Mythology::D3D12
 		winrt::com_ptr<ID3D12Resource> value;
 	};
 
+	// Buffer placed at the start of its own heap.
+	struct Placed_buffer
+	{
+		winrt::com_ptr<ID3D12Heap> heap;
+		winrt::com_ptr<ID3D12Resource> value;
+	};
+
 	struct Instance_count
 	{
 		UINT value;
@@ -1,14 +1,16 @@
+#include <algorithm>
+#include <cassert>
 #include <iostream>
 
+#include <gsl/gsl>
+
 #include <Maia/GameEngine/Component_group.hpp>
 #include <Maia/GameEngine/Entity_manager.hpp>
 #include <Maia/GameEngine/Entity_type.hpp>
 
 #include <Maia/Renderer/D3D12/Utilities/Check_hresult.hpp>
 #include <Maia/Renderer/D3D12/Utilities/D3D12_utilities.hpp>
-#include <Maia/Renderer/Matrices.hpp>
 
-#include <Components/Camera_component.hpp>
 #include <Render/Pass_data.hpp>
 
 #include "Render_system.hpp"
@@ -21,59 +23,12 @@ namespace Maia::Mythology::D3D12
 {
 	namespace
 	{
-		std::size_t calculate_instance_buffer_size(
-			Maia::GameEngine::Entity_manager const& entity_manager,
-			gsl::span<Maia::GameEngine::Entity_type_id const> const entity_types_ids
-		)
+		Placed_buffer create_placed_buffer(ID3D12Device& device, UINT64 const size)
 		{
-			using namespace Maia::GameEngine;
-
-			std::size_t count{ 0 };
-
-			for (Maia::GameEngine::Entity_type_id const entity_type_id : entity_types_ids)
-			{
-				Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
-
-				count += component_group.size();
-			}
-
-			std::size_t const unaligned_size_in_bytes = count * sizeof(Instance_data);
-			std::size_t constexpr alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+			winrt::com_ptr<ID3D12Heap> heap = create_buffer_heap(device, size);
+			winrt::com_ptr<ID3D12Resource> buffer = create_buffer(device, *heap, 0, size, D3D12_RESOURCE_STATE_COMMON);
 
-			std::size_t const num_blocks = unaligned_size_in_bytes / alignment
-				+ (unaligned_size_in_bytes % alignment == 0 ? 0 : 1);
-
-			return num_blocks * alignment;
-		}
-
-		std::vector<Instance_buffer> create_instance_buffers(
-			ID3D12Device& device,
-			ID3D12Heap& heap, UINT64 const heap_offset,
-			UINT64 const size,
-			std::size_t const count
-		)
-		{
-			std::vector<Instance_buffer> instance_buffers;
-			instance_buffers.reserve(count);
-
-			for (std::size_t index = 0; index < count; ++index)
-			{
-				const UINT64 current_heap_offset = heap_offset +
-					index * size;
-
-				instance_buffers.push_back(
-					{
-						create_buffer(
-							device,
-							heap, current_heap_offset,
-							size,
-							D3D12_RESOURCE_STATE_COMMON
-						)
-					}
-				);
-			}
-
-			return instance_buffers;
+			return { std::move(heap), std::move(buffer) };
 		}
 	}
 
@@ -83,7 +38,8 @@ namespace Maia::Mythology::D3D12
 		ID3D12CommandQueue& direct_command_queue,
 		Swap_chain swap_chain,
 		std::uint8_t const pipeline_length,
-		bool const vertical_sync
+		bool const vertical_sync,
+		Maia::Utilities::Worker_threads& worker_threads
 	) :
 		m_device{ device },
 		m_copy_command_queue{ copy_command_queue },
@@ -93,9 +49,15 @@ namespace Maia::Mythology::D3D12
 		m_pipeline_length{ pipeline_length },
 		m_vertical_sync{ vertical_sync },
 		m_window_size{ swap_chain.bounds },
+		m_swap_chain_size{ swap_chain.bounds },
 		m_copy_fence_value{ 0 },
 		m_copy_fence{ create_fence(device, m_copy_fence_value, D3D12_FENCE_FLAG_NONE) },
 
+		m_load_scene_system{ device },
+
+		m_frame_extraction_system{ worker_threads },
+		m_extracted_frames{ 0 },
+
 		m_upload_frame_data_system{ device, m_pipeline_length },
 		m_renderer{ device, swap_chain.bounds, m_pipeline_length },
 		m_frames_resources{ device, m_pipeline_length },
@@ -104,11 +66,9 @@ namespace Maia::Mythology::D3D12
 		m_fence{ create_fence(device, m_submitted_frames, D3D12_FENCE_FLAG_NONE) },
 		m_fence_event{ ::CreateEvent(nullptr, false, false, nullptr) },
 
-		m_pass_heap{ create_buffer_heap(device, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT) },
-		m_pass_buffer{ create_buffer(device, *m_pass_heap, 0, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, D3D12_RESOURCE_STATE_COMMON) },
-
-		m_instance_buffers_heap{ create_buffer_heap(device, m_pipeline_length * D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT) },
-		m_instance_buffer_per_frame{ create_instance_buffers(device, *m_instance_buffers_heap, 0, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT, m_pipeline_length) }
+		m_pass_buffer{ D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT },
+		m_instance_slot_buffer_per_frame(m_pipeline_length, Maia::Renderer::Growable_buffer<Placed_buffer>{ D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT }),
+		m_resident_instance_buffer{ D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT }
 	{
 		create_swap_chain_rtvs(
 			device,
@@ -118,6 +78,8 @@ namespace Maia::Mythology::D3D12
 			m_pipeline_length
 		);
 
+		m_render_thread = std::thread{ [this]() -> void { render_frames(); } };
+
 		/*m_scene_resources = Maia::Mythology::load(m_entity_manager, *m_render_resources);
 		m_scene_resources.camera.width_by_height_ratio = bounds.Width / bounds.Height;*/
 
@@ -164,116 +126,167 @@ namespace Maia::Mythology::D3D12
 				0.0f, 0.0f, 0.0f, 1.0f;
 			return value;
 		}
+
+		// Splits the instance buffer view of the sorted instances in one view per draw.
+		void create_batch_draws(
+			gsl::span<Maia::Renderer::Instanced_draw const> const draws,
+			D3D12_VERTEX_BUFFER_VIEW const& sorted_instances_view,
+			std::vector<D3D12_VERTEX_BUFFER_VIEW>& instance_buffer_views,
+			std::vector<Mesh_ID>& mesh_indices
+		)
+		{
+			using namespace Maia::Renderer;
+
+			instance_buffer_views.clear();
+			mesh_indices.clear();
+
+			for (Instanced_draw const& draw : draws)
+			{
+				D3D12_VERTEX_BUFFER_VIEW view = sorted_instances_view;
+				view.BufferLocation += UINT64{ draw.first_instance } * view.StrideInBytes;
+				view.SizeInBytes = draw.instance_count * view.StrideInBytes;
+
+				instance_buffer_views.push_back(view);
+				mesh_indices.push_back({ draw.mesh });
+			}
+		}
+	}
+
+	Render_system::~Render_system()
+	{
+		if (m_render_thread.joinable())
+		{
+			m_frame_packets.close();
+			m_render_thread.join();
+		}
 	}
 
-	void Render_system::render_frame(
+	Mesh_ID Render_system::load_meshes(Maia::Utilities::glTF::Gltf const& gltf)
+	{
+		Scenes_resources scenes_resources = [this, &gltf]() -> Scenes_resources
+		{
+			std::lock_guard<std::mutex> lock{ m_load_mutex };
+
+			m_load_scene_system.release_unloaded(m_fence->GetCompletedValue());
+
+			Scenes_resources scenes_resources = m_load_scene_system.load(gltf);
+			m_load_scene_system.wait();
+
+			return scenes_resources;
+		}();
+
+		std::lock_guard<std::mutex> lock{ m_mesh_views_mutex };
+
+		Mesh_ID const first_mesh{ gsl::narrow_cast<std::uint16_t>(m_mesh_views.size()) };
+
+		m_loaded_meshes.push_back({ first_mesh, scenes_resources.mesh_views.size(), std::move(scenes_resources.geometry_resources) });
+		m_mesh_views.insert(m_mesh_views.end(), scenes_resources.mesh_views.begin(), scenes_resources.mesh_views.end());
+
+		return first_mesh;
+	}
+
+	void Render_system::unload_meshes(Mesh_ID const first_mesh)
+	{
+		Geometry_resources geometry_resources = [this, first_mesh]() -> Geometry_resources
+		{
+			std::lock_guard<std::mutex> lock{ m_mesh_views_mutex };
+
+			auto const loaded_meshes = std::find_if(m_loaded_meshes.begin(), m_loaded_meshes.end(), [first_mesh](Loaded_meshes const& loaded_meshes) -> bool
+			{
+				return loaded_meshes.first_mesh.value == first_mesh.value;
+			});
+			assert(loaded_meshes != m_loaded_meshes.end());
+
+			std::fill_n(m_mesh_views.begin() + first_mesh.value, loaded_meshes->num_meshes, Mesh_view{});
+
+			Geometry_resources geometry_resources = std::move(loaded_meshes->geometry_resources);
+			m_loaded_meshes.erase(loaded_meshes);
+
+			return geometry_resources;
+		}();
+
+		// The frame with number n signals n + 1, so the last extracted frame signals m_extracted_frames
+		std::lock_guard<std::mutex> lock{ m_load_mutex };
+		m_load_scene_system.unload(geometry_resources, m_extracted_frames);
+	}
+
+	void Render_system::extract_frame(
 		Maia::GameEngine::Entity_manager const& entity_manager,
 		Maia::GameEngine::Entity const camera_entity,
 		gsl::span<Maia::GameEngine::Entity_type_id const> const entity_types_with_mesh,
-		gsl::span<Mesh_ID const> const entity_types_mesh_indices,
-		gsl::span<Maia::Mythology::D3D12::Mesh_view const> const mesh_views
+		gsl::span<Mesh_lods const> const entity_types_mesh_lods,
+		gsl::span<Maia::GameEngine::Entity const> const changed_entities
 	)
 	{
-		assert(entity_types_with_mesh.size() == entity_types_mesh_indices.size());
+		assert(m_render_thread.joinable());
 
-		std::uint8_t const current_frame_index{ m_submitted_frames % m_pipeline_length };
+		Frame_packet& frame_packet = m_frame_packets.get_write_packet();
+		frame_packet.scene.frame_number = m_extracted_frames++;
+		frame_packet.window_size = m_window_size;
 
 		{
-			// TODO check if it is needed to create new instance buffers
+			std::lock_guard<std::mutex> lock{ m_mesh_views_mutex };
+			frame_packet.mesh_views.assign(m_mesh_views.begin(), m_mesh_views.end());
 		}
 
-		if (m_submitted_frames >= m_pipeline_length)
+		m_frame_extraction_system.execute(
+			entity_manager,
+			camera_entity,
+			entity_types_with_mesh,
+			entity_types_mesh_lods,
+			changed_entities,
+			m_window_size,
+			to_api_specific_perspective_matrix(),
+			frame_packet.scene
+		);
+
+		m_frame_packets.wait_until_acquired();
+		m_frame_packets.publish();
+	}
+
+	void Render_system::render_frames()
+	{
+		while (Frame_packet const* const frame_packet = m_frame_packets.acquire())
 		{
-			// TODO return to do other cpu work instead of waiting
+			if (frame_packet->window_size != m_swap_chain_size)
+			{
+				resize(frame_packet->window_size);
+			}
 
+			render_frame(*frame_packet);
+		}
+	}
+
+	void Render_system::render_frame(Frame_packet const& frame_packet)
+	{
+		std::uint8_t const current_frame_index{ m_submitted_frames % m_pipeline_length };
+
+		if (m_submitted_frames >= m_pipeline_length)
+		{
 			UINT64 const event_value_to_wait = m_submitted_frames - m_pipeline_length + 1;
 
 			Maia::Renderer::D3D12::wait(
 				m_direct_command_queue, *m_fence, m_fence_event.get(), event_value_to_wait, INFINITE);
 		}
 
-		std::vector<D3D12_VERTEX_BUFFER_VIEW> instance_buffer_views;
-		{
-			Upload_bundle bundle =
-				m_upload_frame_data_system.reset(current_frame_index);
+		UINT64 const completed_fence_value = m_fence->GetCompletedValue();
 
+		m_pass_buffer.release_retired_buffers(completed_fence_value);
+		m_instance_slot_buffer_per_frame[current_frame_index].release_retired_buffers(completed_fence_value);
+		m_resident_instance_buffer.release_retired_buffers(completed_fence_value);
 
-			{
-				using namespace Maia::GameEngine::Systems;
-				using namespace Maia::Renderer;
-				using namespace Maia::Utilities::glTF;
+		reserve_buffers(frame_packet, current_frame_index);
 
-				
+		{
+			Upload_bundle bundle =
+				m_upload_frame_data_system.reset(current_frame_index, completed_fence_value);
 
+			{
 				Pass_data pass_data;
+				pass_data.view_matrix = frame_packet.scene.view_matrix;
+				pass_data.projection_matrix = frame_packet.scene.projection_matrix;
 
-				{
-					// TODO problem with camera. Upside down.
-
-					Transform_matrix const camera_transform =
-						entity_manager.get_component_data<Transform_matrix>(camera_entity);
-
-					pass_data.view_matrix = camera_transform.value.inverse();
-				}
-
-				{
-					Maia::Utilities::glTF::Camera const camera =
-						entity_manager.get_component_data<Camera_component>(camera_entity).value;
-
-					if (camera.type == Maia::Utilities::glTF::Camera::Type::Orthographic)
-					{
-						const auto& orthographic = std::get<Maia::Utilities::glTF::Camera::Orthographic>(camera.projection);
-
-						pass_data.projection_matrix =
-							to_api_specific_perspective_matrix() *
-							create_orthographic_projection_matrix(
-								orthographic.horizontal_magnification,
-								orthographic.vertical_magnification,
-								orthographic.near_z,
-								orthographic.far_z
-							);
-					}
-					else
-					{
-						const auto& perspective = std::get<Maia::Utilities::glTF::Camera::Perspective>(camera.projection);
-
-						float const aspect_ratio = [this, &perspective]() -> float
-						{
-							if (perspective.aspect_ratio)
-							{
-								return *perspective.aspect_ratio;
-							}
-							else
-							{
-								return static_cast<float>(m_window_size(0)) / m_window_size(1);
-							}
-						}();
-
-						if (perspective.far_z)
-						{
-							pass_data.projection_matrix =
-								to_api_specific_perspective_matrix() *
-								create_finite_perspective_projection_matrix(
-									aspect_ratio,
-									perspective.vertical_field_of_view,
-									perspective.near_z,
-									*perspective.far_z
-								);
-						}
-						else
-						{
-							pass_data.projection_matrix =
-								to_api_specific_perspective_matrix() *
-								create_infinite_perspective_projection_matrix(
-									aspect_ratio,
-									perspective.vertical_field_of_view,
-									perspective.near_z
-								);
-						}
-					}
-				}
-
-				ID3D12Resource& pass_buffer = *m_pass_buffer;
+				ID3D12Resource& pass_buffer = *m_pass_buffer.get().value;
 				m_upload_frame_data_system.upload_pass_data(
 					bundle,
 					pass_data,
@@ -281,27 +294,40 @@ namespace Maia::Mythology::D3D12
 				);
 			}
 
+			m_upload_frame_data_system.upload_instance_transforms(
+				bundle,
+				*m_resident_instance_buffer.get().value,
+				frame_packet.scene.updated_slot_ranges,
+				frame_packet.scene.updated_transforms
+			);
 
-			Instance_buffer const& instance_buffer =
-				m_instance_buffer_per_frame[current_frame_index];
-
-			instance_buffer_views =
-				m_upload_frame_data_system.upload_instance_data(
+			D3D12_VERTEX_BUFFER_VIEW const sorted_instances_view =
+				m_upload_frame_data_system.upload_instance_slots(
 					bundle,
-					instance_buffer, 0,
-					entity_manager,
-					entity_types_with_mesh
+					*m_instance_slot_buffer_per_frame[current_frame_index].get().value, 0,
+					frame_packet.scene.instance_slots
 				);
 
+			create_batch_draws(
+				frame_packet.scene.draws,
+				sorted_instances_view,
+				m_instance_buffer_views,
+				m_instance_buffer_mesh_indices
+			);
+
 			{
 				ID3D12CommandList& command_list =
-					m_upload_frame_data_system.close(bundle);
+					m_upload_frame_data_system.close(bundle, m_submitted_frames + 1);
 
 				std::array<ID3D12CommandList*, 1> command_lists_to_execute
 				{
 					&command_list
 				};
 
+				// The resident instance buffer is shared by all frames, so it is only written after the previous
+				// frame has finished reading it
+				m_copy_command_queue.Wait(m_fence.get(), m_submitted_frames);
+
 				m_copy_command_queue.ExecuteCommandLists(
 					static_cast<UINT>(command_lists_to_execute.size()), command_lists_to_execute.data()
 				);
@@ -333,16 +359,17 @@ namespace Maia::Mythology::D3D12
 
 			{
 				D3D12_GPU_VIRTUAL_ADDRESS const pass_data_buffer_address =
-					m_pass_buffer->GetGPUVirtualAddress() + current_frame_index * align(sizeof(Pass_data), 256);
+					m_pass_buffer.get().value->GetGPUVirtualAddress() + current_frame_index * align(sizeof(Pass_data), 256);
 
 				ID3D12CommandList& command_list =
 					m_renderer.render(
 						current_frame_index,
 						*back_buffer, render_target_descriptor_handle,
-						instance_buffer_views,
-						entity_types_mesh_indices,
-						mesh_views,
-						pass_data_buffer_address
+						m_instance_buffer_views,
+						m_instance_buffer_mesh_indices,
+						frame_packet.mesh_views,
+						pass_data_buffer_address,
+						m_resident_instance_buffer.get().value->GetGPUVirtualAddress()
 					);
 
 				std::array<ID3D12CommandList*, 1> command_lists_to_execute
@@ -372,15 +399,57 @@ namespace Maia::Mythology::D3D12
 		}
 	}
 
+	void Render_system::reserve_buffers(Frame_packet const& frame_packet, std::uint8_t const frame_index)
+	{
+		// The last submitted frame is the last one that can use the current buffers
+		UINT64 const last_used_fence_value = m_submitted_frames;
+
+		auto const create_buffer = [this](std::uint64_t const capacity) -> Placed_buffer
+		{
+			return create_placed_buffer(m_device, capacity);
+		};
+
+		m_pass_buffer.reserve(
+			m_pipeline_length * align(sizeof(Pass_data), 256),
+			last_used_fence_value,
+			create_buffer
+		);
+
+		m_instance_slot_buffer_per_frame[frame_index].reserve(
+			frame_packet.scene.instance_slots.size() * sizeof(std::uint32_t),
+			last_used_fence_value,
+			create_buffer
+		);
+
+		// The frame packet uploads every slot when the slot capacity grows, so the contents of a new buffer are restored
+		m_resident_instance_buffer.reserve(
+			std::uint64_t{ frame_packet.scene.instance_slot_capacity } * sizeof(Instance_data),
+			last_used_fence_value,
+			create_buffer
+		);
+	}
+
 	void Render_system::wait()
 	{
+		if (m_render_thread.joinable())
+		{
+			m_frame_packets.close();
+			m_render_thread.join();
+		}
+
 		UINT64 const event_value_to_signal_and_wait = m_submitted_frames + m_pipeline_length;
 		signal_and_wait(m_direct_command_queue, *m_fence, m_fence_event.get(), event_value_to_signal_and_wait, INFINITE);
 	}
 
 	void Render_system::on_window_resized(Eigen::Vector2i new_size)
 	{
-		wait();
+		m_window_size = new_size;
+	}
+
+	void Render_system::resize(Eigen::Vector2i new_size)
+	{
+		UINT64 const event_value_to_signal_and_wait = m_submitted_frames + m_pipeline_length;
+		signal_and_wait(m_direct_command_queue, *m_fence, m_fence_event.get(), event_value_to_signal_and_wait, INFINITE);
 
 		{
 			ID3D12CommandQueue& command_queue = m_direct_command_queue;
@@ -398,10 +467,18 @@ namespace Maia::Mythology::D3D12
 			);
 		}
 
-		m_window_size = new_size;
+		m_swap_chain_size = new_size;
 
 		m_renderer.resize_viewport_and_scissor_rects(new_size);
+	}
 
-		//m_scene_resources.camera.width_by_height_ratio = size.Width / size.Height;
+	void Render_system::set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders)
+	{
+		m_frame_extraction_system.set_occluders(std::move(occluders));
+	}
+
+	void Render_system::on_scene_changed()
+	{
+		m_frame_extraction_system.reset();
 	}
 }
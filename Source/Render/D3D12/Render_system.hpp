@@ -1,6 +1,17 @@
 #ifndef MAIA_MYTHOLOGY_D3D12_RENDERSYSTEM_H_INCLUDED
 #define MAIA_MYTHOLOGY_D3D12_RENDERSYSTEM_H_INCLUDED
 
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Maia/Renderer/Frame_packet.hpp>
+#include <Maia/Renderer/Growable_buffer.hpp>
+
+#include <Render/Frame_extraction_system.hpp>
+#include <Render/IRender_system.hpp>
+
+#include "Load_scene_system.hpp"
 #include "Render_data.hpp"
 #include "Renderer.hpp"
 #include "Components/Mesh_ID.hpp"
@@ -25,7 +36,17 @@ namespace Maia::Mythology::D3D12
 		Eigen::Vector2i bounds;
 	};
 
-	class Render_system
+	// Everything that the render thread reads of a frame.
+	struct Frame_packet
+	{
+		Maia::Renderer::Frame_packet scene;
+		std::vector<Maia::Mythology::D3D12::Mesh_view> mesh_views;
+		Eigen::Vector2i window_size;
+	};
+
+	// Frames are extracted on the calling thread and rendered on a render thread, so that the next frame can be
+	// simulated while the current one is recorded and submitted.
+	class Render_system final : public Maia::Mythology::IRender_system
 	{
 	public:
 
@@ -35,25 +56,64 @@ namespace Maia::Mythology::D3D12
 			ID3D12CommandQueue& direct_command_queue, 
 			Swap_chain window,
 			std::uint8_t pipeline_length,
-			bool vertical_sync
+			bool vertical_sync,
+			Maia::Utilities::Worker_threads& worker_threads
 		);
+		Render_system(Render_system const&) = delete;
+		Render_system(Render_system&&) = delete;
+		~Render_system();
 
+		Render_system& operator=(Render_system const&) = delete;
+		Render_system& operator=(Render_system&&) = delete;
 
-		void render_frame(
+
+		Mesh_ID load_meshes(Maia::Utilities::glTF::Gltf const& gltf) final;
+
+		// The mesh views are cleared at once and the geometry is reused once the extracted frames are rendered.
+		void unload_meshes(Mesh_ID first_mesh) final;
+
+		// Copies the data needed to render the visible instances into a frame packet and hands it to the render thread.
+		// Waits until the render thread has acquired the previous packet.
+		void extract_frame(
 			Maia::GameEngine::Entity_manager const& entity_manager,
-			Maia::GameEngine::Entity const camera_entity,
+			Maia::GameEngine::Entity camera_entity,
 			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_with_mesh,
-			gsl::span<Mesh_ID const> entity_type_mesh_indices,
-			gsl::span<Maia::Mythology::D3D12::Mesh_view const> mesh_views
-		);
+			gsl::span<Mesh_lods const> entity_types_mesh_lods,
+			gsl::span<Maia::GameEngine::Entity const> changed_entities
+		) final;
+
+		// Stops the render thread and waits for the GPU.
+		void wait() final;
+
+		// The swap chain is resized by the render thread before it renders the next extracted frame.
+		void on_window_resized(Eigen::Vector2i new_size) final;
 
-		void wait();
+		// World space occluders whose hidden instances are not uploaded nor drawn.
+		void set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders) final;
 
-		void on_window_resized(Eigen::Vector2i new_size);
+		void on_scene_changed() final;
 
 
 	private:
 
+		struct Loaded_meshes
+		{
+			Mesh_ID first_mesh;
+			std::size_t num_meshes;
+			Geometry_resources geometry_resources;
+		};
+
+
+		void render_frames();
+
+		void render_frame(Frame_packet const& frame_packet);
+
+		void resize(Eigen::Vector2i new_size);
+
+		// Makes the buffers large enough for frame_packet.
+		void reserve_buffers(Frame_packet const& frame_packet, std::uint8_t frame_index);
+
+
 		ID3D12Device& m_device;
 		ID3D12CommandQueue& m_copy_command_queue;
 		ID3D12CommandQueue& m_direct_command_queue;
@@ -62,9 +122,20 @@ namespace Maia::Mythology::D3D12
 		std::uint8_t const m_pipeline_length;
 		bool const m_vertical_sync;
 		Eigen::Vector2i m_window_size;
+		Eigen::Vector2i m_swap_chain_size;
 		UINT64 m_copy_fence_value;
 		winrt::com_ptr<ID3D12Fence> m_copy_fence;
 
+		Maia::Mythology::D3D12::Load_scene_system m_load_scene_system;
+		std::mutex m_load_mutex;
+		std::vector<Loaded_meshes> m_loaded_meshes;
+		std::vector<Mesh_view> m_mesh_views;
+		std::mutex m_mesh_views_mutex;
+
+		Maia::Mythology::Frame_extraction_system m_frame_extraction_system;
+		std::uint64_t m_extracted_frames;
+		Maia::Renderer::Frame_packet_buffer<Frame_packet> m_frame_packets;
+
 		Maia::Mythology::D3D12::Upload_frame_data_system m_upload_frame_data_system;
 		Maia::Mythology::D3D12::Renderer m_renderer;
 		Maia::Mythology::D3D12::Frames_resources m_frames_resources;
@@ -73,11 +144,19 @@ namespace Maia::Mythology::D3D12
 		winrt::com_ptr<ID3D12Fence> m_fence;
 		winrt::handle m_fence_event;
 
-		winrt::com_ptr<ID3D12Heap> m_pass_heap;
-		winrt::com_ptr<ID3D12Resource> m_pass_buffer;
+		// Grow when a frame needs more than they hold. The replaced buffers are destroyed once the frames submitted
+		// before are completed.
+		Maia::Renderer::Growable_buffer<Placed_buffer> m_pass_buffer;
+		std::vector<Maia::Renderer::Growable_buffer<Placed_buffer>> m_instance_slot_buffer_per_frame;
+
+		// Transforms of the instances, indexed by the slots of the instance slot buffers.
+		Maia::Renderer::Growable_buffer<Placed_buffer> m_resident_instance_buffer;
+
+		std::vector<D3D12_VERTEX_BUFFER_VIEW> m_instance_buffer_views;
+		std::vector<Mesh_ID> m_instance_buffer_mesh_indices;
 
-		winrt::com_ptr<ID3D12Heap> m_instance_buffers_heap;
-		std::vector<Instance_buffer> m_instance_buffer_per_frame;
+		// Declared last, so that it starts after and stops before the resources that it uses.
+		std::thread m_render_thread;
 	};
 }
 
@@ -71,16 +71,13 @@ namespace Maia::Mythology::D3D12
 			description.DepthStencilState.DepthEnable = FALSE;
 			description.DepthStencilState.StencilEnable = FALSE;
 
-			std::array<D3D12_INPUT_ELEMENT_DESC, 6> input_layout_elements
+			std::array<D3D12_INPUT_ELEMENT_DESC, 3> input_layout_elements
 			{
 				D3D12_INPUT_ELEMENT_DESC
 				{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 1, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
 				{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
 
-				{ "WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 0, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
-				{ "WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 16, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
-				{ "WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 32, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
-				{ "WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 48, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
+				{ "INSTANCE_SLOT", 0, DXGI_FORMAT_R32_UINT, 2, 0, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1 },
 			};
 			description.InputLayout = { input_layout_elements.data(), static_cast<UINT>(input_layout_elements.size()) };
 
@@ -103,8 +100,9 @@ namespace Maia::Mythology::D3D12
 
 		winrt::com_ptr<ID3D12RootSignature> create_color_pass_root_signature(ID3D12Device& device)
 		{
-			std::array<CD3DX12_ROOT_PARAMETER1, 1> root_parameters;
+			std::array<CD3DX12_ROOT_PARAMETER1, 2> root_parameters;
 			root_parameters[0].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC, D3D12_SHADER_VISIBILITY_ALL);
+			root_parameters[1].InitAsShaderResourceView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC, D3D12_SHADER_VISIBILITY_VERTEX);
 
 			return create_root_signature(device, root_parameters, {}, 0);
 		}
@@ -142,6 +140,7 @@ namespace Maia::Mythology::D3D12
 			ID3D12Resource& render_target, D3D12_CPU_DESCRIPTOR_HANDLE render_target_descriptor_handle,
 			ID3D12RootSignature& root_signature,
 			D3D12_GPU_VIRTUAL_ADDRESS const pass_data_constant_buffer_address,
+			D3D12_GPU_VIRTUAL_ADDRESS const instance_transforms_buffer_address,
 			gsl::span<D3D12_VERTEX_BUFFER_VIEW const> const instance_buffer_views,
 			gsl::span<Mesh_ID const> const instance_buffer_mesh_indices,
 			gsl::span<Mesh_view const> const mesh_views
@@ -174,6 +173,7 @@ namespace Maia::Mythology::D3D12
 
 
 			command_list.SetGraphicsRootConstantBufferView(0, pass_data_constant_buffer_address);
+			command_list.SetGraphicsRootShaderResourceView(1, instance_transforms_buffer_address);
 
 			command_list.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -237,7 +237,8 @@ namespace Maia::Mythology::D3D12
 		gsl::span<D3D12_VERTEX_BUFFER_VIEW const> const instance_buffer_views,
 		gsl::span<Mesh_ID const> const instance_buffer_mesh_indices,
 		gsl::span<Mesh_view const> const mesh_views,
-		D3D12_GPU_VIRTUAL_ADDRESS const pass_data_buffer_address
+		D3D12_GPU_VIRTUAL_ADDRESS const pass_data_buffer_address,
+		D3D12_GPU_VIRTUAL_ADDRESS const instance_transforms_buffer_address
 	)
 	{
 		assert(instance_buffer_views.size() == instance_buffer_mesh_indices.size());
@@ -260,6 +261,7 @@ namespace Maia::Mythology::D3D12
 				render_target, render_target_descriptor_handle,
 				*m_root_signature,
 				pass_data_buffer_address,
+				instance_transforms_buffer_address,
 				instance_buffer_views,
 				instance_buffer_mesh_indices,
 				mesh_views
@@ -34,7 +34,8 @@ namespace Maia::Mythology::D3D12
 			gsl::span<D3D12_VERTEX_BUFFER_VIEW const> instance_buffer_views,
 			gsl::span<Mesh_ID const> instance_buffer_mesh_indices,
 			gsl::span<Mesh_view const> mesh_views,
-			D3D12_GPU_VIRTUAL_ADDRESS pass_data_buffer_address
+			D3D12_GPU_VIRTUAL_ADDRESS pass_data_buffer_address,
+			D3D12_GPU_VIRTUAL_ADDRESS instance_transforms_buffer_address
 		);
 
 	private:
@@ -1,5 +1,7 @@
-#include <Maia/GameEngine/Entity_type.hpp>
-#include <Maia/GameEngine/Entity_manager.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 #include <Maia/GameEngine/Systems/Transform_system.hpp>
 
 #include <Maia/Renderer/D3D12/Utilities/Check_hresult.hpp>
@@ -10,22 +12,28 @@
 
 #include "Upload_frame_data_system.hpp"
 
+using namespace Maia::Renderer;
 using namespace Maia::Renderer::D3D12;
 
 namespace Maia::Mythology::D3D12
 {
-	constexpr UINT64 c_upload_buffer_offset_per_frame = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+	namespace
+	{
+		constexpr UINT64 c_initial_upload_buffer_size_per_frame = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+		constexpr UINT64 c_upload_alignment = 16;
+	}
 
 	Upload_frame_data_system::Upload_frame_data_system(ID3D12Device& device, std::uint8_t const pipeline_length) :
 		m_command_allocators{ create_command_allocators(device, D3D12_COMMAND_LIST_TYPE_COPY, pipeline_length) },
 		m_command_list{ create_closed_graphics_command_list(device, 0, D3D12_COMMAND_LIST_TYPE_COPY, *m_command_allocators.front()) },
-		m_upload_heap{ create_upload_heap(device, c_upload_buffer_offset_per_frame * pipeline_length) },
-		m_upload_buffer{ create_buffer(device, *m_upload_heap, 0, c_upload_buffer_offset_per_frame * pipeline_length, D3D12_RESOURCE_STATE_GENERIC_READ) }
+		m_upload_buffer{ device, c_initial_upload_buffer_size_per_frame * pipeline_length },
+		m_copy_regions{},
+		m_copy_resources{}
 	{
 	}
 
 
-	Upload_bundle Upload_frame_data_system::reset(std::uint8_t const frame_index)
+	Upload_bundle Upload_frame_data_system::reset(std::uint8_t const frame_index, UINT64 const completed_fence_value)
 	{
 		ID3D12CommandAllocator& command_allocator = *m_command_allocators[frame_index];
 
@@ -35,137 +43,146 @@ namespace Maia::Mythology::D3D12
 		check_hresult(
 			m_command_list->Reset(&command_allocator, nullptr));
 
-		return { frame_index, frame_index * c_upload_buffer_offset_per_frame };
+		m_upload_buffer.release_completed_frames(completed_fence_value);
+
+		m_copy_regions.clear();
+		m_copy_resources.clear();
+
+		return { frame_index };
 	}
 
 
-	namespace
+	void Upload_frame_data_system::upload_instance_transforms(
+		Upload_bundle& bundle,
+		ID3D12Resource& resident_instance_buffer,
+		gsl::span<Slot_range const> const slot_ranges,
+		gsl::span<Eigen::Matrix4f const> const transforms
+	)
 	{
-		std::vector<D3D12_VERTEX_BUFFER_VIEW> upload_instance_data_impl(
-			Instance_buffer const& instance_buffer, UINT64 const instance_buffer_offset,
-			Maia::GameEngine::Entity_manager const& entity_manager,
-			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_ids,
-			ID3D12GraphicsCommandList& command_list,
-			ID3D12Resource& upload_buffer, UINT64 const upload_buffer_offset_in_bytes,
-			UINT64& uploaded_size_in_bytes
-		)
+		if (transforms.empty())
 		{
-			using namespace Maia::GameEngine;
-			using namespace Maia::Renderer::D3D12;
-
-			std::vector<D3D12_VERTEX_BUFFER_VIEW> instance_buffer_views;
-			instance_buffer_views.reserve(entity_types_ids.size());
-
-			UINT64 current_size_in_bytes{ 0 };
+			return;
+		}
 
-			for (Entity_type_id const entity_type_id : entity_types_ids)
-			{
-				Component_group const& component_group = entity_manager.get_component_group(entity_type_id);
+		Upload_allocation const allocation =
+			m_upload_buffer.allocate(transforms.size_bytes(), c_upload_alignment);
 
-				UINT64 size_in_bytes{ 0 };
+		std::memcpy(allocation.data, transforms.data(), transforms.size_bytes());
 
-				for (std::size_t chunk_index = 0; chunk_index < component_group.num_chunks(); ++chunk_index)
-				{
-					using namespace Maia::GameEngine::Systems;
+		std::size_t const source = get_resource_index(allocation.buffer);
+		std::size_t const destination = get_resource_index(resident_instance_buffer);
 
-					gsl::span<Transform_matrix const> const transform_matrices =
-						component_group.components<Transform_matrix>(chunk_index);
+		UINT64 source_offset = allocation.offset;
 
-					upload_buffer_data(
-						command_list,
-						*instance_buffer.value, instance_buffer_offset + current_size_in_bytes + size_in_bytes,
-						upload_buffer, upload_buffer_offset_in_bytes + current_size_in_bytes + size_in_bytes,
-						transform_matrices
-					);
+		for (Slot_range const& slot_range : slot_ranges)
+		{
+			UINT64 const size = UINT64{ slot_range.count } * sizeof(Instance_data);
 
-					size_in_bytes += transform_matrices.size_bytes();
+			m_copy_regions.push_back(
+				{
+					source,
+					destination,
+					source_offset,
+					UINT64{ slot_range.first } * sizeof(Instance_data),
+					size
 				}
+			);
 
-				D3D12_VERTEX_BUFFER_VIEW instance_buffer_view;
-				instance_buffer_view.BufferLocation =
-					instance_buffer.value->GetGPUVirtualAddress() +
-					instance_buffer_offset + current_size_in_bytes;
-				instance_buffer_view.SizeInBytes = static_cast<UINT>(size_in_bytes);
-				instance_buffer_view.StrideInBytes = sizeof(Instance_data);
-				instance_buffer_views.push_back(instance_buffer_view);
-
-				current_size_in_bytes += size_in_bytes;
-			}
-
-			uploaded_size_in_bytes = current_size_in_bytes;
-
-			return instance_buffer_views;
+			source_offset += size;
 		}
+
+		assert(source_offset == allocation.offset + transforms.size_bytes());
 	}
 
-	std::vector<D3D12_VERTEX_BUFFER_VIEW> Upload_frame_data_system::upload_instance_data(
+	D3D12_VERTEX_BUFFER_VIEW Upload_frame_data_system::upload_instance_slots(
 		Upload_bundle& bundle,
-		Instance_buffer const& instance_buffer, UINT64 const instance_buffer_offset,
-		Maia::GameEngine::Entity_manager const& entity_manager,
-		gsl::span<Maia::GameEngine::Entity_type_id const> const entity_types_ids
+		ID3D12Resource& instance_slot_buffer, UINT64 const instance_slot_buffer_offset,
+		gsl::span<std::uint32_t const> const instance_slots
 	)
 	{
-		UINT64 uploaded_size_in_bytes;
-
-		std::vector<D3D12_VERTEX_BUFFER_VIEW> vertex_buffer_views = upload_instance_data_impl(
-			instance_buffer, instance_buffer_offset,
-			entity_manager, entity_types_ids,
-			*m_command_list,
-			*m_upload_buffer, bundle.offset,
-			uploaded_size_in_bytes
-		);
-		
-		bundle.offset += uploaded_size_in_bytes;
-
-		return vertex_buffer_views;
-	}
-
-	namespace
-	{
-		UINT64 upload_pass_data_impl(
-			Pass_data const& pass_data,
-			ID3D12GraphicsCommandList& command_list,
-			ID3D12Resource& destination_buffer, UINT64 const destination_buffer_offset,
-			ID3D12Resource& upload_buffer, UINT64 const upload_buffer_offset
-		)
+		if (!instance_slots.empty())
 		{
-			using namespace Maia::Renderer::D3D12;
-
-			upload_buffer_data<Pass_data>(
-				command_list,
-				destination_buffer, destination_buffer_offset,
-				upload_buffer, upload_buffer_offset,
-				{ &pass_data, 1 }
+			upload(
+				gsl::as_bytes(instance_slots),
+				instance_slot_buffer, instance_slot_buffer_offset
 			);
-
-			return sizeof(Pass_data);
 		}
+
+		D3D12_VERTEX_BUFFER_VIEW instance_slots_view;
+		instance_slots_view.BufferLocation =
+			instance_slot_buffer.GetGPUVirtualAddress() + instance_slot_buffer_offset;
+		instance_slots_view.SizeInBytes = static_cast<UINT>(instance_slots.size_bytes());
+		instance_slots_view.StrideInBytes = sizeof(std::uint32_t);
+
+		return instance_slots_view;
 	}
 
 	void Upload_frame_data_system::upload_pass_data(
 		Upload_bundle& bundle,
 		Pass_data const& pass_data,
-		ID3D12Resource& pass_buffer, UINT64 pass_buffer_offset
+		ID3D12Resource& pass_buffer, UINT64 const pass_buffer_offset
 	)
 	{
-		UINT64 const uploaded_size_in_bytes = upload_pass_data_impl(
-			pass_data,
-			*m_command_list,
-			pass_buffer, pass_buffer_offset,
-			*m_upload_buffer, bundle.offset
+		upload(
+			gsl::as_bytes(gsl::span<Pass_data const>{ &pass_data, 1 }),
+			pass_buffer, pass_buffer_offset
 		);
-
-		bundle.offset += uploaded_size_in_bytes;
 	}
 
 
-	ID3D12CommandList& Upload_frame_data_system::close(Upload_bundle& bundle)
+	ID3D12CommandList& Upload_frame_data_system::close(Upload_bundle& bundle, UINT64 const fence_value)
 	{
-		assert(bundle.offset < (bundle.frame_index + 1) * c_upload_buffer_offset_per_frame);
+		coalesce_copy_regions(m_copy_regions);
+
+		for (Copy_region const& copy_region : m_copy_regions)
+		{
+			m_command_list->CopyBufferRegion(
+				m_copy_resources[copy_region.destination], copy_region.destination_offset,
+				m_copy_resources[copy_region.source], copy_region.source_offset,
+				copy_region.size
+			);
+		}
+
+		m_upload_buffer.finish_frame(fence_value);
 
 		check_hresult(
 			m_command_list->Close());
 
 		return *m_command_list;
 	}
+
+
+	void Upload_frame_data_system::upload(
+		gsl::span<std::byte const> const data,
+		ID3D12Resource& destination_buffer, UINT64 const destination_buffer_offset
+	)
+	{
+		Upload_allocation const allocation =
+			m_upload_buffer.allocate(data.size_bytes(), c_upload_alignment);
+
+		std::memcpy(allocation.data, data.data(), data.size_bytes());
+
+		m_copy_regions.push_back(
+			{
+				get_resource_index(allocation.buffer),
+				get_resource_index(destination_buffer),
+				allocation.offset,
+				destination_buffer_offset,
+				static_cast<std::uint64_t>(data.size_bytes())
+			}
+		);
+	}
+
+	std::size_t Upload_frame_data_system::get_resource_index(ID3D12Resource& resource)
+	{
+		auto const location = std::find(m_copy_resources.begin(), m_copy_resources.end(), &resource);
+
+		if (location != m_copy_resources.end())
+		{
+			return static_cast<std::size_t>(std::distance(m_copy_resources.begin(), location));
+		}
+
+		m_copy_resources.push_back(&resource);
+		return m_copy_resources.size() - 1;
+	}
 }
@@ -1,15 +1,19 @@
 #ifndef MAIA_MYTHOLOGY_D3D12_UPLOADFRAMEDATASYSTEM_H_INCLUDED
 #define MAIA_MYTHOLOGY_D3D12_UPLOADFRAMEDATASYSTEM_H_INCLUDED
 
+#include <vector>
+
+#include <gsl/span>
+
+#include <Eigen/Core>
+
+#include <Maia/Renderer/Copy_region.hpp>
+#include <Maia/Renderer/Instance_slots.hpp>
+#include <Maia/Renderer/D3D12/Utilities/Upload_ring_buffer.hpp>
+
 #include "Render_data.hpp"
 #include "Renderer.hpp"
 
-namespace Maia::GameEngine
-{
-	struct Entity_type_id;
-	class Entity_manager;
-}
-
 namespace Maia::Utilities::glTF
 {
 	class GlTF;
@@ -25,9 +29,10 @@ namespace Maia::Mythology::D3D12
 	struct Upload_bundle
 	{
 		std::uint8_t const frame_index;
-		UINT64 offset;
 	};
 
+	// Writes the frame data to a persistently mapped upload ring buffer and records the copies to the
+	// destination buffers, which are coalesced into as few CopyBufferRegion calls as possible when closed.
 	class Upload_frame_data_system
 	{
 	public:
@@ -35,14 +40,23 @@ namespace Maia::Mythology::D3D12
 		Upload_frame_data_system(ID3D12Device& device, std::uint8_t pipeline_length);
 
 
-		[[nodiscard]] Upload_bundle reset(std::uint8_t frame_index);
+		// Releases the upload memory of the frames that completed_fence_value has completed.
+		[[nodiscard]] Upload_bundle reset(std::uint8_t frame_index, UINT64 completed_fence_value);
 
 
-		std::vector<D3D12_VERTEX_BUFFER_VIEW> upload_instance_data(
+		// Copies transforms, packed in the order of slot_ranges, to their slots of resident_instance_buffer.
+		void upload_instance_transforms(
 			Upload_bundle& bundle,
-			Instance_buffer const& instance_buffer, UINT64 instance_buffer_offset,
-			Maia::GameEngine::Entity_manager const& entity_manager,
-			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_ids
+			ID3D12Resource& resident_instance_buffer,
+			gsl::span<Maia::Renderer::Slot_range const> slot_ranges,
+			gsl::span<Eigen::Matrix4f const> transforms
+		);
+
+		// Returns the per instance vertex buffer view of the slots.
+		D3D12_VERTEX_BUFFER_VIEW upload_instance_slots(
+			Upload_bundle& bundle,
+			ID3D12Resource& instance_slot_buffer, UINT64 instance_slot_buffer_offset,
+			gsl::span<std::uint32_t const> instance_slots
 		);
 		
 		void upload_pass_data(
@@ -52,16 +66,26 @@ namespace Maia::Mythology::D3D12
 		);
 
 
-		ID3D12CommandList& close(Upload_bundle& bundle);
+		// The upload memory of the frame is reused once fence_value is completed.
+		ID3D12CommandList& close(Upload_bundle& bundle, UINT64 fence_value);
 
 	private:
 
+		void upload(
+			gsl::span<std::byte const> data,
+			ID3D12Resource& destination_buffer, UINT64 destination_buffer_offset
+		);
+
+		std::size_t get_resource_index(ID3D12Resource& resource);
+
+
 		std::vector<winrt::com_ptr<ID3D12CommandAllocator>> m_command_allocators;
 		winrt::com_ptr<ID3D12GraphicsCommandList> m_command_list;
-		winrt::com_ptr<ID3D12Heap> m_upload_heap;
-		winrt::com_ptr<ID3D12Resource> m_upload_buffer;
+		Maia::Renderer::D3D12::Upload_ring_buffer m_upload_buffer;
+		std::vector<Maia::Renderer::Copy_region> m_copy_regions;
+		std::vector<ID3D12Resource*> m_copy_resources;
 
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
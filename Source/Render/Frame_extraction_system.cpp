@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <cassert>
+#include <optional>
+
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/Renderer/Matrices.hpp>
+
+#include <Components/Camera_component.hpp>
+
+#include "Frame_extraction_system.hpp"
+
+namespace Maia::Mythology
+{
+	namespace
+	{
+		// Keys of the instance slots checked per frame for destroyed entities
+		constexpr std::uint32_t c_num_swept_instance_keys_per_frame = 256;
+
+		Eigen::Matrix4f create_projection_matrix(
+			Maia::Utilities::glTF::Camera const& camera,
+			Eigen::Vector2i const window_size
+		)
+		{
+			using namespace Maia::Renderer;
+
+			if (camera.type == Maia::Utilities::glTF::Camera::Type::Orthographic)
+			{
+				const auto& orthographic = std::get<Maia::Utilities::glTF::Camera::Orthographic>(camera.projection);
+
+				return create_orthographic_projection_matrix(
+					orthographic.horizontal_magnification,
+					orthographic.vertical_magnification,
+					orthographic.near_z,
+					orthographic.far_z
+				);
+			}
+			else
+			{
+				const auto& perspective = std::get<Maia::Utilities::glTF::Camera::Perspective>(camera.projection);
+
+				float const aspect_ratio = perspective.aspect_ratio ?
+					*perspective.aspect_ratio :
+					static_cast<float>(window_size(0)) / window_size(1);
+
+				if (perspective.far_z)
+				{
+					return create_finite_perspective_projection_matrix(
+						aspect_ratio,
+						perspective.vertical_field_of_view,
+						perspective.near_z,
+						*perspective.far_z
+					);
+				}
+				else
+				{
+					return create_infinite_perspective_projection_matrix(
+						aspect_ratio,
+						perspective.vertical_field_of_view,
+						perspective.near_z
+					);
+				}
+			}
+		}
+
+		// Emits a draw item per visible instance, keyed by the mesh of its level of detail and by its view depth.
+		// The slots of the instances are appended to extracted_slots in the order of the items. Instances without
+		// a slot, or whose slot belonged to a destroyed entity with the same value, are assigned one and their
+		// transform is added to slot_updates.
+		void extract_draw_items(
+			Maia::GameEngine::Entity_manager const& entity_manager,
+			Maia::GameEngine::Culling::Visible_instances const& visible_instances,
+			gsl::span<Mesh_lods const> const entity_types_mesh_lods,
+			Eigen::Matrix4f const& view_matrix,
+			Maia::Renderer::Instance_slots& instance_slots,
+			Maia::Renderer::Render_queue& render_queue,
+			std::vector<std::uint32_t>& extracted_slots,
+			std::vector<Maia::Renderer::Slot_update>& slot_updates
+		)
+		{
+			using namespace Maia::GameEngine::Systems;
+			using namespace Maia::Renderer;
+
+			render_queue.clear();
+			extracted_slots.clear();
+
+			for (std::ptrdiff_t entity_type_index = 0; entity_type_index < entity_types_mesh_lods.size(); ++entity_type_index)
+			{
+				std::vector<Mesh_ID> const& levels = entity_types_mesh_lods[entity_type_index].levels;
+				assert(!levels.empty());
+
+				for (std::size_t lod_level = 0; lod_level < Maia::GameEngine::Lod::max_num_lod_levels; ++lod_level)
+				{
+					Mesh_ID const mesh = levels[std::min(lod_level, levels.size() - 1)];
+
+					gsl::span<Transform_matrix const> const transform_matrices =
+						Maia::GameEngine::Culling::get_visible_transform_matrices(visible_instances, entity_type_index, lod_level);
+					gsl::span<Maia::GameEngine::Entity const> const entities =
+						Maia::GameEngine::Culling::get_visible_entities(visible_instances, entity_type_index, lod_level);
+
+					for (std::ptrdiff_t instance_index = 0; instance_index < transform_matrices.size(); ++instance_index)
+					{
+						Eigen::Matrix4f const& transform_matrix = transform_matrices[instance_index].value;
+
+						Maia::GameEngine::Entity const entity = entities[instance_index];
+						std::pair<std::uint32_t, bool> const slot = instance_slots.assign(entity.value, entity_manager.get_generation(entity));
+
+						if (slot.second)
+						{
+							slot_updates.push_back({ slot.first, transform_matrix });
+						}
+
+						float const view_depth = view_matrix.row(2).dot(transform_matrix.col(3));
+
+						render_queue.push(
+							create_sort_key({ 0, 0, 0, mesh.value, quantize_depth(view_depth) }),
+							static_cast<std::uint32_t>(extracted_slots.size())
+						);
+
+						extracted_slots.push_back(slot.first);
+					}
+				}
+			}
+		}
+	}
+
+	Frame_extraction_system::Frame_extraction_system(Maia::Utilities::Worker_threads& worker_threads) :
+		m_frustum_culling_system{ worker_threads },
+		m_visible_instances{},
+		m_occlusion_buffer{ 256, 128, worker_threads },
+		m_occluders{},
+		m_render_queue{ worker_threads },
+		m_extracted_instance_slots{},
+		m_instance_slots{},
+		m_next_swept_instance_key{ 0 },
+		m_slot_updates{},
+		m_released_instance_keys{}
+	{
+	}
+
+	void Frame_extraction_system::execute(
+		Maia::GameEngine::Entity_manager const& entity_manager,
+		Maia::GameEngine::Entity const camera_entity,
+		gsl::span<Maia::GameEngine::Entity_type_id const> const entity_types_with_mesh,
+		gsl::span<Mesh_lods const> const entity_types_mesh_lods,
+		gsl::span<Maia::GameEngine::Entity const> const changed_entities,
+		Eigen::Vector2i const window_size,
+		Eigen::Matrix4f const& clip_space_correction,
+		Maia::Renderer::Frame_packet& frame_packet
+	)
+	{
+		assert(entity_types_with_mesh.size() == entity_types_mesh_lods.size());
+
+		using namespace Maia::GameEngine::Systems;
+
+		{
+			// TODO problem with camera. Upside down.
+
+			Transform_matrix const camera_transform =
+				entity_manager.get_component_data<Transform_matrix>(camera_entity);
+
+			frame_packet.view_matrix = camera_transform.value.inverse();
+		}
+
+		{
+			Maia::Utilities::glTF::Camera const camera =
+				entity_manager.get_component_data<Camera_component>(camera_entity).value;
+
+			frame_packet.projection_matrix = clip_space_correction * create_projection_matrix(camera, window_size);
+		}
+
+		{
+			Eigen::Matrix4f const view_projection_matrix = frame_packet.projection_matrix * frame_packet.view_matrix;
+
+			Maia::GameEngine::Spatial::Frustum const frustum =
+				Maia::GameEngine::Spatial::create_frustum(view_projection_matrix);
+
+			if (m_occluders.empty())
+			{
+				m_frustum_culling_system.execute(
+					entity_manager,
+					entity_types_with_mesh,
+					frustum,
+					m_visible_instances
+				);
+			}
+			else
+			{
+				m_occlusion_buffer.render(m_occluders, view_projection_matrix);
+
+				m_frustum_culling_system.execute(
+					entity_manager,
+					entity_types_with_mesh,
+					frustum,
+					m_occlusion_buffer,
+					m_visible_instances
+				);
+			}
+		}
+
+		{
+			// The slots of destroyed entities are released before the slots of this frame are assigned, so that
+			// they are reused before the buffer grows
+			std::uint32_t const num_keys = m_instance_slots.num_keys();
+
+			if (m_next_swept_instance_key >= num_keys)
+			{
+				m_next_swept_instance_key = 0;
+			}
+
+			std::uint32_t const last_swept_key = std::min(m_next_swept_instance_key + c_num_swept_instance_keys_per_frame, num_keys);
+
+			m_released_instance_keys.clear();
+
+			m_instance_slots.for_each(m_next_swept_instance_key, last_swept_key, [&](std::uint32_t const key, std::uint32_t) -> void
+			{
+				if (!entity_manager.exists(Maia::GameEngine::Entity{ key }))
+				{
+					m_released_instance_keys.push_back(key);
+				}
+			});
+
+			for (std::uint32_t const key : m_released_instance_keys)
+			{
+				m_instance_slots.release(key);
+			}
+
+			m_next_swept_instance_key = last_swept_key;
+		}
+
+		std::uint32_t const previous_slot_capacity = m_instance_slots.capacity();
+
+		m_slot_updates.clear();
+
+		for (Maia::GameEngine::Entity const entity : changed_entities)
+		{
+			if (std::optional<std::uint32_t> const slot = m_instance_slots.find(entity.value))
+			{
+				m_slot_updates.push_back({ *slot, entity_manager.get_component_data<Transform_matrix>(entity).value });
+			}
+		}
+
+		extract_draw_items(
+			entity_manager,
+			m_visible_instances,
+			entity_types_mesh_lods,
+			frame_packet.view_matrix,
+			m_instance_slots,
+			m_render_queue,
+			m_extracted_instance_slots,
+			m_slot_updates
+		);
+
+		if (m_instance_slots.capacity() != previous_slot_capacity)
+		{
+			// The instance buffer is recreated, so every slot is uploaded again. The slots of destroyed entities are
+			// released, so that they are reused before the buffer grows again.
+			m_slot_updates.clear();
+			m_released_instance_keys.clear();
+
+			m_instance_slots.for_each([&](std::uint32_t const key, std::uint32_t const slot) -> void
+			{
+				Maia::GameEngine::Entity const entity{ key };
+
+				if (entity_manager.exists(entity))
+				{
+					m_slot_updates.push_back({ slot, entity_manager.get_component_data<Transform_matrix>(entity).value });
+				}
+				else
+				{
+					m_released_instance_keys.push_back(key);
+				}
+			});
+
+			for (std::uint32_t const key : m_released_instance_keys)
+			{
+				m_instance_slots.release(key);
+			}
+		}
+
+		m_render_queue.sort();
+
+		Maia::Renderer::write_draws(m_render_queue, m_extracted_instance_slots, frame_packet);
+
+		frame_packet.instance_slot_capacity = m_instance_slots.capacity();
+		Maia::Renderer::coalesce_slot_updates(m_slot_updates, frame_packet.updated_slot_ranges, frame_packet.updated_transforms);
+	}
+
+	void Frame_extraction_system::set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders)
+	{
+		m_occluders = std::move(occluders);
+	}
+
+	void Frame_extraction_system::reset()
+	{
+		m_instance_slots.clear();
+		m_next_swept_instance_key = 0;
+	}
+}
@@ -0,0 +1,75 @@
+#ifndef MAIA_MYTHOLOGY_FRAMEEXTRACTIONSYSTEM_H_INCLUDED
+#define MAIA_MYTHOLOGY_FRAMEEXTRACTIONSYSTEM_H_INCLUDED
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Culling/Frustum_culling.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/Renderer/Frame_packet.hpp>
+#include <Maia/Renderer/Instance_slots.hpp>
+#include <Maia/Renderer/Render_queue.hpp>
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
+
+#include <Components/Mesh_ID.hpp>
+
+namespace Maia::Mythology
+{
+	// CPU side of a frame that does not depend on the graphics API: the camera matrices, the culling of the
+	// instances, the sorting of their draws and the updates of the resident instance buffer.
+	// An instance gets a slot in the resident buffer the first time that it is visible. Afterwards its transform is
+	// only uploaded again when it is in the changed entities of a frame, or when its slot belonged to a destroyed
+	// entity with the same value, which is told apart by its generation. The slots of destroyed entities are released
+	// by a sweep over a range of keys per frame, and all of them when the resident buffer grows.
+	class Frame_extraction_system
+	{
+	public:
+
+		// Culling, occlusion and sorting share worker_threads, which must outlive the system.
+		explicit Frame_extraction_system(Maia::Utilities::Worker_threads& worker_threads);
+
+
+		// clip_space_correction is applied after the projection of the camera, to follow the conventions of
+		// the graphics API. window_size is used by cameras without an aspect ratio.
+		void execute(
+			Maia::GameEngine::Entity_manager const& entity_manager,
+			Maia::GameEngine::Entity camera_entity,
+			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_with_mesh,
+			gsl::span<Mesh_lods const> entity_types_mesh_lods,
+			gsl::span<Maia::GameEngine::Entity const> changed_entities,
+			Eigen::Vector2i window_size,
+			Eigen::Matrix4f const& clip_space_correction,
+			Maia::Renderer::Frame_packet& frame_packet
+		);
+
+		// World space occluders whose hidden instances are not extracted.
+		void set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders);
+
+		// Releases every instance slot. Slots are assigned by entity value, so this must be called before extracting
+		// the frames of a different entity manager.
+		void reset();
+
+
+	private:
+
+		Maia::GameEngine::Culling::Frustum_culling_system m_frustum_culling_system;
+		Maia::GameEngine::Culling::Visible_instances m_visible_instances;
+		Maia::GameEngine::Culling::Occlusion_buffer m_occlusion_buffer;
+		std::vector<Maia::GameEngine::Culling::Occluder> m_occluders;
+
+		Maia::Renderer::Render_queue m_render_queue;
+		std::vector<std::uint32_t> m_extracted_instance_slots;
+
+		Maia::Renderer::Instance_slots m_instance_slots;
+		std::uint32_t m_next_swept_instance_key;
+		std::vector<Maia::Renderer::Slot_update> m_slot_updates;
+		std::vector<std::uint32_t> m_released_instance_keys;
+
+	};
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef MAIA_MYTHOLOGY_IRENDERSYSTEM_H_INCLUDED
+#define MAIA_MYTHOLOGY_IRENDERSYSTEM_H_INCLUDED
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <gsl/span>
+
+#include <Maia/GameEngine/Entity.hpp>
+#include <Maia/GameEngine/Entity_type.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/Utilities/glTF/gltf.hpp>
+
+#include <Components/Mesh_ID.hpp>
+
+namespace Maia::GameEngine
+{
+	class Entity_manager;
+}
+
+namespace Maia::Mythology
+{
+	class IRender_system
+	{
+	public:
+
+		// Creates the resources of the meshes of gltf, which are identified by consecutive ids starting at the
+		// returned one. Can be called by a thread that loads scenes while frames are extracted.
+		virtual Mesh_ID load_meshes(Maia::Utilities::glTF::Gltf const& gltf) = 0;
+
+		// Releases the resources of the meshes created by the load_meshes call that returned first_mesh, once the
+		// frames in flight do not use them. Must be called by the thread that extracts frames, after destroying
+		// the entities that use the meshes. Mesh ids are not reused.
+		virtual void unload_meshes(Mesh_ID first_mesh) = 0;
+
+		// changed_entities must contain every entity whose transform changed since the last extracted frame,
+		// so that only their transforms are uploaded again.
+		virtual void extract_frame(
+			Maia::GameEngine::Entity_manager const& entity_manager,
+			Maia::GameEngine::Entity camera_entity,
+			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_with_mesh,
+			gsl::span<Mesh_lods const> entity_types_mesh_lods,
+			gsl::span<Maia::GameEngine::Entity const> changed_entities
+		) = 0;
+
+		// Waits until the extracted frames are rendered. No frame can be extracted afterwards.
+		virtual void wait() = 0;
+
+		virtual void on_window_resized(Eigen::Vector2i new_size) = 0;
+
+		virtual void set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders) = 0;
+
+		// Must be called before extracting the frames of a different entity manager, like when the current scene
+		// changes, because the instances of the extracted frames are identified by entity value.
+		virtual void on_scene_changed() = 0;
+
+	};
+}
+
+#endif
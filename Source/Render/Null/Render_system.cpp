@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <new>
+
+#include <gsl/gsl>
+
+#include <Render/Pass_data.hpp>
+
+#include "Render_system.hpp"
+
+namespace Maia::Mythology::Null
+{
+	namespace
+	{
+		template <class T, class U>
+		T align(T value, U alignment)
+		{
+			return ((value - 1) | (alignment - 1)) + 1;
+		}
+
+		// Same placement as the constant buffers of the D3D12 backend.
+		constexpr std::size_t c_pass_data_alignment = 256;
+
+		// Same geometry buffers as the D3D12 backend.
+		constexpr std::uint64_t c_geometry_buffer_size = 64 * 1024 * 1024;
+		constexpr std::uint64_t c_geometry_alignment = 256;
+	}
+
+	Render_system::Render_system(
+		Eigen::Vector2i const window_size,
+		std::uint8_t const pipeline_length,
+		Maia::Utilities::Worker_threads& worker_threads
+	) :
+		m_pipeline_length{ pipeline_length },
+		m_window_size{ window_size },
+		m_num_meshes{ 0 },
+		m_geometry_pool{ c_geometry_buffer_size, c_geometry_alignment },
+		m_loaded_meshes{},
+		m_meshes_mutex{},
+		m_frame_extraction_system{ worker_threads },
+		m_frame_packet{},
+		m_submitted_frames{ 0 },
+		m_upload_buffer_per_frame(pipeline_length),
+		m_resident_instance_transforms{},
+		m_instance_ranges{},
+		m_last_frame_statistics{}
+	{
+		assert(pipeline_length > 0);
+	}
+
+	Mesh_ID Render_system::load_meshes(Maia::Utilities::glTF::Gltf const& gltf)
+	{
+		std::lock_guard<std::mutex> lock{ m_meshes_mutex };
+
+		Mesh_ID const first_mesh{ gsl::narrow_cast<std::uint16_t>(m_num_meshes) };
+
+		m_num_meshes += gltf.meshes ? gltf.meshes->size() : 0;
+
+		Loaded_meshes loaded_meshes{ first_mesh, {} };
+
+		if (gltf.buffers)
+		{
+			for (Maia::Utilities::glTF::Buffer const& buffer : *gltf.buffers)
+			{
+				std::optional<Maia::Renderer::Geometry_allocation> const allocation =
+					m_geometry_pool.allocate(buffer.byte_length, c_geometry_alignment);
+
+				if (!allocation)
+				{
+					throw std::bad_alloc{};
+				}
+
+				loaded_meshes.geometry_allocations.push_back(*allocation);
+			}
+		}
+
+		m_loaded_meshes.push_back(std::move(loaded_meshes));
+
+		return first_mesh;
+	}
+
+	void Render_system::unload_meshes(Mesh_ID const first_mesh)
+	{
+		std::lock_guard<std::mutex> lock{ m_meshes_mutex };
+
+		auto const loaded_meshes = std::find_if(m_loaded_meshes.begin(), m_loaded_meshes.end(), [first_mesh](Loaded_meshes const& loaded_meshes) -> bool
+		{
+			return loaded_meshes.first_mesh.value == first_mesh.value;
+		});
+		assert(loaded_meshes != m_loaded_meshes.end());
+
+		for (Maia::Renderer::Geometry_allocation const& allocation : loaded_meshes->geometry_allocations)
+		{
+			m_geometry_pool.deallocate(allocation, m_submitted_frames);
+		}
+
+		m_loaded_meshes.erase(loaded_meshes);
+
+		// Frames are rendered by extract_frame, so the submitted ones are already completed
+		m_geometry_pool.release_completed(m_submitted_frames);
+	}
+
+	void Render_system::extract_frame(
+		Maia::GameEngine::Entity_manager const& entity_manager,
+		Maia::GameEngine::Entity const camera_entity,
+		gsl::span<Maia::GameEngine::Entity_type_id const> const entity_types_with_mesh,
+		gsl::span<Mesh_lods const> const entity_types_mesh_lods,
+		gsl::span<Maia::GameEngine::Entity const> const changed_entities
+	)
+	{
+		m_frame_packet.frame_number = m_submitted_frames;
+
+		m_frame_extraction_system.execute(
+			entity_manager,
+			camera_entity,
+			entity_types_with_mesh,
+			entity_types_mesh_lods,
+			changed_entities,
+			m_window_size,
+			Eigen::Matrix4f::Identity(),
+			m_frame_packet
+		);
+
+		render_frame(m_frame_packet);
+	}
+
+	void Render_system::wait()
+	{
+	}
+
+	void Render_system::on_window_resized(Eigen::Vector2i const new_size)
+	{
+		m_window_size = new_size;
+	}
+
+	void Render_system::set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders)
+	{
+		m_frame_extraction_system.set_occluders(std::move(occluders));
+	}
+
+	void Render_system::on_scene_changed()
+	{
+		m_frame_extraction_system.reset();
+	}
+
+	Frame_statistics const& Render_system::get_last_frame_statistics() const
+	{
+		return m_last_frame_statistics;
+	}
+
+	void Render_system::render_frame(Maia::Renderer::Frame_packet const& frame_packet)
+	{
+		std::uint8_t const current_frame_index{ static_cast<std::uint8_t>(m_submitted_frames % m_pipeline_length) };
+
+		std::size_t const updated_transforms_offset = align(sizeof(Pass_data), c_pass_data_alignment);
+		std::size_t const updated_transforms_size = frame_packet.updated_transforms.size() * sizeof(Eigen::Matrix4f);
+		std::size_t const instance_slots_offset = updated_transforms_offset + updated_transforms_size;
+		std::size_t const instance_slots_size = frame_packet.instance_slots.size() * sizeof(std::uint32_t);
+
+		std::vector<std::byte>& upload_buffer = m_upload_buffer_per_frame[current_frame_index];
+		upload_buffer.resize(instance_slots_offset + instance_slots_size);
+
+		{
+			Pass_data const pass_data{ frame_packet.view_matrix, frame_packet.projection_matrix };
+			std::memcpy(upload_buffer.data(), &pass_data, sizeof(Pass_data));
+		}
+
+		if (updated_transforms_size > 0)
+		{
+			std::memcpy(upload_buffer.data() + updated_transforms_offset, frame_packet.updated_transforms.data(), updated_transforms_size);
+		}
+
+		if (instance_slots_size > 0)
+		{
+			std::memcpy(upload_buffer.data() + instance_slots_offset, frame_packet.instance_slots.data(), instance_slots_size);
+		}
+
+		{
+			// The copies that the GPU would do from the upload buffer to the resident instance buffer
+			m_resident_instance_transforms.resize(frame_packet.instance_slot_capacity);
+
+			std::size_t source_offset = updated_transforms_offset;
+
+			for (Maia::Renderer::Slot_range const& range : frame_packet.updated_slot_ranges)
+			{
+				assert(range.first + range.count <= m_resident_instance_transforms.size());
+
+				std::size_t const range_size = std::size_t{ range.count } * sizeof(Eigen::Matrix4f);
+				std::memcpy(reinterpret_cast<std::byte*>(m_resident_instance_transforms.data() + range.first), upload_buffer.data() + source_offset, range_size);
+				source_offset += range_size;
+			}
+		}
+
+		m_instance_ranges.clear();
+
+		for (Maia::Renderer::Instanced_draw const& draw : frame_packet.draws)
+		{
+			m_instance_ranges.push_back(
+				{
+					{ draw.mesh },
+					instance_slots_offset + std::size_t{ draw.first_instance } * sizeof(std::uint32_t),
+					std::size_t{ draw.instance_count } * sizeof(std::uint32_t)
+				}
+			);
+		}
+
+		m_last_frame_statistics =
+		{
+			frame_packet.frame_number,
+			frame_packet.draws.size(),
+			frame_packet.instance_slots.size(),
+			upload_buffer.size(),
+			[this]() -> std::uint64_t
+			{
+				std::lock_guard<std::mutex> lock{ m_meshes_mutex };
+				return m_geometry_pool.statistics().allocated_size;
+			}()
+		};
+
+		++m_submitted_frames;
+	}
+}
@@ -0,0 +1,102 @@
+#ifndef MAIA_MYTHOLOGY_NULL_RENDERSYSTEM_H_INCLUDED
+#define MAIA_MYTHOLOGY_NULL_RENDERSYSTEM_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <Maia/Renderer/Frame_packet.hpp>
+#include <Maia/Renderer/Geometry_pool.hpp>
+
+#include <Render/Frame_extraction_system.hpp>
+#include <Render/IRender_system.hpp>
+
+namespace Maia::Mythology::Null
+{
+	struct Frame_statistics
+	{
+		std::uint64_t frame_number;
+		std::size_t draw_count;
+		std::size_t instance_count;
+		std::size_t uploaded_bytes;
+		std::uint64_t geometry_bytes;
+	};
+
+	// Does the CPU work of a frame, up to packing the pass data, the updated instance transforms and the instance
+	// slots of the draws in the upload buffer of the frame and creating an instance range per draw, without calling
+	// any graphics API. The resident instance buffer is a CPU array and mesh data is only allocated, not read. Frames are rendered on the calling thread, so
+	// that they can be profiled and tested without a GPU.
+	class Render_system final : public Maia::Mythology::IRender_system
+	{
+	public:
+
+		Render_system(Eigen::Vector2i window_size, std::uint8_t pipeline_length, Maia::Utilities::Worker_threads& worker_threads);
+
+
+		Mesh_ID load_meshes(Maia::Utilities::glTF::Gltf const& gltf) final;
+
+		void unload_meshes(Mesh_ID first_mesh) final;
+
+		void extract_frame(
+			Maia::GameEngine::Entity_manager const& entity_manager,
+			Maia::GameEngine::Entity camera_entity,
+			gsl::span<Maia::GameEngine::Entity_type_id const> entity_types_with_mesh,
+			gsl::span<Mesh_lods const> entity_types_mesh_lods,
+			gsl::span<Maia::GameEngine::Entity const> changed_entities
+		) final;
+
+		void wait() final;
+
+		void on_window_resized(Eigen::Vector2i new_size) final;
+
+		void set_occluders(std::vector<Maia::GameEngine::Culling::Occluder> occluders) final;
+
+		void on_scene_changed() final;
+
+
+		Frame_statistics const& get_last_frame_statistics() const;
+
+
+	private:
+
+		struct Loaded_meshes
+		{
+			Mesh_ID first_mesh;
+			std::vector<Maia::Renderer::Geometry_allocation> geometry_allocations;
+		};
+
+		// Part of the upload buffer of a frame that a draw reads its instance slots from.
+		struct Instance_range
+		{
+			Mesh_ID mesh;
+			std::size_t offset;
+			std::size_t size;
+		};
+
+
+		void render_frame(Maia::Renderer::Frame_packet const& frame_packet);
+
+
+		std::uint8_t const m_pipeline_length;
+		Eigen::Vector2i m_window_size;
+
+		std::size_t m_num_meshes;
+		Maia::Renderer::Geometry_pool m_geometry_pool;
+		std::vector<Loaded_meshes> m_loaded_meshes;
+		std::mutex m_meshes_mutex;
+
+		Maia::Mythology::Frame_extraction_system m_frame_extraction_system;
+		Maia::Renderer::Frame_packet m_frame_packet;
+
+		std::uint64_t m_submitted_frames;
+		std::vector<std::vector<std::byte>> m_upload_buffer_per_frame;
+		std::vector<Eigen::Matrix4f> m_resident_instance_transforms;
+		std::vector<Instance_range> m_instance_ranges;
+		Frame_statistics m_last_frame_statistics;
+
+	};
+}
+
+#endif
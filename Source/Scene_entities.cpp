@@ -0,0 +1,892 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Components/Lod_level.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+#include <Maia/GameEngine/Systems/World_bounds_system.hpp>
+
+#include <Maia/Utilities/Allocators/Scratch_arena.hpp>
+#include <Maia/Utilities/glTF/gltf.hpp>
+#include <Maia/Utilities/glTF/Mesh_bounds.hpp>
+
+#include "Scene_entities.hpp"
+
+using namespace Maia::GameEngine;
+using namespace Maia::GameEngine::Components;
+using namespace Maia::GameEngine::Systems;
+using namespace Maia::Utilities::glTF;
+
+namespace Maia::Mythology
+{
+	Maia::Utilities::glTF::Gltf read_gltf(std::filesystem::path const& gltf_file_path)
+	{
+		nlohmann::json const gltf_json = [&gltf_file_path]() -> nlohmann::json
+		{
+			std::ifstream file_stream{ gltf_file_path };
+
+			nlohmann::json json;
+			file_stream >> json;
+			return json;
+		}();
+
+		return gltf_json.get<Maia::Utilities::glTF::Gltf>();
+	}
+
+	namespace
+	{
+		std::vector<std::byte> base64_decode(std::string_view const input, std::size_t const output_size)
+		{
+			constexpr std::array<std::uint8_t, 128> reverse_table
+			{
+				64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+				64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+				64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
+				52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
+				64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+				15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
+				64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+				41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64
+			};
+
+			std::vector<std::byte> output;
+			output.reserve(output_size);
+
+			{
+				std::uint32_t bits{ 0 };
+				std::uint8_t bit_count{ 0 };
+
+				for (char const c : input)
+				{
+					if (std::isspace(c) || c == '=')
+					{
+						continue;
+					}
+
+					assert(c < 128);
+					assert(c > 0);
+					assert(reverse_table[c] < 64);
+
+					bits = (bits << 6) | reverse_table[c];
+					bit_count += 6;
+
+					if (bit_count >= 8)
+					{
+						bit_count -= 8;
+						output.push_back(static_cast<std::byte>((bits >> bit_count) & 0xFF));
+					}
+				}
+			}
+
+			assert(output.size() == output_size);
+
+			return output;
+		}
+	}
+
+	std::vector<std::byte> generate_byte_data(std::string_view const uri, std::size_t const byte_length)
+	{
+		if (uri.compare(0, 5, "data:") == 0)
+		{
+			char const* const base64_prefix{ "data:application/octet-stream;base64," };
+			std::size_t const base64_prefix_size{ std::strlen(base64_prefix) };
+
+			if (uri.compare(0, base64_prefix_size, base64_prefix) == 0)
+			{
+				std::string_view const data_view{ uri.data() + base64_prefix_size, uri.size() - base64_prefix_size };
+
+				return base64_decode(data_view, byte_length);
+			}
+			else
+			{
+				assert("Uri format not supported");
+			}
+		}
+		else
+		{
+			std::filesystem::path const file_path{ uri };
+			
+			if (std::filesystem::exists(file_path))
+			{
+				assert(std::filesystem::file_size(file_path) == byte_length);
+
+				std::vector<std::byte> file_content;
+				file_content.resize(byte_length);
+
+				{
+					std::basic_ifstream<std::byte> file_stream{ file_path, std::ios::binary };
+					file_stream.read(file_content.data(), byte_length);
+
+					assert(file_stream.good());
+				}
+
+				return file_content;
+			}
+			else
+			{
+				assert("Couldn't open file");
+			}
+		}
+	}
+
+
+	namespace
+	{
+		// glTF is right-handed with y up, while the engine has y down and z forward.
+		Eigen::Matrix3f create_to_engine_coordinates()
+		{
+			Eigen::Matrix3f to_engine_coordinates;
+			to_engine_coordinates <<
+				1.0f, 0.0f, 0.0f,
+				0.0f, -1.0f, 0.0f,
+				0.0f, 0.0f, -1.0f;
+
+			return to_engine_coordinates;
+		}
+
+		bool is_occluder(Node const& node)
+		{
+			return node.mesh_index && node.name && node.name->find("Occluder") != std::string::npos;
+		}
+
+		std::pmr::vector<Maia::GameEngine::Component_info> create_component_infos(
+			Maia::Utilities::glTF::Node const& node,
+			bool const has_parent,
+			std::pmr::memory_resource* const memory_resource
+		)
+		{
+			using namespace Maia::GameEngine;
+			using namespace Maia::GameEngine::Components;
+			using namespace Maia::GameEngine::Systems;
+
+			std::pmr::vector<Maia::GameEngine::Component_info> component_infos{ memory_resource };
+			component_infos.push_back(
+				create_component_info<Entity>()
+			);
+
+			if (node.mesh_index)
+			{
+				component_infos.push_back(
+					create_component_info<Local_bounds>()
+				);
+				component_infos.push_back(
+					create_component_info<World_bounds>()
+				);
+				component_infos.push_back(
+					create_component_info<Lod_level>()
+				);
+			}
+
+			if (node.camera_index)
+			{
+				component_infos.push_back(
+					create_component_info<Camera_component>()
+				);
+			}
+
+			{
+				component_infos.push_back(
+					create_component_info<Local_position>()
+				);
+				component_infos.push_back(
+					create_component_info<Local_rotation>()
+				);
+				component_infos.push_back(
+					create_component_info<Transform_matrix>()
+				);
+			}
+
+			if (has_parent)
+			{
+				component_infos.push_back(
+					create_component_info<Transform_root>()
+				);
+				component_infos.push_back(
+					create_component_info<Transform_parent>()
+				);
+			}
+			else
+			{
+				component_infos.push_back(
+					create_component_info<Transform_tree_dirty>()
+				);
+			}
+
+			return component_infos;
+		}
+
+		Space create_space(Maia::Utilities::glTF::Node const& node)
+		{
+			if (node.mesh_index)
+			{
+				return { 1000 + *node.mesh_index };
+			}
+			else
+			{
+				return { 0 };
+			}
+		}
+
+		Entity_type_id create_entity_type(
+			Entity_manager& entity_manager,
+			Maia::Utilities::glTF::Node const& node,
+			bool const has_parent,
+			std::size_t const capacity_per_chunk
+		)
+		{
+			Maia::Utilities::Scratch_scope scratch_scope;
+
+			std::pmr::vector<Maia::GameEngine::Component_info> const component_infos =
+				create_component_infos(node, has_parent, scratch_scope.resource());
+
+			Space const space = create_space(node);
+
+			return entity_manager.create_entity_type(
+				capacity_per_chunk, component_infos, space
+			);
+		}
+
+		// TODO move
+		Maia::GameEngine::Component_group_mask create_component_group_masks(
+			gsl::span<Maia::GameEngine::Component_info const> const component_infos
+		)
+		{
+			Maia::GameEngine::Component_group_mask component_group_mask = {};
+
+			for (Maia::GameEngine::Component_info const& component_info : component_infos)
+			{
+				component_group_mask.value.set(component_info.id.value);
+			}
+
+			return component_group_mask;
+		}
+
+		Maia::GameEngine::Entity create_free_camera_entity(Entity_manager& entity_manager)
+		{
+			using namespace Maia::GameEngine::Systems;
+
+			Entity_type_id const entity_type_id = entity_manager.create_entity_type<
+				Camera_component,
+				Local_position,
+				Local_rotation,
+				Transform_matrix,
+				Transform_tree_dirty,
+				Entity
+			>(1, Space{ 0 });
+
+			Entity const camera_entity = entity_manager.create_entity(entity_type_id);
+			entity_manager.set_component_data(camera_entity, Local_position{});
+			entity_manager.set_component_data(camera_entity, Local_rotation{});
+			entity_manager.set_component_data(camera_entity, Transform_matrix{});
+			entity_manager.set_component_data(camera_entity, Transform_tree_dirty{ true });
+
+			{
+				using namespace Maia::Utilities;
+
+				glTF::Camera camera;
+				camera.name = "Default";
+				camera.type = glTF::Camera::Type::Perspective;
+
+				{
+					glTF::Camera::Perspective perspective;
+					perspective.vertical_field_of_view = static_cast<float>(EIGEN_PI) / 3.0f;
+					perspective.near_z = 0.25f;
+					perspective.far_z = 100.0f;
+
+					camera.projection = perspective;
+				}
+
+
+				entity_manager.set_component_data(camera_entity, Camera_component{ camera });
+			}
+
+			return camera_entity;
+		}
+
+		std::pair<Entity_type_id, Entity> create_entity(
+			Entity_manager& entity_manager,
+			gsl::span<Maia::GameEngine::Entity const> const entities,
+			gsl::span<Maia::Utilities::glTF::Camera const> const cameras,
+			gsl::span<Local_bounds const> const meshes_local_bounds,
+			Node const& node,
+			std::optional<Entity> const root_entity,
+			std::optional<Entity> const parent_entity,
+			std::size_t const capacity_per_chunk
+		)
+		{
+			Entity_type_id const entity_type_id =
+				create_entity_type(entity_manager, node, parent_entity.has_value(), capacity_per_chunk);
+
+			Entity const entity =
+				entity_manager.create_entity(entity_type_id);
+
+			if (node.mesh_index)
+			{
+				entity_manager.set_component_data(entity, meshes_local_bounds[*node.mesh_index]);
+				entity_manager.set_component_data(entity, World_bounds{});
+				entity_manager.set_component_data(entity, Lod_level{ 0 });
+			}
+
+			if (node.camera_index)
+			{
+				assert(!node.child_indices && !node.mesh_index && "Camera-only nodes supported at the moment");
+
+				Camera_component const camera_component = { cameras[*node.camera_index] };
+
+				entity_manager.set_component_data(entity, camera_component);
+			}
+
+			{
+				Eigen::Matrix3f const to_engine_coordinates = create_to_engine_coordinates();
+
+
+				Local_rotation const local_rotation = [&]() -> Local_rotation
+				{
+					if (node.camera_index)
+					{
+						if (parent_entity)
+						{
+							return { Eigen::Quaternionf{ to_engine_coordinates * node.rotation } };
+						}
+						else
+						{
+							return { Eigen::Quaternionf{ node.rotation } };
+						}
+					}
+					else
+					{
+						if (parent_entity)
+						{
+							return { Eigen::Quaternionf{ node.rotation } };
+						}
+						else
+						{
+							return { Eigen::Quaternionf{ to_engine_coordinates * node.rotation } };
+						}
+					}
+				}();
+
+				entity_manager.set_component_data(entity, local_rotation);
+
+
+				Local_position const local_position = [&]() -> Local_position
+				{
+					if (parent_entity)
+					{
+						return { node.translation };
+					}
+					else
+					{
+						return { to_engine_coordinates * node.translation };
+					}
+				}();
+
+				entity_manager.set_component_data(entity, local_position);
+			}
+
+			if (parent_entity)
+			{
+				{
+					entity_manager.set_components_data(entity, Transform_root{ *root_entity });
+				}
+
+				{
+					entity_manager.set_components_data(entity, Transform_parent{ *parent_entity });
+				}
+			}
+			else
+			{
+				entity_manager.set_components_data(entity, Transform_tree_dirty{ true });
+			}
+
+			return { entity_type_id, entity };
+		}
+
+		void create_entities_of_tree_hierarchy(
+			Scene_entities& scene_entities,
+			Entity_manager& entity_manager,
+			std::vector<Maia::GameEngine::Entity>& entities,
+			gsl::span<Maia::Utilities::glTF::Camera const> const cameras,
+			gsl::span<Local_bounds const> const meshes_local_bounds,
+			gsl::span<Maia::Utilities::glTF::Node const> const nodes,
+			std::size_t const node_index,
+			std::optional<Entity> const root_entity,
+			std::optional<Entity> const parent_entity,
+			std::size_t const capacity_per_chunk
+		)
+		{
+			Node const& node = nodes[node_index];
+
+			if (is_occluder(node))
+			{
+				return;
+			}
+
+			std::pair<Entity_type_id, Entity> const entity = create_entity(
+				entity_manager, entities, cameras, meshes_local_bounds,
+				node, root_entity, parent_entity,
+				capacity_per_chunk
+			);
+
+			{
+				std::cout << "Node_index: " << node_index;
+				std::cout << "| Entity type " << entity.first.value;
+				std::cout << "| Entity " << entity.second.value;
+				
+				if (entity_manager.has_component<Transform_root>(entity.second))
+				{
+					Transform_root const root =
+						entity_manager.get_component_data<Transform_root>(entity.second);
+
+					std::cout << " | Root " << root.entity.value;
+				}
+
+				if (entity_manager.has_component<Transform_parent>(entity.second))
+				{
+					Transform_parent const parent = 
+						entity_manager.get_component_data<Transform_parent>(entity.second);
+
+					std::cout << " | Parent " << parent.entity.value;
+				}
+
+				std::cout << std::endl;
+			}
+			
+			
+
+			entities.push_back(entity.second);
+
+			if (parent_entity)
+			{
+				scene_entities.transform_hierarchy.set_parent(entity.second, *parent_entity);
+			}
+
+			if (node.mesh_index)
+			{
+			}
+
+			if (node.camera_index)
+			{
+				scene_entities.cameras.push_back(entity.second);
+			}
+
+			if (node.child_indices)
+			{
+				for (std::size_t const child_index : *node.child_indices)
+				{
+					create_entities_of_tree_hierarchy(
+						scene_entities,
+						entity_manager,
+						entities,
+						cameras,
+						meshes_local_bounds,
+						nodes,
+						child_index,
+						root_entity ? root_entity : entity.second,
+						entity.second,
+						capacity_per_chunk
+					);
+				}
+			}
+		}
+
+		std::vector<Local_bounds> create_meshes_local_bounds(
+			Maia::Utilities::glTF::Gltf const& gltf
+		)
+		{
+			std::vector<Local_bounds> meshes_local_bounds;
+
+			if (gltf.meshes)
+			{
+				// The accessor min and max are normally present, so the buffers are only read to scan positions when some are missing
+				std::vector<std::vector<std::byte>> const buffers_data = [&gltf]() -> std::vector<std::vector<std::byte>>
+				{
+					std::vector<std::vector<std::byte>> buffers_data;
+
+					bool const requires_scan = std::any_of(gltf.meshes->begin(), gltf.meshes->end(), [&gltf](Mesh const& mesh) -> bool
+					{
+						return requires_buffers_data(gltf, mesh);
+					});
+
+					if (requires_scan && gltf.buffers)
+					{
+						buffers_data.reserve(gltf.buffers->size());
+
+						for (Buffer const& buffer : *gltf.buffers)
+						{
+							buffers_data.push_back(
+								buffer.uri ? generate_byte_data(*buffer.uri, buffer.byte_length) : std::vector<std::byte>{}
+							);
+						}
+					}
+
+					return buffers_data;
+				}();
+
+				meshes_local_bounds.reserve(gltf.meshes->size());
+
+				for (Mesh const& mesh : *gltf.meshes)
+				{
+					std::optional<Bounds> const bounds = calculate_mesh_bounds(gltf, mesh, buffers_data);
+
+					meshes_local_bounds.push_back(
+						bounds ? Local_bounds{ { bounds->minimum, bounds->maximum } } : Local_bounds{}
+					);
+				}
+			}
+
+			return meshes_local_bounds;
+		}
+
+		// Returns the bytes of the elements of accessor, which are byte_stride bytes apart.
+		std::pair<gsl::span<std::byte const>, std::size_t> get_accessor_data(
+			Maia::Utilities::glTF::Gltf const& gltf,
+			Accessor const& accessor,
+			gsl::span<std::vector<std::byte> const> const buffers_data
+		)
+		{
+			assert(accessor.buffer_view_index && gltf.buffer_views);
+
+			Buffer_view const& buffer_view = gltf.buffer_views->at(*accessor.buffer_view_index);
+			std::vector<std::byte> const& buffer_data = buffers_data[buffer_view.buffer_index];
+
+			std::size_t const first_byte = buffer_view.byte_offset + accessor.byte_offset;
+			std::size_t const last_byte = buffer_view.byte_offset + buffer_view.byte_length;
+			assert(first_byte <= last_byte && last_byte <= buffer_data.size());
+
+			std::size_t const element_size = std::size_t{ size_of(accessor.type) } * size_of(accessor.component_type);
+
+			return
+			{
+				{ buffer_data.data() + first_byte, static_cast<std::ptrdiff_t>(last_byte - first_byte) },
+				buffer_view.byte_stride ? *buffer_view.byte_stride : element_size
+			};
+		}
+
+		std::uint32_t read_index(std::byte const* const data, Component_type const component_type)
+		{
+			switch (component_type)
+			{
+			case Component_type::Unsigned_byte:
+				return std::to_integer<std::uint32_t>(*data);
+
+			case Component_type::Unsigned_short:
+			{
+				std::uint16_t index;
+				std::memcpy(&index, data, sizeof(index));
+				return index;
+			}
+
+			default:
+			{
+				assert(component_type == Component_type::Unsigned_int);
+
+				std::uint32_t index;
+				std::memcpy(&index, data, sizeof(index));
+				return index;
+			}
+			}
+		}
+
+		// Appends the triangles of the primitives of mesh, transformed by transform.
+		void append_occluder_triangles(
+			Maia::Utilities::glTF::Gltf const& gltf,
+			Mesh const& mesh,
+			gsl::span<std::vector<std::byte> const> const buffers_data,
+			Eigen::Matrix4f const& transform,
+			Maia::GameEngine::Culling::Occluder& occluder
+		)
+		{
+			for (Primitive const& primitive : mesh.primitives)
+			{
+				auto const position_location = primitive.attributes.find("POSITION");
+
+				if (position_location == primitive.attributes.end())
+				{
+					continue;
+				}
+
+				Accessor const& positions_accessor = gltf.accessors->at(position_location->second);
+				assert(positions_accessor.component_type == Component_type::Float && positions_accessor.type == Accessor::Type::Vector3);
+
+				std::uint32_t const first_vertex = gsl::narrow_cast<std::uint32_t>(occluder.vertices.size());
+
+				{
+					auto const [data, byte_stride] = get_accessor_data(gltf, positions_accessor, buffers_data);
+
+					for (std::size_t index = 0; index < positions_accessor.count; ++index)
+					{
+						Eigen::Vector3f position;
+						std::memcpy(position.data(), data.data() + index * byte_stride, 3 * sizeof(float));
+
+						occluder.vertices.push_back((transform * position.homogeneous()).head<3>());
+					}
+				}
+
+				if (primitive.indices_index)
+				{
+					Accessor const& indices_accessor = gltf.accessors->at(*primitive.indices_index);
+					auto const [data, byte_stride] = get_accessor_data(gltf, indices_accessor, buffers_data);
+
+					for (std::size_t index = 0; index < indices_accessor.count; ++index)
+					{
+						occluder.indices.push_back(first_vertex + read_index(data.data() + index * byte_stride, indices_accessor.component_type));
+					}
+				}
+				else
+				{
+					for (std::uint32_t index = 0; index < positions_accessor.count; ++index)
+					{
+						occluder.indices.push_back(first_vertex + index);
+					}
+				}
+			}
+		}
+
+		void create_occluders_of_tree_hierarchy(
+			Maia::Utilities::glTF::Gltf const& gltf,
+			gsl::span<std::vector<std::byte> const> const buffers_data,
+			std::size_t const node_index,
+			std::optional<Eigen::Matrix4f> const& parent_transform,
+			std::vector<Maia::GameEngine::Culling::Occluder>& occluders
+		)
+		{
+			Node const& node = gltf.nodes->at(node_index);
+
+			// Same local transform as the entities created for nodes without a camera
+			Eigen::Matrix3f const to_engine_coordinates = create_to_engine_coordinates();
+
+			Transform_matrix const local_transform = parent_transform ?
+				create_transform({ node.translation }, { node.rotation }) :
+				create_transform({ to_engine_coordinates * node.translation }, { Eigen::Quaternionf{ to_engine_coordinates * node.rotation } });
+
+			Eigen::Matrix4f const transform = parent_transform ? Eigen::Matrix4f{ *parent_transform * local_transform.value } : local_transform.value;
+
+			if (is_occluder(node))
+			{
+				Maia::GameEngine::Culling::Occluder occluder;
+				append_occluder_triangles(gltf, gltf.meshes->at(*node.mesh_index), buffers_data, transform, occluder);
+
+				occluders.push_back(std::move(occluder));
+			}
+			else if (node.child_indices)
+			{
+				for (std::size_t const child_index : *node.child_indices)
+				{
+					create_occluders_of_tree_hierarchy(gltf, buffers_data, child_index, transform, occluders);
+				}
+			}
+		}
+
+		std::vector<Maia::GameEngine::Culling::Occluder> create_occluders(
+			Maia::Utilities::glTF::Gltf const& gltf,
+			Maia::Utilities::glTF::Scene const& scene
+		)
+		{
+			std::vector<Maia::GameEngine::Culling::Occluder> occluders;
+
+			bool const has_occluders = gltf.nodes && std::any_of(gltf.nodes->begin(), gltf.nodes->end(), is_occluder);
+
+			if (!has_occluders || !scene.nodes || !gltf.buffers)
+			{
+				return occluders;
+			}
+
+			std::vector<std::vector<std::byte>> buffers_data;
+			buffers_data.reserve(gltf.buffers->size());
+
+			for (Buffer const& buffer : *gltf.buffers)
+			{
+				buffers_data.push_back(
+					buffer.uri ? generate_byte_data(*buffer.uri, buffer.byte_length) : std::vector<std::byte>{}
+				);
+			}
+
+			for (std::size_t const node_index : *scene.nodes)
+			{
+				create_occluders_of_tree_hierarchy(gltf, buffers_data, node_index, {}, occluders);
+			}
+
+			return occluders;
+		}
+
+		std::pair<std::vector<Entity_type_id>, std::vector<Mesh_ID>> create_entity_type_to_mesh(
+			Entity_manager& entity_manager,
+			gsl::span<Maia::Utilities::glTF::Node const> const nodes,
+			gsl::span<std::optional<std::size_t> const> const parents,
+			std::size_t const capacity_per_chunk
+		)
+		{
+			assert(nodes.size() == parents.size());
+
+			std::unordered_map<Entity_type_id, Mesh_ID> entity_type_to_mesh;
+
+			for (std::ptrdiff_t index = 0; index < nodes.size(); ++index)
+			{
+				Node const& node = nodes[index];
+
+				if (node.mesh_index && !is_occluder(node))
+				{
+					std::optional<std::size_t> const& parent = parents[index];
+
+					Entity_type_id const entity_type_id =
+						create_entity_type(entity_manager, node, parent.has_value(), capacity_per_chunk);
+
+					auto const mesh_location = entity_type_to_mesh.find(entity_type_id);
+
+					if (mesh_location == entity_type_to_mesh.end())
+					{
+						entity_type_to_mesh[entity_type_id] = { gsl::narrow_cast<std::uint16_t>(*node.mesh_index) };
+					}
+					else
+					{
+						assert(entity_type_to_mesh.at(entity_type_id).value == *node.mesh_index);
+					}
+				}
+			}
+
+			{
+				std::vector<Entity_type_id> entity_types_with_mesh;
+				entity_types_with_mesh.reserve(entity_type_to_mesh.size());
+
+				std::vector<Mesh_ID> entity_types_mesh_indices;
+				entity_types_mesh_indices.reserve(entity_type_to_mesh.size());
+
+				for (std::pair<const Entity_type_id, Mesh_ID> const entity_type_mesh : entity_type_to_mesh)
+				{
+					entity_types_with_mesh.push_back(entity_type_mesh.first);
+					entity_types_mesh_indices.push_back(entity_type_mesh.second);
+				}
+
+				return { std::move(entity_types_with_mesh), std::move(entity_types_mesh_indices) };
+			}
+		}
+	}
+
+	Scene_entities create_entities(
+		Maia::Utilities::glTF::Gltf const& gltf,
+		Maia::Utilities::glTF::Scene const& scene,
+		Maia::GameEngine::Entity_manager& entity_manager,
+		Mesh_ID const first_mesh,
+		std::size_t const capacity_per_chunk
+	)
+	{
+		using namespace Maia::GameEngine;
+		using namespace Maia::GameEngine::Systems;
+		using namespace Maia::Utilities::glTF;
+
+		gsl::span<Maia::Utilities::glTF::Node const> const nodes = *gltf.nodes;
+		gsl::span<Maia::Utilities::glTF::Camera const> const cameras = *gltf.cameras;
+
+		Scene_entities scene_entities;
+
+		std::vector<Maia::GameEngine::Entity>& entities = scene_entities.entities;
+
+		std::vector<Local_bounds> const meshes_local_bounds = create_meshes_local_bounds(gltf);
+
+		{
+			/*scene_entities.cameras.push_back(
+				create_free_camera_entity(entity_manager)
+			);*/
+		}
+
+		{
+			std::vector<std::optional<std::size_t>> parents(nodes.size(), std::optional<std::size_t>{});
+			{
+				for (std::size_t node_index = 0; node_index < nodes.size(); ++node_index)
+				{
+					Node const& node = nodes[node_index];
+
+					if (node.child_indices)
+					{
+						for (std::size_t const child_index : *node.child_indices)
+						{
+							parents[child_index] = node_index;
+						}
+					}
+				}
+			}
+
+			std::pair<std::vector<Entity_type_id>, std::vector<Mesh_ID>> entity_type_to_mesh =
+				create_entity_type_to_mesh(
+					entity_manager, nodes, parents, capacity_per_chunk
+				);
+
+			for (std::size_t i = 0; i < entity_type_to_mesh.first.size(); ++i)
+			{
+				Entity_type_id const entity_type = entity_type_to_mesh.first[i];
+				Mesh_ID const mesh = entity_type_to_mesh.second[i];
+
+				std::cout << "Entity type " << entity_type.value << " -> " << "Mesh " << mesh.value << "\n";
+			}
+
+			scene_entities.entity_types_with_mesh = std::move(entity_type_to_mesh.first);
+
+			// glTF has no levels of detail, so each mesh is its only level until simplified meshes are generated
+			for (Mesh_ID const mesh : entity_type_to_mesh.second)
+			{
+				scene_entities.entity_types_mesh_lods.push_back({ { { gsl::narrow_cast<std::uint16_t>(first_mesh.value + mesh.value) } } });
+				scene_entities.entity_types_lod_groups.push_back({});
+			}
+		}
+
+		// TODO check
+		if (scene.nodes)
+		{
+			entities.reserve(nodes.size());
+
+			for (std::size_t const node_index : *scene.nodes)
+			{
+				create_entities_of_tree_hierarchy(
+					scene_entities,
+					entity_manager,
+					entities,
+					cameras,
+					meshes_local_bounds,
+					nodes,
+					node_index,
+					{},
+					{},
+					capacity_per_chunk
+				);
+			}
+		}
+
+		scene_entities.occluders = create_occluders(gltf, scene);
+
+		return scene_entities;
+	}
+
+	void destroy_entities(
+		Scene_entities& scene_entities,
+		Maia::GameEngine::Entity_manager& entity_manager
+		// TODO entity types
+	)
+	{
+		// Destroying a root destroys its whole tree
+		for (Maia::GameEngine::Entity const entity : scene_entities.entities)
+		{
+			if (entity_manager.exists(entity) && !scene_entities.transform_hierarchy.get_parent(entity))
+			{
+				Maia::GameEngine::Systems::destroy_transform_entity(entity_manager, scene_entities.transform_hierarchy, entity);
+			}
+		}
+
+		scene_entities.entities.clear();
+		scene_entities.cameras.clear();
+
+		// TODO destroy entity types
+		// TODO call this from destructor of struct returned by create_entities
+	}
+}
@@ -0,0 +1,62 @@
+#ifndef MAIA_MYTHOLOGY_SCENEENTITIES_H_INCLUDED
+#define MAIA_MYTHOLOGY_SCENEENTITIES_H_INCLUDED
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include <Maia/GameEngine/Entity_manager.hpp>
+#include <Maia/GameEngine/Culling/Occlusion_buffer.hpp>
+#include <Maia/GameEngine/Lod/Lod_selection.hpp>
+#include <Maia/GameEngine/Systems/Transform_system.hpp>
+
+#include <Maia/Utilities/glTF/gltf.hpp>
+
+#include <Components/Camera_component.hpp>
+#include <Components/Mesh_ID.hpp>
+
+namespace Maia::Mythology
+{
+	Maia::Utilities::glTF::Gltf read_gltf(std::filesystem::path const& gltf_file_path);
+
+	// Content of a glTF buffer, either embedded as base64 or in a file relative to the working directory.
+	std::vector<std::byte> generate_byte_data(std::string_view uri, std::size_t byte_length);
+
+
+	struct Scene_entities
+	{
+		std::vector<Maia::GameEngine::Entity> entities;
+		std::vector<Maia::GameEngine::Entity> cameras;
+
+		Maia::GameEngine::Transform_hierarchy transform_hierarchy;
+
+		std::vector<Maia::GameEngine::Entity_type_id> entity_types_with_mesh;
+		std::vector<Maia::Mythology::Mesh_lods> entity_types_mesh_lods;
+		std::vector<Maia::GameEngine::Lod::Lod_group> entity_types_lod_groups;
+
+		// World space geometry of the nodes whose name contains "Occluder", which are not drawn.
+		std::vector<Maia::GameEngine::Culling::Occluder> occluders;
+	};
+
+	// The mesh with index i in gltf is identified by first_mesh + i.
+	// Nodes whose name contains "Occluder" and their children do not become entities, their meshes are only used as
+	// occluders.
+	// Use Maia::GameEngine::calculate_statistics to tune capacity_per_chunk for a given scene.
+	Scene_entities create_entities(
+		Maia::Utilities::glTF::Gltf const& gltf,
+		Maia::Utilities::glTF::Scene const& scene,
+		Maia::GameEngine::Entity_manager& entity_manager,
+		Mesh_ID first_mesh,
+		std::size_t capacity_per_chunk = 10
+	);
+	// Destroys the entities of scene_entities through its transform hierarchy, so that the values of the destroyed
+	// entities can be reused by the entities of another scene.
+	void destroy_entities(
+		Scene_entities& scene_entities,
+		Maia::GameEngine::Entity_manager& entity_manager
+		// TODO entity types
+	);
+}
+
+#endif
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 #include "Win32/Window.hpp"
 #include "Application.hpp"
@@ -8,6 +10,7 @@
 
 #include <Maia/Renderer/D3D12/Utilities/Check_hresult.hpp>
 #include <Maia/Renderer/D3D12/Utilities/D3D12_utilities.hpp>
+#include <Maia/Utilities/Threading/Worker_threads.hpp>
 
 using namespace Maia::Renderer::D3D12;
 
@@ -163,7 +166,8 @@ namespace
 		ID3D12CommandQueue& direct_command_queue,
 		Maia::Mythology::Win32::Window const& window,
 		IDXGISwapChain3& swap_chain,
-		bool const vertical_sync
+		bool const vertical_sync,
+		Maia::Utilities::Worker_threads& worker_threads
 	)
 	{
 		Eigen::Vector2i const dimensions = [&]() -> Eigen::Vector2i
@@ -179,17 +183,11 @@ namespace
 			direct_command_queue,
 			{ swap_chain, dimensions },
 			3,
-			vertical_sync
+			vertical_sync,
+			worker_threads
 		};
 	}
 
-	Maia::Mythology::Application create_application(ID3D12Device& device)
-	{
-		auto load_scene_system = std::make_unique<Maia::Mythology::D3D12::Load_scene_system>(device);
-
-		return Maia::Mythology::Application{ std::move(load_scene_system) };
-	}
-
 	bool constexpr c_vertical_sync = false;
 
 	struct App
@@ -199,6 +197,7 @@ namespace
 
 		std::unique_ptr<Render_resources> m_render_resources;
 		winrt::com_ptr<IDXGISwapChain3> m_swap_chain;
+		Maia::Utilities::Worker_threads m_worker_threads;
 		Maia::Mythology::D3D12::Render_system m_render_system;
 
 		Maia::Mythology::Application m_application;
@@ -208,8 +207,9 @@ namespace
 			m_input_system{ create_input_system(m_window.instance(), m_window.handle()) },
 			m_render_resources{ std::make_unique<Render_resources>() },
 			m_swap_chain{ create_swap_chain(*m_render_resources->factory, *m_render_resources->adapter, *m_render_resources->direct_command_queue, m_window, 3, c_vertical_sync) },
-			m_render_system{ create_render_system(*m_render_resources->device, *m_render_resources->copy_command_queue, *m_render_resources->direct_command_queue, m_window, *m_swap_chain, c_vertical_sync) },
-			m_application{ create_application(*m_render_resources->device) }
+			m_worker_threads{ std::max(std::thread::hardware_concurrency(), 1u) },
+			m_render_system{ create_render_system(*m_render_resources->device, *m_render_resources->copy_command_queue, *m_render_resources->direct_command_queue, m_window, *m_swap_chain, c_vertical_sync, m_worker_threads) },
+			m_application{ m_render_system }
 		{
 		}
 		~App()
@@ -220,7 +220,6 @@ namespace
 		void run()
 		{
 			m_application.run(
-				m_render_system,
 				process_all_pending_events,
 				m_input_system
 			);